@@ -412,6 +412,12 @@ private:
   Max_DeltaTime,  		/*!< \brief Max delta time. */
   Unst_CFL;		/*!< \brief Unsteady CFL number. */
   bool ReorientElements;		/*!< \brief Flag for enabling element reorientation. */
+  unsigned short Kind_Point_Ordering;		/*!< \brief Renumbering of the points at preprocessing. */
+  bool Partition_Weights;		/*!< \brief Weight the points and edges of the graph given to ParMETIS. */
+  su2double Partition_Wall_Weight;		/*!< \brief Weight factor of the points on walls, actuator disks and interfaces. */
+  string Partition_Cost_FileName;		/*!< \brief File with the measured cost of each point, read and written by the weighted partitioning. */
+  unsigned long Rebalance_Freq;		/*!< \brief Number of time steps between the checks of the load balance. */
+  su2double Rebalance_Threshold;		/*!< \brief Imbalance of the ranks above which the grid is partitioned again. */
   bool AddIndNeighbor;			/*!< \brief Include indirect neighbor in the agglomeration process. */
   unsigned short nDV,		/*!< \brief Number of design variables. */
   nObj, nObjW;              /*! \brief Number of objective functions. */
@@ -455,6 +461,7 @@ private:
   Kind_Linear_Solver,		/*!< \brief Numerical solver for the implicit scheme. */
   Kind_Linear_Solver_FSI_Struc,	 /*!< \brief Numerical solver for the structural part in FSI problems. */
   Kind_Linear_Solver_Prec,		/*!< \brief Preconditioner of the linear solver. */
+  Kind_Linear_Solver_Orthogonalization,		/*!< \brief Orthogonalization of the Krylov basis of the linear solver. */
   Kind_Linear_Solver_Prec_FSI_Struc,		/*!< \brief Preconditioner of the linear solver for the structural part in FSI problems. */
   Kind_AdjTurb_Linear_Solver,		/*!< \brief Numerical solver for the turbulent adjoint implicit scheme. */
   Kind_AdjTurb_Linear_Prec,		/*!< \brief Preconditioner of the turbulent adjoint linear solver. */
@@ -508,6 +515,7 @@ private:
   MUSCL_Heat,	 /*!< \brief MUSCL scheme for the (fvm) heat equation.*/
   MUSCL_AdjFlow,		/*!< \brief MUSCL scheme for the adj flow equations.*/
   MUSCL_AdjTurb; 	/*!< \brief MUSCL scheme for the adj turbulence equations.*/
+  bool Flux_Batch_Flow;		/*!< \brief Evaluate the convective flux of the flow equations in batches of edges.*/
   bool FSI_Problem,			/*!< \brief Boolean to determine whether the simulation is FSI or not. */
   ZoneSpecific_Problem;   /*!< \brief Boolean to determine whether we wish to use zone-specific solvers. */
   unsigned short nID_DV;  /*!< \brief ID for the region of FEM when computed using direct differentiation. */
@@ -532,6 +540,13 @@ private:
   unsigned long Linear_Solver_Iter_Heat;       /*!< \brief Max iterations of the linear solver for the implicit formulation in the fvm heat solver. */
   unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned short Linear_Solver_ILU_n;		/*!< \brief ILU fill=in level. */
+  bool Linear_Solver_Prec_Single;		/*!< \brief Store the ILU factors in single precision. */
+  bool Linear_Solver_Level_Scheduling;		/*!< \brief Level scheduled (parallel) sweeps of the ILU and LU_SGS preconditioners. */
+  unsigned short Linear_Solver_Recycle;		/*!< \brief Number of directions recycled by FGMRES between linear solves. */
+  unsigned long Linear_Solver_Prec_Lag;		/*!< \brief Number of nonlinear iterations between rebuilds of the preconditioner. */
+  su2double Linear_Solver_Prec_Lag_Degrade;		/*!< \brief Degradation of the linear convergence rate that forces a rebuild of the preconditioner. */
+  bool MatrixFree_Jacobian;		/*!< \brief Jacobian-free Newton-Krylov, the Jacobian is only used as preconditioner. */
+  su2double MatrixFree_Step;		/*!< \brief Relative step of the finite difference Jacobian-vector products. */
   su2double SemiSpan;		/*!< \brief Wing Semi span. */
   su2double Roe_Kappa;		/*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Flow;		/*!< \brief Relaxation coefficient of the linear solver mean flow. */
@@ -671,6 +686,7 @@ private:
   unsigned short Analytical_Surface;	/*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;	/*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat;	/*!< \brief Mesh output format. */
   unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
   unsigned short ActDisk_Jump;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
@@ -921,6 +937,7 @@ private:
   long Visualize_CV;          /*!< \brief Node number for the CV to be visualized */
   bool ExtraOutput;
   long ExtraHeatOutputZone;   /*!< \brief Heat solver zone with extra screen output */
+  bool Check_Scratch_Memory;   /*!< \brief Stop if the scratch memory of the solvers allocates after the first iteration. */
   bool DeadLoad; 	          	/*!< Application of dead loads to the FE analysis */
   bool PseudoStatic;    /*!< Application of dead loads to the FE analysis */
   bool MatchingMesh; 	        /*!< Matching mesh (while implementing interpolation procedures). */
@@ -1505,6 +1522,12 @@ public:
    */
   long GetExtraHeatOutputZone(void);
   
+  /*!
+   * \brief Get whether the scratch memory of the solvers is checked for allocations after the first iteration.
+   * \return <code>TRUE</code> if a later allocation stops the run; otherwise <code>FALSE</code>.
+   */
+  bool GetCheck_Scratch_Memory(void);
+  
   /*!
    * \brief Get the value of the Mach number (velocity divided by speed of sound).
    * \return Value of the Mach number.
@@ -2243,6 +2266,12 @@ public:
    */
   void SetKind_TimeIntScheme(unsigned short val_kind_timeintscheme);
   
+  /*!
+   * \brief Set the kind of time integration scheme of the flow equations.
+   * \param[in] val_kind_timeintscheme - Kind of time integration scheme.
+   */
+  void SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme);
+  
   /*!
    * \brief Set the parameters of the convective numerical scheme.
    * \note The parameters will change because we are solving different kind of equations.
@@ -2688,6 +2717,42 @@ public:
    */
   bool GetReorientElements(void);
   
+  /*!
+   * \brief Get the renumbering of the points applied at preprocessing.
+   * \return Kind of point ordering (none, RCM or Hilbert curve).
+   */
+  unsigned short GetKind_Point_Ordering(void);
+  
+  /*!
+   * \brief Get if the graph given to ParMETIS has weights on its points and edges.
+   * \return <code>TRUE</code> if the partitioning is weighted.
+   */
+  bool GetPartition_Weights(void);
+  
+  /*!
+   * \brief Get the weight factor of the points on walls, actuator disks and interfaces for the partitioning.
+   * \return Weight factor.
+   */
+  su2double GetPartition_Wall_Weight(void);
+  
+  /*!
+   * \brief Get the name of the file with the measured cost of each point for the partitioning.
+   * \return Name of the file.
+   */
+  string GetPartition_Cost_FileName(void);
+  
+  /*!
+   * \brief Get the number of time steps between the checks of the load balance of the ranks.
+   * \return Frequency of the checks, 0 if the dynamic load balancing is disabled.
+   */
+  unsigned long GetRebalance_Freq(void);
+  
+  /*!
+   * \brief Get the imbalance of the ranks (max/average time) above which the grid is partitioned again.
+   * \return Threshold of the imbalance.
+   */
+  su2double GetRebalance_Threshold(void);
+  
   /*!
    * \brief Get the Courant Friedrich Levi number for unsteady simulations.
    * \return CFL number for unsteady simulations.
@@ -3708,6 +3773,12 @@ public:
    */
   unsigned short GetKind_Linear_Solver_Prec(void);
   
+  /*!
+   * \brief Get the kind of orthogonalization of the Krylov basis of the linear solver.
+   * \return Modified or classical (with reorthogonalization) Gram-Schmidt.
+   */
+  unsigned short GetKind_Linear_Solver_Orthogonalization(void);
+  
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -3755,6 +3826,48 @@ public:
    * \return Fill in level of the ILU preconditioner for the linear solver.
    */
   unsigned short GetLinear_Solver_ILU_n(void);
+  
+  /*!
+   * \brief Get whether the factors of the ILU preconditioner are stored in single precision.
+   * \return <code>TRUE</code> if the ILU factors are stored in single precision.
+   */
+  bool GetLinear_Solver_Prec_Single(void);
+  
+  /*!
+   * \brief Get whether the ILU and LU_SGS sweeps are level scheduled.
+   * \return <code>TRUE</code> if the sweeps run by levels (in parallel); <code>FALSE</code> for the natural order.
+   */
+  bool GetLinear_Solver_Level_Scheduling(void);
+  
+  /*!
+   * \brief Get the number of directions recycled by FGMRES between linear solves.
+   * \return Maximum size of the recycled subspace, 0 if recycling is disabled.
+   */
+  unsigned short GetLinear_Solver_Recycle(void);
+  
+  /*!
+   * \brief Get the number of nonlinear iterations between rebuilds of the preconditioner.
+   * \return Maximum age of a lagged JACOBI/ILU preconditioner, 1 rebuilds it at every iteration.
+   */
+  unsigned long GetLinear_Solver_Prec_Lag(void);
+  
+  /*!
+   * \brief Get the degradation of the linear convergence rate that forces a rebuild of a lagged preconditioner.
+   * \return Maximum ratio between the current and the reference linear iterations per decade of residual reduction.
+   */
+  su2double GetLinear_Solver_Prec_Lag_Degrade(void);
+  
+  /*!
+   * \brief Get whether the flow Jacobian-vector products are computed matrix-free.
+   * \return <code>TRUE</code> if the products are finite differences of the residual, the Jacobian is then only the preconditioner.
+   */
+  bool GetMatrixFree_Jacobian(void);
+  
+  /*!
+   * \brief Get the relative step of the matrix-free Jacobian-vector products.
+   * \return Relative step of the finite differences.
+   */
+  su2double GetMatrixFree_Step(void);
 
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
@@ -4025,6 +4138,12 @@ public:
    */
   bool GetMUSCL_Flow(void);
   
+  /*!
+   * \brief Get if the convective flux of the flow equations is evaluated in batches of edges of the same color.
+   * \return <code>TRUE</code> if the batched (vectorized) flux routines are used.
+   */
+  bool GetFlux_Batch_Flow(void);
+  
   /*!
    * \brief Get if the upwind scheme used MUSCL or not.
    * \note This is the information that the code will use, the method will
@@ -5058,6 +5177,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void);
   
+  /*!
+   * \brief Get the format of the output grid (SU2_DEF, SU2_MSH).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void);
+  
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
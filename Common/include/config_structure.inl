@@ -323,6 +323,18 @@ inline long CConfig::GetUnst_AdjointIter(void) { return Unst_AdjointIter; }
 
 inline bool CConfig::GetReorientElements(void) { return ReorientElements; }
 
+inline unsigned short CConfig::GetKind_Point_Ordering(void) { return Kind_Point_Ordering; }
+
+inline bool CConfig::GetPartition_Weights(void) { return Partition_Weights; }
+
+inline su2double CConfig::GetPartition_Wall_Weight(void) { return Partition_Wall_Weight; }
+
+inline string CConfig::GetPartition_Cost_FileName(void) { return Partition_Cost_FileName; }
+
+inline unsigned long CConfig::GetRebalance_Freq(void) { return Rebalance_Freq; }
+
+inline su2double CConfig::GetRebalance_Threshold(void) { return Rebalance_Threshold; }
+
 inline unsigned long CConfig::GetIter_Avg_Objective(void) { return Iter_Avg_Objective ; }
 
 inline long CConfig::GetDyn_RestartIter(void) { return Dyn_RestartIter; }
@@ -353,6 +365,8 @@ inline bool CConfig::GetExtraOutput(void) { return ExtraOutput; }
 
 inline long CConfig::GetExtraHeatOutputZone(void) { return ExtraHeatOutputZone; }
 
+inline bool CConfig::GetCheck_Scratch_Memory(void) { return Check_Scratch_Memory; }
+
 inline su2double CConfig::GetRefArea(void) { return RefArea; }
 
 inline su2double CConfig::GetWaveSpeed(void) { return Wave_Speed; }
@@ -961,6 +975,8 @@ inline void CConfig::SetKind_Deform_Linear_Solver_Prec(unsigned short val_kind_p
 
 inline unsigned short CConfig::GetKind_Linear_Solver_Prec(void) { return Kind_Linear_Solver_Prec; }
 
+inline unsigned short CConfig::GetKind_Linear_Solver_Orthogonalization(void) { return Kind_Linear_Solver_Orthogonalization; }
+
 inline void CConfig::SetKind_Linear_Solver_Prec(unsigned short val_kind_prec) { Kind_Linear_Solver_Prec = val_kind_prec; }
 
 inline su2double CConfig::GetLinear_Solver_Error(void) { return Linear_Solver_Error; }
@@ -973,6 +989,20 @@ inline unsigned long CConfig::GetDeform_Linear_Solver_Iter(void) { return Deform
 
 inline unsigned short CConfig::GetLinear_Solver_ILU_n(void) { return Linear_Solver_ILU_n; }
 
+inline bool CConfig::GetLinear_Solver_Prec_Single(void) { return Linear_Solver_Prec_Single; }
+
+inline bool CConfig::GetLinear_Solver_Level_Scheduling(void) { return Linear_Solver_Level_Scheduling; }
+
+inline unsigned short CConfig::GetLinear_Solver_Recycle(void) { return Linear_Solver_Recycle; }
+
+inline unsigned long CConfig::GetLinear_Solver_Prec_Lag(void) { return Linear_Solver_Prec_Lag; }
+
+inline su2double CConfig::GetLinear_Solver_Prec_Lag_Degrade(void) { return Linear_Solver_Prec_Lag_Degrade; }
+
+inline bool CConfig::GetMatrixFree_Jacobian(void) { return MatrixFree_Jacobian; }
+
+inline su2double CConfig::GetMatrixFree_Step(void) { return MatrixFree_Step; }
+
 inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return Linear_Solver_Restart_Frequency; }
 
 inline su2double CConfig::GetRelaxation_Factor_Flow(void) { return Relaxation_Factor_Flow; }
@@ -1045,6 +1075,8 @@ inline bool CConfig::GetMUSCL(void) { return MUSCL; }
 
 inline bool CConfig::GetMUSCL_Flow(void) { return MUSCL_Flow; }
 
+inline bool CConfig::GetFlux_Batch_Flow(void) { return Flux_Batch_Flow; }
+
 inline bool CConfig::GetMUSCL_Turb(void) { return MUSCL_Turb; }
 
 inline bool CConfig::GetMUSCL_Heat(void) { return MUSCL_Heat; }
@@ -1237,6 +1269,8 @@ inline su2double CConfig::GetGeo_Waterline_Location(void) { return Geo_Waterline
 
 inline void CConfig::SetKind_TimeIntScheme(unsigned short val_kind_timeintscheme) { Kind_TimeNumScheme = val_kind_timeintscheme; }
 
+inline void CConfig::SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme) { Kind_TimeIntScheme_Flow = val_kind_timeintscheme; }
+
 inline unsigned short CConfig::GetKind_ObjFunc(void) { return Kind_ObjFunc[0]; }
 
 inline unsigned short CConfig::GetKind_ObjFunc(unsigned short val_obj) { return Kind_ObjFunc[val_obj]; }
@@ -1398,6 +1432,8 @@ inline string CConfig::GetMesh_Out_FileName(void) { return Mesh_Out_FileName; }
 
 inline unsigned short CConfig::GetMesh_FileFormat(void) { return Mesh_FileFormat; }
 
+inline unsigned short CConfig::GetMesh_Out_FileFormat(void) { return Mesh_Out_FileFormat; }
+
 inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFormat; }
 
 inline unsigned short CConfig::GetActDisk_Jump(void) { return ActDisk_Jump; }
@@ -173,6 +173,7 @@ private:
   unsigned long GlobalIndex;          /*!< \brief Global index in the parallel simulation. */
   unsigned short nNeighbor;           /*!< \brief Number of neighbors. */
   bool Flip_Orientation;              /*!< \brief Flip the orientation of the normal. */
+  bool Contiguous;                    /*!< \brief Coord and Volume live in the packed arrays of the geometry (not deleted with the point). */
 
 public:
 	
@@ -208,6 +209,14 @@ public:
 	 */
 	~CPoint(void);
 	
+	/*!
+	 * \brief Move the coordinates and the volume of the point to the packed arrays of the geometry.
+	 * \param[in] val_coord - Slot of the point in the packed coordinates (nDim values).
+	 * \param[in] val_volume - Slot of the point in the packed volumes.
+	 * \param[in] val_nVolume - Number of volumes stored per point (1, or 3 for unsteady problems).
+	 */
+	void SetStorage(su2double *val_coord, su2double *val_volume, unsigned short val_nVolume);
+	
 	/*! 
 	 * \brief For parallel computation, its indicates if a point must be computed or not.
 	 * \param[in] val_domain - <code>TRUE</code> if the point belong to the domain; otherwise <code>FALSE</code>.
@@ -515,6 +524,18 @@ public:
 	 */
 	void SetVolume_nM1(void);
 	
+	/*! 
+	 * \brief Set the volume of the control volume at time n.
+	 * \param[in] val_Volume - Value of the volume.
+	 */
+	void SetVolume_n(su2double val_Volume);
+	
+	/*! 
+	 * \brief Set the volume of the control volume at time n-1.
+	 * \param[in] val_Volume - Value of the volume.
+	 */
+	void SetVolume_nM1(su2double val_Volume);
+	
   /*! 
 	 * \brief Get the coordinates of the control volume at time n.
 	 * \return Coordinates of the control volume at time n.
@@ -763,6 +784,7 @@ private:
 	su2double *Coord_CG;			/*!< \brief Center-of-gravity of the element. */
 	unsigned long *Nodes;		/*!< \brief Vector to store the global nodes of an element. */
 	su2double *Normal;				/*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
+	bool Contiguous;				/*!< \brief Nodes and Normal live in the packed arrays of the geometry (not deleted with the edge). */
 
 public:
 		
@@ -779,6 +801,13 @@ public:
 	 */
 	~CEdge(void);
 	
+	/*!
+	 * \brief Move the nodes and the normal of the edge to the packed arrays of the geometry.
+	 * \param[in] val_nodes - Slot of the edge in the packed node pairs (2 values).
+	 * \param[in] val_normal - Slot of the edge in the packed normals (nDim values).
+	 */
+	void SetStorage(unsigned long *val_nodes, su2double *val_normal);
+	
 	/*! 
 	 * \brief Set the center of gravity of the edge.
 	 * \param[in] val_coord - Coordinates of all the nodes needed for computing the centre of gravity of an edge.
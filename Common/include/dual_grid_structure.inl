@@ -168,6 +168,10 @@ inline void CPoint::SetVolume_n (void) { Volume[1] = Volume[0]; }
 
 inline void CPoint::SetVolume_nM1 (void) { Volume[2] = Volume[1]; }
 
+inline void CPoint::SetVolume_n (su2double val_Volume) { Volume[1] = val_Volume; }
+
+inline void CPoint::SetVolume_nM1 (su2double val_Volume) { Volume[2] = val_Volume; }
+
 inline su2double CPoint::GetVolume_n (void) { return Volume[1]; }
 
 inline su2double CPoint::GetVolume_nM1 (void) { return Volume[2]; }
@@ -126,6 +126,23 @@ public:
 	CPrimalGrid*** bound;	/*!< \brief Boundary vector (primal grid information). */
 	CPoint** node;			/*!< \brief Node vector (dual grid information). */
 	CEdge** edge;			/*!< \brief Edge vector (dual grid information). */
+	unsigned long *Edge_Nodes;	/*!< \brief Packed node pairs of the edges (nEdge x 2), shared with the CEdge objects. */
+	su2double *Edge_Normal;	/*!< \brief Packed normals of the edges (nEdge x nDim), shared with the CEdge objects. */
+	su2double *Point_Coord;	/*!< \brief Packed coordinates of the points (nPoint x nDim), shared with the CPoint objects. */
+	su2double *Point_Volume;	/*!< \brief Packed volumes of the points (nPoint x nPoint_Volume), shared with the CPoint objects. */
+	unsigned short nPoint_Volume;	/*!< \brief Number of volumes stored per point (1, or 3 for unsteady problems). */
+	su2double *Point_LSWeight;	/*!< \brief Least-squares gradient weights of the neighbors of the domain points (nDim per neighbor). */
+	unsigned long *Point_LSWeight_Begin;	/*!< \brief Position of the weights of each domain point in Point_LSWeight (nPointDomain+1). */
+	bool LSWeight_Valid;	/*!< \brief True if the least-squares weights match the current coordinates. */
+	unsigned long nEdge_Color;	/*!< \brief Number of colors of the edges. */
+	unsigned long *Edge_Color_Ptr;	/*!< \brief Position of the first edge of each color in Edge_Color_Edge (nEdge_Color+1). */
+	unsigned long *Edge_Color_Edge;	/*!< \brief Edges sorted by color, the edges of a color share no point. */
+	unsigned long *Edge_Color_Split;	/*!< \brief Position of the first edge of each color with a received halo point (nEdge_Color). */
+	unsigned short nHalo_Neighbor;	/*!< \brief Number of send/receive marker pairs of the halo exchange. */
+	int *Halo_Send_Rank, *Halo_Recv_Rank;	/*!< \brief Rank that each pair sends to and receives from. */
+	unsigned long *Halo_Send_Ptr, *Halo_Recv_Ptr;	/*!< \brief Position of the first point of each pair in the send/receive lists (nHalo_Neighbor+1). */
+	unsigned long *Halo_Send_Point, *Halo_Recv_Point;	/*!< \brief Points sent and received by the halo exchange, grouped by pair. */
+	su2double *Halo_Rotation;	/*!< \brief Periodic rotation matrix of each received point (3x3, row-major). */
 	CVertex*** vertex;		/*!< \brief Boundary Vertex vector (dual grid information). */
   CTurboVertex**** turbovertex; /*!< \brief Boundary Vertex vector ordered for turbomachinery calculation(dual grid information). */
   unsigned long *nVertex;	/*!< \brief Number of vertex for each marker. */
@@ -181,6 +198,7 @@ public:
 #ifdef HAVE_PARMETIS
   idx_t * adjacency;
   idx_t * xadj;
+  idx_t * adjwgt;
 #endif
 #endif
   
@@ -422,7 +440,7 @@ public:
 	 * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
 	 */
-	virtual void SetRCM_Ordering(CConfig *config);
+	virtual void SetPoint_Ordering(CConfig *config);
   
 	/*!
 	 * \brief A virtual member.
@@ -434,6 +452,170 @@ public:
 	 */
 	void SetEdges(void);
 
+	/*!
+	 * \brief Move the node pairs and normals of the edges, and the coordinates and volumes
+	 *        of the points, to packed arrays (the objects keep pointers to their slots).
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetPackedStorage(CConfig *config);
+
+	/*!
+	 * \brief Get a node of an edge from the packed edge table.
+	 * \param[in] val_edge - Index of the edge.
+	 * \param[in] val_node - 0 or 1.
+	 * \return Index of the point.
+	 */
+	unsigned long GetEdge_Node(unsigned long val_edge, unsigned short val_node);
+
+	/*!
+	 * \brief Get the normal of an edge from the packed edge table.
+	 * \param[in] val_edge - Index of the edge.
+	 * \return Pointer to the normal (nDim values).
+	 */
+	su2double *GetEdge_Normal(unsigned long val_edge);
+
+	/*!
+	 * \brief Get the coordinates of a point from the packed point table.
+	 * \param[in] val_point - Index of the point.
+	 * \return Pointer to the coordinates (nDim values).
+	 */
+	su2double *GetPoint_Coord(unsigned long val_point);
+
+	/*!
+	 * \brief Get the volume of a point from the packed point table.
+	 * \param[in] val_point - Index of the point.
+	 * \return Volume of the control volume.
+	 */
+	su2double GetPoint_Volume(unsigned long val_point);
+
+	/*!
+	 * \brief Compute the weights of the weighted least-squares gradient, the gradient at a
+	 *        domain point is the sum over its neighbors of weight*(U_j-U_i).
+	 */
+	void SetLSGradient_Weights(void);
+
+	/*!
+	 * \brief Get the least-squares gradient weight of a neighbor of a point.
+	 * \param[in] val_point - Index of the domain point.
+	 * \param[in] val_neigh - Index of the neighbor in the list of neighbors of the point.
+	 * \return Pointer to the weight (nDim values).
+	 */
+	su2double *GetLSGradient_Weight(unsigned long val_point, unsigned short val_neigh);
+
+	/*!
+	 * \brief Check if the least-squares gradient weights are up to date.
+	 * \return <code>FALSE</code> if the weights have to be (re)computed.
+	 */
+	bool GetLSGradient_Weights_Valid(void);
+
+	/*!
+	 * \brief Group the edges in colors such that the edges of a color share no point.
+	 * \param[in] val_coloring - If <code>FALSE</code>, all the edges are put in a single color in
+	 *            their natural order (serial edge loops).
+	 */
+	void SetEdge_Coloring(bool val_coloring = true);
+
+	/*!
+	 * \brief Get the number of colors of the edges.
+	 * \return Number of colors.
+	 */
+	unsigned long GetnEdge_Color(void);
+
+	/*!
+	 * \brief Get the position of the first edge of a color in the list of colored edges.
+	 * \param[in] val_color - Index of the color.
+	 * \return Position in the list (the color ends at the first position of the next color).
+	 */
+	unsigned long GetEdge_Color_Begin(unsigned long val_color);
+
+	/*!
+	 * \brief Get an edge from the list of edges sorted by color.
+	 * \param[in] val_position - Position in the list.
+	 * \return Index of the edge.
+	 */
+	unsigned long GetEdge_Color_Edge(unsigned long val_position);
+
+	/*!
+	 * \brief Order the edges of each color so that the edges with a point received by the halo
+	 *        exchange come last, the interior edges can then be computed while the exchange is in flight.
+	 */
+	void SetEdge_Color_Split(void);
+
+	/*!
+	 * \brief Get the position of the first edge of a color that has a point received by the halo exchange.
+	 * \param[in] val_color - Index of the color.
+	 * \return Position in the list (the interior edges of the color are before it).
+	 */
+	unsigned long GetEdge_Color_Split(unsigned long val_color);
+
+	/*!
+	 * \brief Build the send and receive lists of the halo exchange from the send/receive markers,
+	 *        grouped by marker pair, and the periodic rotation of each received point.
+	 * \param[in] config - Definition of the particular problem.
+	 */
+	void SetHalo_Pattern(CConfig *config);
+
+	/*!
+	 * \brief Get the number of send/receive marker pairs of the halo exchange.
+	 * \return Number of pairs.
+	 */
+	unsigned short GetnHalo_Neighbor(void);
+
+	/*!
+	 * \brief Check if the send and receive lists of the halo exchange have been built.
+	 * \return <code>TRUE</code> if SetHalo_Pattern has been called.
+	 */
+	bool GetHalo_Pattern_Valid(void);
+
+	/*!
+	 * \brief Get the rank a send/receive pair sends to.
+	 * \param[in] val_neighbor - Index of the pair.
+	 * \return Rank of the destination.
+	 */
+	int GetHalo_Send_Rank(unsigned short val_neighbor);
+
+	/*!
+	 * \brief Get the rank a send/receive pair receives from.
+	 * \param[in] val_neighbor - Index of the pair.
+	 * \return Rank of the source.
+	 */
+	int GetHalo_Recv_Rank(unsigned short val_neighbor);
+
+	/*!
+	 * \brief Get the position of the first sent point of a pair.
+	 * \param[in] val_neighbor - Index of the pair (nHalo_Neighbor gives the total number of sent points).
+	 * \return Position in the send list.
+	 */
+	unsigned long GetHalo_Send_Begin(unsigned short val_neighbor);
+
+	/*!
+	 * \brief Get the position of the first received point of a pair.
+	 * \param[in] val_neighbor - Index of the pair (nHalo_Neighbor gives the total number of received points).
+	 * \return Position in the receive list.
+	 */
+	unsigned long GetHalo_Recv_Begin(unsigned short val_neighbor);
+
+	/*!
+	 * \brief Get a point of the send list.
+	 * \param[in] val_position - Position in the send list.
+	 * \return Index of the point.
+	 */
+	unsigned long GetHalo_Send_Point(unsigned long val_position);
+
+	/*!
+	 * \brief Get a point of the receive list.
+	 * \param[in] val_position - Position in the receive list.
+	 * \return Index of the point.
+	 */
+	unsigned long GetHalo_Recv_Point(unsigned long val_position);
+
+	/*!
+	 * \brief Get the periodic rotation of a point of the receive list.
+	 * \param[in] val_position - Position in the receive list.
+	 * \return Rotation matrix (3x3, row-major), rot[i][j] multiplies the j-th received component.
+	 */
+	su2double *GetHalo_Rotation(unsigned long val_position);
+
 	/*! 
 	 * \brief A virtual member.
 	 */
@@ -576,6 +758,35 @@ public:
    */
   virtual void SetColorGrid_Parallel(CConfig *config);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_time - Time spent in the space integration by this rank.
+   */
+  virtual void Write_Partition_Cost(CConfig *config, su2double val_time);
+  
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_state - State of the local points, val_nState values per point.
+   * \param[in] val_nState - Number of values per point.
+   * \param[out] val_nPoint_Global - Number of global indices of the grid.
+   * \param[out] val_linear - State of the points of the linear partition of this rank.
+   */
+  virtual void CollectLinear_State(CConfig *config, su2double *val_state, unsigned short val_nState,
+                                   unsigned long &val_nPoint_Global, vector<su2double> &val_linear);
+  
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_linear - State of the points of the linear partition of this rank.
+   * \param[in] val_nState - Number of values per point.
+   * \param[in] val_nPoint_Global - Number of global indices of the grid.
+   * \param[out] val_state - State of the local points, val_nState values per point.
+   */
+  virtual void DistributeLinear_State(CConfig *config, vector<su2double> &val_linear, unsigned short val_nState,
+                                      unsigned long val_nPoint_Global, su2double *val_state);
+  
   /*!
 	 * \brief A virtual member.
 	 * \param[in] config - Definition of the particular problem.
@@ -1588,6 +1799,78 @@ public:
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
 
+  /*!
+   * \brief Reads the geometry of a binary SU2 grid in parallel: each rank reads the coordinates of its
+   *        linear partition and a slab of the elements, which are then sent to the ranks that need them.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Reads the geometry of an ASCII SU2 grid in parallel from a memory map of the file: the sections are
+   *        located once by the master, and each rank parses an even byte range of the points and the elements.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_iZone - Domain to be read from the grid file.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   * \return <code>TRUE</code> if the grid was read; <code>FALSE</code> if the file could not be mapped.
+   */
+  bool Read_SU2_Format_Mapped(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
+
+  /*!
+   * \brief Send each element of a slab to the ranks of the linear partition that own one of its nodes, store the
+   *        local elements and build the adjacency for ParMETIS.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Elem_Buf - Records of the slab (VTK type and nodes of each element, padded to <i>Elem_Width</i>).
+   * \param[in] nElem_Slab - Number of elements in the slab.
+   * \param[in] Elem_Begin - Global index of the first element of the slab.
+   * \param[in] Elem_Width - Width of the records.
+   */
+  void Distribute_Elements_Linear(CConfig *config, unsigned long *Elem_Buf, unsigned long nElem_Slab,
+                                  unsigned long Elem_Begin, unsigned long Elem_Width);
+
+  /*!
+   * \brief Create the boundary markers and the periodic transformations from data known by all the ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Marker_Tags - Tag of each marker, <i>MAX_STRING_SIZE</i> characters per marker.
+   * \param[in] Marker_Info - Number of elements, width of the records and SEND_TO of each marker.
+   * \param[in] Marker_Conn - Records of the boundary elements of all the markers.
+   * \param[in] Periodic_Data - Center, rotation and translation of each periodic transformation.
+   */
+  void Set_Markers_Linear(CConfig *config, vector<char> &Marker_Tags, vector<long> &Marker_Info,
+                          vector<unsigned long> &Marker_Conn, vector<passivedouble> &Periodic_Data);
+
+  /*!
+   * \brief Find a keyword in a range of the memory map of an ASCII grid file.
+   * \param[in] val_buffer - Memory map of the file.
+   * \param[in] val_begin - First byte of the range.
+   * \param[in] val_end - End of the range.
+   * \param[in] val_keyword - Keyword to find.
+   * \return Offset of the keyword, or <i>val_end</i> if it is not in the range.
+   */
+  unsigned long Find_Mesh_Keyword(const char *val_buffer, unsigned long val_begin, unsigned long val_end, const char *val_keyword);
+
+  /*!
+   * \brief Parse an unsigned integer of an ASCII grid file.
+   * \param[in] val_begin - First character to read.
+   * \param[in] val_end - End of the buffer.
+   * \param[out] val_number - Number that was read.
+   * \return Character after the number, or <i>NULL</i> if there was no number before the end of the line.
+   */
+  const char* Parse_Mesh_ULong(const char *val_begin, const char *val_end, unsigned long &val_number);
+
+  /*!
+   * \brief Parse a floating point number of an ASCII grid file.
+   * \param[in] val_begin - First character to read.
+   * \param[in] val_end - End of the buffer.
+   * \param[out] val_number - Number that was read.
+   * \return Character after the number, or <i>NULL</i> if there was no number before the end of the line.
+   */
+  const char* Parse_Mesh_Double(const char *val_begin, const char *val_end, passivedouble &val_number);
+
   /*!
    * \brief Reads the geometry of the grid and adjust the boundary
    *        conditions with the configuration file in parallel (for parmetis).
@@ -1628,10 +1911,22 @@ public:
 	void SetPoint_Connectivity(void);
   
   /*!
-	 * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm
+	 * \brief Renumber the points (Reverse Cuthill-McKee or Hilbert curve) and their connectivities.
    * \param[in] config - Definition of the particular problem.
 	 */
-	void SetRCM_Ordering(CConfig *config);
+	void SetPoint_Ordering(CConfig *config);
+  
+  /*!
+	 * \brief Compute a renumbering using a Reverse Cuthill-McKee Algorithm
+   * \param[out] Result - Old index of the point at each new position.
+	 */
+	void SetRCM_Ordering(vector<unsigned long> &Result);
+  
+  /*!
+	 * \brief Compute a renumbering along a Hilbert space-filling curve through the point coordinates.
+   * \param[out] Result - Old index of the point at each new position.
+	 */
+	void SetHilbert_Ordering(vector<unsigned long> &Result);
   
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
@@ -1779,6 +2074,44 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
    */
   void SetColorGrid_Parallel(CConfig *config);
   
+  /*!
+   * \brief Check if the points of a marker are heavier than the interior ones for the partitioning.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_marker - Index of the marker.
+   * \return <code>TRUE</code> for walls with heat transfer, actuator disks, engines and interfaces.
+   */
+  bool GetPartition_Heavy_Marker(CConfig *config, unsigned short val_marker);
+  
+  /*!
+   * \brief Write the correction of the partition weights measured in this run, read by SetColorGrid_Parallel.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_time - Time spent in the space integration by this rank.
+   */
+  void Write_Partition_Cost(CConfig *config, su2double val_time);
+  
+  /*!
+   * \brief Send the state of the local points to the ranks that hold their global index in a linear
+   *        partitioning, so that it survives the deletion of this partition (dynamic load balancing).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_state - State of the local points, val_nState values per point.
+   * \param[in] val_nState - Number of values per point.
+   * \param[out] val_nPoint_Global - Number of global indices of the grid.
+   * \param[out] val_linear - Flag (0 missing, 1 from a halo, 2 from the owner) and state of the points of the linear partition of this rank.
+   */
+  void CollectLinear_State(CConfig *config, su2double *val_state, unsigned short val_nState,
+                           unsigned long &val_nPoint_Global, vector<su2double> &val_linear);
+  
+  /*!
+   * \brief Retrieve the state of the local points (domain and halos) of a new partition from the linear partitioning.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_linear - Flag and state of the points of the linear partition of this rank, from CollectLinear_State.
+   * \param[in] val_nState - Number of values per point.
+   * \param[in] val_nPoint_Global - Number of global indices of the grid.
+   * \param[out] val_state - State of the local points, val_nState values per point.
+   */
+  void DistributeLinear_State(CConfig *config, vector<su2double> &val_linear, unsigned short val_nState,
+                              unsigned long val_nPoint_Global, su2double *val_state);
+  
   /*!
    * \brief Set the rotational velocity at each node.
    * \param[in] config - Definition of the particular problem.
@@ -1843,6 +2176,13 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
 	 */	
 	void SetMeshFile(CConfig *config, string val_mesh_out_filename);
 
+	/*! 
+	 * \brief Write the binary .su2 file.
+	 * \param[in] config - Definition of the particular problem.
+	 * \param[in] val_mesh_out_filename - Name of the output file.
+	 */	
+	void SetMeshFile_Binary(CConfig *config, string val_mesh_out_filename);
+
 	/*! 
 	 * \brief Compute some parameters about the grid quality.
 	 * \param[out] statistics - Information about the grid quality, statistics[0] = (r/R)_min, statistics[1] = (r/R)_ave.		 
@@ -2652,4 +2992,70 @@ public:
 
 };
 
+/*!
+ * \class CHaloExchange
+ * \brief Exchange of a point field over the halo pattern of a geometry (see CGeometry::SetHalo_Pattern).
+ * \note The buffers hold val_nCount values per point, in the order of the send/receive lists.
+ *       With MPI the messages of all the pairs are in flight at the same time, on persistent
+ *       requests that are set up once (plain non-blocking requests with AD types).
+ */
+class CHaloExchange {
+  CGeometry *geometry;	/*!< \brief Geometry that defines the send/receive lists. */
+  unsigned short nCount;	/*!< \brief Number of values per point. */
+  su2double *Buffer_Send, *Buffer_Recv;	/*!< \brief Send and receive buffers. */
+  int nRequest;	/*!< \brief Number of requests (receives first, then sends). */
+  SU2_MPI::Request *Request;	/*!< \brief Requests of the receives and the sends. */
+  SU2_MPI::Status *Request_Status;	/*!< \brief Status of each request. */
+  bool Persistent;	/*!< \brief True if the requests are persistent. */
+  bool Active;	/*!< \brief True between Start() and Complete(). */
+  
+  /*!
+   * \brief Post the receives and the sends of all the pairs.
+   * \param[in] val_init - If <code>TRUE</code>, set up the persistent requests instead.
+   */
+  void PostRequests(bool val_init);
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_geometry - Geometry that defines the send/receive lists.
+   * \param[in] val_nCount - Number of values per point.
+   */
+  CHaloExchange(CGeometry *val_geometry, unsigned short val_nCount);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CHaloExchange(void);
+  
+  /*!
+   * \brief Get the send buffer, to be filled before Start().
+   * \return Pointer to the buffer (val_nCount values per point of the send list).
+   */
+  su2double *GetBuffer_Send(void);
+  
+  /*!
+   * \brief Get the receive buffer, valid after Complete().
+   * \return Pointer to the buffer (val_nCount values per point of the receive list).
+   */
+  su2double *GetBuffer_Recv(void);
+  
+  /*!
+   * \brief Get the number of values per point.
+   * \return Number of values.
+   */
+  unsigned short GetnCount(void);
+  
+  /*!
+   * \brief Start the exchange of the send buffer with all the pairs.
+   */
+  void Start(void);
+  
+  /*!
+   * \brief Wait for the exchange started by Start() to finish.
+   */
+  void Complete(void);
+};
+
 #include "geometry_structure.inl"
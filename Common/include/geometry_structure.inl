@@ -87,6 +87,14 @@ inline void CGeometry::SetColorGrid(CConfig *config) { }
 
 inline void CGeometry::SetColorGrid_Parallel(CConfig *config) { }
 
+inline void CGeometry::Write_Partition_Cost(CConfig *config, su2double val_time) { }
+
+inline void CGeometry::CollectLinear_State(CConfig *config, su2double *val_state, unsigned short val_nState,
+                                           unsigned long &val_nPoint_Global, vector<su2double> &val_linear) { }
+
+inline void CGeometry::DistributeLinear_State(CConfig *config, vector<su2double> &val_linear, unsigned short val_nState,
+                                              unsigned long val_nPoint_Global, su2double *val_state) { }
+
 inline void CGeometry::DivideConnectivity(CConfig *config, unsigned short Elem_Type) { }
 
 inline void CGeometry::SetRotationalVelocity(CConfig *config, unsigned short val_iZone, bool print) { }
@@ -119,7 +127,7 @@ inline void CGeometry::SetPositive_ZArea(CConfig *config) { }
 
 inline void CGeometry::SetPoint_Connectivity(void) { }
 
-inline void CGeometry::SetRCM_Ordering(CConfig *config) { }
+inline void CGeometry::SetPoint_Ordering(CConfig *config) { }
 
 inline void CGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) { }
 
@@ -183,6 +191,44 @@ inline void CGeometry::SetnVertexSpanMax(unsigned short marker_flag, unsigned lo
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned long CGeometry::GetEdge_Node(unsigned long val_edge, unsigned short val_node) { return Edge_Nodes[2*val_edge+val_node]; }
+
+inline su2double *CGeometry::GetEdge_Normal(unsigned long val_edge) { return &Edge_Normal[val_edge*nDim]; }
+
+inline su2double *CGeometry::GetPoint_Coord(unsigned long val_point) { return &Point_Coord[val_point*nDim]; }
+
+inline su2double CGeometry::GetPoint_Volume(unsigned long val_point) { return Point_Volume[val_point*nPoint_Volume]; }
+
+inline su2double *CGeometry::GetLSGradient_Weight(unsigned long val_point, unsigned short val_neigh) { return &Point_LSWeight[(Point_LSWeight_Begin[val_point]+val_neigh)*nDim]; }
+
+inline bool CGeometry::GetLSGradient_Weights_Valid(void) { return LSWeight_Valid; }
+
+inline unsigned long CGeometry::GetnEdge_Color(void) { return nEdge_Color; }
+
+inline unsigned long CGeometry::GetEdge_Color_Begin(unsigned long val_color) { return Edge_Color_Ptr[val_color]; }
+
+inline unsigned long CGeometry::GetEdge_Color_Edge(unsigned long val_position) { return Edge_Color_Edge[val_position]; }
+
+inline unsigned long CGeometry::GetEdge_Color_Split(unsigned long val_color) { return Edge_Color_Split[val_color]; }
+
+inline unsigned short CGeometry::GetnHalo_Neighbor(void) { return nHalo_Neighbor; }
+
+inline bool CGeometry::GetHalo_Pattern_Valid(void) { return (Halo_Send_Ptr != NULL); }
+
+inline int CGeometry::GetHalo_Send_Rank(unsigned short val_neighbor) { return Halo_Send_Rank[val_neighbor]; }
+
+inline int CGeometry::GetHalo_Recv_Rank(unsigned short val_neighbor) { return Halo_Recv_Rank[val_neighbor]; }
+
+inline unsigned long CGeometry::GetHalo_Send_Begin(unsigned short val_neighbor) { return Halo_Send_Ptr[val_neighbor]; }
+
+inline unsigned long CGeometry::GetHalo_Recv_Begin(unsigned short val_neighbor) { return Halo_Recv_Ptr[val_neighbor]; }
+
+inline unsigned long CGeometry::GetHalo_Send_Point(unsigned long val_position) { return Halo_Send_Point[val_position]; }
+
+inline unsigned long CGeometry::GetHalo_Recv_Point(unsigned long val_position) { return Halo_Recv_Point[val_position]; }
+
+inline su2double *CGeometry::GetHalo_Rotation(unsigned long val_position) { return &Halo_Rotation[val_position*9]; }
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -491,3 +537,9 @@ inline su2double CPhysicalGeometry::GetMaxAngularCoord(unsigned short val_marker
 inline su2double CPhysicalGeometry::GetMinRelAngularCoord(unsigned short val_marker, unsigned short val_span){return MinRelAngularCoord[val_marker][val_span];}
 
 inline void CGeometry::Check_Periodicity(CConfig* config) {}
+
+inline su2double *CHaloExchange::GetBuffer_Send(void) { return Buffer_Send; }
+
+inline su2double *CHaloExchange::GetBuffer_Recv(void) { return Buffer_Recv; }
+
+inline unsigned short CHaloExchange::GetnCount(void) { return nCount; }
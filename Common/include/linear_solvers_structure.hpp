@@ -71,6 +71,17 @@ class CSysSolve {
   
 private:
   
+  unsigned short Kind_Orthogonalization;  /*!< \brief Orthogonalization of the Krylov basis of FGMRES (MGS or CGS). */
+  CMatrixVectorProduct *MatrixFree_Product;  /*!< \brief External (matrix-free) product used by Solve instead of the Jacobian, not owned. */
+  unsigned short nRecycle;                   /*!< \brief Maximum number of directions recycled between calls of FGCRO_LinSolver. */
+  vector<CSysVector> Recycle_U;              /*!< \brief Recycled directions, kept between calls. */
+  vector<CSysVector> Recycle_C;              /*!< \brief Orthonormal images of the recycled directions, A*U = C. */
+  unsigned long Prec_Age;                    /*!< \brief Number of solves since the last rebuild of the preconditioner (0 if never built). */
+  su2double Prec_IterPerDecade;              /*!< \brief Linear iterations per decade of residual reduction just after the last rebuild. */
+  bool Prec_Degraded;                        /*!< \brief The lagged preconditioner was found stale by the last solve. */
+  bool Prec_Rebuilt;                         /*!< \brief The preconditioner was rebuilt by the last solve. */
+  su2double Prec_BuildTime;                  /*!< \brief Wall time (s) spent building the preconditioner in the last solve. */
+  
   /*!
    * \brief sign transfer function
    * \param[in] x - value having sign prescribed
@@ -82,6 +93,29 @@ private:
    */
   su2double Sign(const su2double & x, const su2double & y) const;
   
+  /*!
+   * \brief Decide whether the preconditioner must be rebuilt or if the one of a previous solve can be reused.
+   * \param[in] lagged - The preconditioner can be lagged (JACOBI and ILU, stored apart from the Jacobian).
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> if the preconditioner has to be rebuilt before the solve.
+   */
+  bool RebuildPreconditioner(bool lagged, CConfig *config);
+  
+  /*!
+   * \brief Track the convergence rate of the linear solver to detect a stale (lagged) preconditioner.
+   * \param[in] norm_b - Norm of the right hand side (initial residual).
+   * \param[in] residual - Final residual of the solve.
+   * \param[in] iter - Number of linear iterations of the solve.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void UpdatePreconditionerAge(su2double norm_b, su2double residual, unsigned long iter, CConfig *config);
+  
+  /*!
+   * \brief Wall clock used to measure the cost of the preconditioner.
+   * \return Time in seconds.
+   */
+  su2double WallTime(void) const;
+  
   /*!
    * \brief applys a Givens rotation to a 2-vector
    * \param[in] s - sine of the Givens rotation angle
@@ -137,6 +171,47 @@ private:
    */
   void ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w);
   
+  /*!
+   * \brief Local (per rank) inner products needed by the classical Gram-Schmidt orthogonalization
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in] w - the Krylov basis
+   * \param[out] prod - (w[k], w[i+1]) for k = 0..i, followed by (w[i+1], w[i+1])
+   */
+  void GramSchmidtProducts(int i, const vector<CSysVector> & w, vector<su2double> & prod);
+  
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with reorthogonalization
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in, out] Hsbg - the upper Hessenberg begin updated
+   * \param[in, out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   * \param[in] prod - globally reduced products of GramSchmidtProducts for w[i+1]
+   * \param[in, out] z - if not NULL, z[i+1] receives the same linear combination as w[i+1]
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * All the inner products of a pass are computed in a single global reduction, the norm
+   * of the new vector is obtained from them (Pythagoras). A second pass is performed if
+   * the norm dropped below 1/sqrt(2) of the original one ("twice is enough").
+   */
+  void ClassicalGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w,
+                            const vector<su2double> & prod, vector<CSysVector> *z);
+  
+  /*!
+   * \brief Start the (non-blocking) global sum of a set of local values
+   * \param[in] local - local values, must not be modified before FinishReduction
+   * \param[out] global - global sums, only valid after FinishReduction
+   * \param[out] request - handle of the reduction
+   */
+  void StartReduction(vector<su2double> & local, vector<su2double> & global, SU2_MPI::Request *request);
+  
+  /*!
+   * \brief Wait for the completion of a global sum started with StartReduction
+   * \param[in, out] request - handle of the reduction
+   */
+  void FinishReduction(SU2_MPI::Request *request);
+  
   /*!
    * \brief writes header information for a CSysSolve residual history
    * \param[in] solver - string describing the solver
@@ -159,6 +234,41 @@ private:
   
 public:
   
+  /*!
+   * \brief Constructor of the class.
+   */
+  CSysSolve(void);
+  
+  /*!
+   * \brief Set the orthogonalization of the Krylov basis of FGMRES.
+   * \param[in] val_kind - MODIFIED_GRAM_SCHMIDT or CLASSICAL_GRAM_SCHMIDT.
+   */
+  void SetKind_Orthogonalization(unsigned short val_kind);
+  
+  /*!
+   * \brief Set an external matrix-vector product to be used by Solve instead of the Jacobian.
+   * \param[in] val_product - Matrix-free product (the Jacobian is then only used to build the preconditioner), NULL to use the Jacobian.
+   */
+  void SetMatrixFreeProduct(CMatrixVectorProduct *val_product);
+  
+  /*!
+   * \brief Set the maximum number of directions recycled between calls of FGCRO_LinSolver (0 disables recycling).
+   * \param[in] val_nRecycle - Maximum size of the recycled subspace.
+   */
+  void SetnRecycle(unsigned short val_nRecycle);
+  
+  /*!
+   * \brief Get whether the preconditioner was rebuilt by the last call of Solve.
+   * \return <code>TRUE</code> if it was rebuilt; <code>FALSE</code> if a lagged preconditioner was reused.
+   */
+  bool GetPrec_Rebuilt(void);
+  
+  /*!
+   * \brief Get the wall time spent building the preconditioner in the last call of Solve.
+   * \return Time in seconds, 0 if the preconditioner was reused.
+   */
+  su2double GetPrec_BuildTime(void);
+  
   /*! \brief Conjugate Gradient method
    * \param[in] b - the right hand size vector
    * \param[in, out] x - on entry the intial guess, on exit the solution
@@ -202,6 +312,65 @@ public:
                         CPreconditioner & precond, su2double tol,
                         unsigned long m, su2double *residual, bool monitoring);
   
+  /*!
+   * \brief Flexible GMRES augmented with a subspace recycled between calls (GCRO)
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * The recycled directions U are the corrections of the previous calls. Their images
+   * C = A*U are recomputed (the operator changes between calls) and orthonormalized,
+   * the initial residual is projected out of span(C) and the Arnoldi vectors are kept
+   * orthogonal to C, i.e. FGMRES is applied to (I - C*C^T)*A.
+   */
+  unsigned long FGCRO_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                CPreconditioner & precond, su2double tol,
+                                unsigned long m, su2double *residual, bool monitoring);
+  
+  /*!
+   * \brief Pipelined Flexible Generalized Minimal Residual method
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * The basis is orthogonalized with classical Gram-Schmidt (one global reduction per
+   * iteration) and the preconditioner is applied to the new vector while the reduction
+   * is in flight, the preconditioned basis is then updated by linearity.
+   */
+  unsigned long PipelinedFGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                          CPreconditioner & precond, su2double tol,
+                                          unsigned long m, su2double *residual, bool monitoring);
+  
+  /*!
+   * \brief Pipelined Biconjugate Gradient Stabilized Method
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - maximum size of the search subspace
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * Preconditioned p-BiCGStab of Cools and Vanroose (Parallel Computing, 2017). The two global
+   * reductions of each iteration are overlapped with a preconditioner application and a
+   * matrix-vector product, at the cost of more vectors and axpy operations. The preconditioner
+   * must be a fixed linear operator.
+   */
+  unsigned long PipelinedBCGSTAB_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                           CPreconditioner & precond, su2double tol,
+                                           unsigned long m, su2double *residual, bool monitoring);
+  
   /*!
    * \brief Solve the linear system using a Krylov subspace method
    * \param[in] Jacobian - Jacobian Matrix for the linear system
@@ -37,6 +37,35 @@
 
 #pragma once
 
+inline CSysSolve::CSysSolve(void) {
+  Kind_Orthogonalization = MODIFIED_GRAM_SCHMIDT;
+  MatrixFree_Product = NULL;
+  nRecycle = 0;
+  Prec_Age = 0;
+  Prec_IterPerDecade = 0.0;
+  Prec_Degraded = false;
+  Prec_Rebuilt = false;
+  Prec_BuildTime = 0.0;
+}
+
+inline void CSysSolve::SetKind_Orthogonalization(unsigned short val_kind) { Kind_Orthogonalization = val_kind; }
+
+inline void CSysSolve::SetMatrixFreeProduct(CMatrixVectorProduct *val_product) { MatrixFree_Product = val_product; }
+
+inline void CSysSolve::SetnRecycle(unsigned short val_nRecycle) { nRecycle = val_nRecycle; }
+
+inline bool CSysSolve::GetPrec_Rebuilt(void) { return Prec_Rebuilt; }
+
+inline su2double CSysSolve::GetPrec_BuildTime(void) { return Prec_BuildTime; }
+
+inline su2double CSysSolve::WallTime(void) const {
+#ifndef HAVE_MPI
+  return su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  return MPI_Wtime();
+#endif
+}
+
 inline su2double CSysSolve::Sign(const su2double & x, const su2double & y) const {
   if (y == 0.0)
     return 0.0;
@@ -52,6 +52,90 @@ using namespace std;
 
 const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief machine epsilon */
 
+/*--- Storage type of the ILU factors in single precision mode (LINEAR_SOLVER_PREC_SINGLE).
+ The AD types cannot be truncated, in those builds the factors keep the working precision. ---*/
+
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+typedef su2double su2mixedfloat;
+#else
+typedef float su2mixedfloat;
+#endif
+
+const unsigned short AMG_MAX_LEVELS = 20;    /*!< \brief Maximum number of levels of the AMG preconditioner. */
+const unsigned long AMG_COARSE_SIZE = 100;   /*!< \brief Number of block rows below which no coarser AMG level is created. */
+const unsigned long AMG_DIRECT_SIZE = 1000;  /*!< \brief Maximum number of unknowns of the coarsest AMG level for the direct solve. */
+const unsigned short AMG_COARSE_SWEEPS = 10; /*!< \brief Smoothing sweeps on the coarsest AMG level when it is too large for the direct solve. */
+const su2double AMG_STRENGTH = 0.08;         /*!< \brief Threshold of the strength of connection used by the aggregation. */
+
+/*!
+ * \class CAMGLevel
+ * \brief Block sparse operator, transfer operators and work vectors of one level
+ *        of the algebraic multigrid preconditioner of CSysMatrix.
+ *
+ * The operator is stored in the same block CSR format as CSysMatrix, the finest
+ * level points to the arrays of the matrix it was built from (owner = false).
+ */
+class CAMGLevel {
+public:
+  unsigned long nBlk,           /*!< \brief Number of block rows (and columns) of the level. */
+  nnz;                          /*!< \brief Number of blocks of the operator. */
+  unsigned long *row_ptr,       /*!< \brief Pointers to the first block of each row. */
+  *col_ind,                     /*!< \brief Column index of each block. */
+  *dia_ptr;                     /*!< \brief Pointers to the diagonal block of each row. */
+  su2double *matrix;            /*!< \brief Blocks of the operator. */
+  bool owner;                   /*!< \brief The level allocated (and deletes) the arrays of the operator. */
+  su2double *invD;              /*!< \brief Inverse of the diagonal blocks, used by the smoother. */
+  unsigned long *P_row_ptr,     /*!< \brief Prolongation from the next coarser level, pointers to the first block of each row. */
+  *P_col_ind;                   /*!< \brief Prolongation from the next coarser level, column index of each block. */
+  su2double *P_val;             /*!< \brief Prolongation from the next coarser level, blocks. */
+  unsigned long *R_row_ptr,     /*!< \brief Restriction to the next coarser level (R = P^T), pointers to the first block of each row. */
+  *R_col_ind;                   /*!< \brief Restriction to the next coarser level (R = P^T), column index of each block. */
+  su2double *R_val;             /*!< \brief Restriction to the next coarser level (R = P^T), blocks. */
+  su2double *x,                 /*!< \brief Solution of the level. */
+  *b,                           /*!< \brief Right hand side of the level. */
+  *r;                           /*!< \brief Residual of the level. */
+  su2double *LU;                /*!< \brief Dense LU factors of the operator (coarsest level only). */
+  unsigned long *perm;          /*!< \brief Row permutation of the dense LU factors. */
+  
+  /*!
+   * \brief Constructor of the class.
+   */
+  CAMGLevel(void);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CAMGLevel(void);
+};
+
+/*!
+ * \class CLevelSchedule
+ * \brief Level sets (wavefronts) of a triangular sweep over the block rows of CSysMatrix.
+ *
+ * A row only depends on rows of lower levels, the rows of one level can be
+ * processed in parallel. Within a level the rows are in ascending order.
+ */
+class CLevelSchedule {
+public:
+  unsigned long nLevel,         /*!< \brief Number of levels. */
+  *level_ptr,                   /*!< \brief Pointers to the first row of each level. */
+  *point;                       /*!< \brief Rows of the sweep, grouped by level. */
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] nRow - Number of rows of the sweep (couplings with higher rows are ignored).
+   * \param[in] row_ptr - Pointers to the first block of each row.
+   * \param[in] col_ind - Column index of each block.
+   * \param[in] upper - Schedule of the backward sweep (upper triangle) instead of the forward one.
+   */
+  CLevelSchedule(unsigned long nRow, const unsigned long *row_ptr, const unsigned long *col_ind, bool upper);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CLevelSchedule(void);
+};
+
 
 /*!
  * \class CSysMatrix
@@ -69,13 +153,25 @@ private:
   nEqn;                   /*!< \brief Number of equations. */
   su2double *matrix;            /*!< \brief Entries of the sparse matrix. */
   su2double *ILU_matrix;         /*!< \brief Entries of the ILU sparse matrix. */
+  su2mixedfloat *ILU_matrix_float;   /*!< \brief Entries of the ILU sparse matrix, single precision storage. */
+  bool ilu_single;                   /*!< \brief Store the ILU factors in single precision. */
   unsigned long nnz;                 /*!< \brief Number of possible nonzero entries in the matrix. */
   unsigned long *row_ptr;            /*!< \brief Pointers to the first element in each row. */
   unsigned long *col_ind;            /*!< \brief Column index for each of the elements in val(). */
+  unsigned long *dia_ptr;            /*!< \brief Pointers to the diagonal element in each row. */
+  unsigned long nEdge;               /*!< \brief Number of edges in the edge-to-block map. */
+  unsigned long *edge_ptr;           /*!< \brief Pointers to the ij and ji off-diagonal blocks of each edge. */
   unsigned long nnz_ilu;             /*!< \brief Number of possible nonzero entries in the matrix (ILU). */
   unsigned long *row_ptr_ilu;        /*!< \brief Pointers to the first element in each row (ILU). */
   unsigned long *col_ind_ilu;        /*!< \brief Column index for each of the elements in val() (ILU). */
+  unsigned long *dia_ptr_ilu;        /*!< \brief Pointers to the diagonal element in each row (ILU). */
   unsigned short ilu_fill_in;        /*!< \brief Fill in level for the ILU preconditioner. */
+  bool level_scheduling;             /*!< \brief Level scheduled (parallel) sweeps of the ILU and LU_SGS preconditioners. */
+  CLevelSchedule *LowerSchedule,     /*!< \brief Levels of the forward LU_SGS sweep. */
+  *UpperSchedule,                    /*!< \brief Levels of the backward LU_SGS sweep. */
+  *LowerSchedule_ilu,                /*!< \brief Levels of the forward ILU sweep. */
+  *UpperSchedule_ilu;                /*!< \brief Levels of the backward ILU sweep. */
+  su2double *sweep_work;             /*!< \brief Work arrays of the threads in the level scheduled sweeps (2*nVar per thread). */
   
   su2double *block;             /*!< \brief Internal array to store a subblock of the matrix. */
   su2double *block_inverse;             /*!< \brief Internal array to store a subblock of the matrix. */
@@ -93,7 +189,257 @@ private:
   **yVector, **zVector, **rVector, *LFBlock,
   *LyVector, *FzVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
   unsigned long max_nElem;
+
+  unsigned short nAMGLevel;     /*!< \brief Number of levels of the AMG preconditioner. */
+  CAMGLevel **AMGLevel;         /*!< \brief Levels of the AMG preconditioner, level 0 is this matrix. */
+
+  /*--- Small dense block kernels, and the sparse sweeps built on top of them,
+   specialized for the block size. They are selected once in SetIndexes. ---*/
+
+  void (*MatVecKernel)(unsigned long, const su2double*, const su2double*, su2double*);  /*!< \brief Block-vector product. */
+  void (*MatMatKernel)(unsigned long, const su2double*, const su2double*, su2double*);  /*!< \brief Block-block product. */
+  void (*GaussKernel)(unsigned long, su2double*, su2double*);                           /*!< \brief In place Gauss elimination of a block. */
+  void (CSysMatrix::*SpMVKernel)(const CSysVector&, CSysVector&);            /*!< \brief Sparse matrix-vector product. */
+  void (CSysMatrix::*JacobiKernel)(const CSysVector&, CSysVector&);          /*!< \brief Application of the Jacobi preconditioner. */
+  void (CSysMatrix::*ILUSweepKernel)(CSysVector&);                           /*!< \brief Forward and backward ILU sweeps. */
+  void (CSysMatrix::*LU_SGSForwardKernel)(const CSysVector&, CSysVector&);   /*!< \brief Forward LU_SGS sweep. */
+  void (CSysMatrix::*LU_SGSBackwardKernel)(CSysVector&);                     /*!< \brief Backward LU_SGS sweep. */
+
+  /*!
+   * \brief Find the position of the block (i, j) in the sparse structure.
+   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
+   * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
+   * \return Index of the block in col_ind, or nnz if the block is not in the sparse pattern.
+   */
+  unsigned long GetBlockIndex(unsigned long block_i, unsigned long block_j) const;
+
+  /*!
+   * \brief Build the diagonal and edge-to-block maps used by the fast assembly routines.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] EdgeConnect - There is (or not) an edge structure.
+   */
+  void SetBlockMaps(CGeometry *geometry, bool EdgeConnect);
+
+  /*!
+   * \brief Find the position of the block (i, j) in the sparse structure of the ILU factors.
+   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
+   * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
+   * \return Index of the block in col_ind_ilu, or nnz_ilu if the block is not in the sparse pattern.
+   */
+  unsigned long GetBlockIndex_ILUMatrix(unsigned long block_i, unsigned long block_j) const;
+
+  /*!
+   * \brief Allocate (and set to zero) the storage of the ILU factors, in double or single precision.
+   */
+  void SetILUMatrix(void);
+
+  /*!
+   * \brief Copy the matrix into the ILU storage and compute the factorization in place.
+   * \tparam ScalarType - Storage type of the factors, the arithmetic is done in su2double.
+   * \param[in,out] ilu - Storage of the ILU factors.
+   * \param[in] transposed - Factorize the transposed matrix.
+   */
+  template<class ScalarType>
+  void BuildILU_Factorization(ScalarType *ilu, bool transposed);
+
+  /*!
+   * \brief Select the block kernels for the current nVar and nEqn.
+   */
+  void SetBlockKernels(void);
+
+  /*!
+   * \brief Point all the kernels to the specialization for one block size.
+   * \tparam nBlk - Block size, 0 for the generic kernels (size known at run time).
+   */
+  template<unsigned short nBlk>
+  void SetBlockKernels_Size(void);
+
+  /*!
+   * \brief Block-vector product, product = matrix*vector.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \tparam MatrixType - Storage type of the block.
+   * \param[in] n - Run time block size (used if nBlk = 0).
+   */
+  template<unsigned short nBlk, class MatrixType>
+  static void BlockVectorProduct(unsigned long n, const MatrixType *matrix, const su2double *vector, su2double *product);
+
+  /*!
+   * \brief Block-block product, product = matrix_a*matrix_b.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \param[in] n - Run time block size (used if nBlk = 0).
+   */
+  template<unsigned short nBlk>
+  static void BlockBlockProduct(unsigned long n, const su2double *matrix_a, const su2double *matrix_b, su2double *product);
+
+  /*!
+   * \brief Solve Block*x = rhs by Gauss elimination, Block is overwritten.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \param[in] n - Run time block size (used if nBlk = 0).
+   * \param[in,out] Block - Copy of the block, overwritten by the elimination.
+   * \param[in,out] rhs - Right hand side on entry, solution on exit.
+   */
+  template<unsigned short nBlk>
+  static void BlockGaussElimination(unsigned long n, su2double *Block, su2double *rhs);
+
+  /*!
+   * \brief Sparse matrix-vector product over the domain rows (prod must be zero on entry).
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   */
+  template<unsigned short nBlk>
+  void MatrixVectorProduct_Sweep(const CSysVector & vec, CSysVector & prod);
+
+  /*!
+   * \brief Multiply each block of vec by the stored inverse of the diagonal.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   */
+  template<unsigned short nBlk>
+  void Jacobi_Sweep(const CSysVector & vec, CSysVector & prod);
+
+  /*!
+   * \brief Forward and backward substitution with the ILU factors, in place.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   */
+  template<unsigned short nBlk>
+  void ILU_Sweep(CSysVector & prod);
+
+  /*!
+   * \brief Forward and backward substitution with ILU factors of a given storage type.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \tparam ScalarType - Storage type of the factors.
+   */
+  template<unsigned short nBlk, class ScalarType>
+  void ILU_SweepFactors(const ScalarType *ilu, CSysVector & prod);
+
+  /*!
+   * \brief Forward substitution of one row with the ILU factors.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \tparam ScalarType - Storage type of the factors.
+   * \param[in] iPoint - Row.
+   * \param[in] aux - Work array of size nVar.
+   */
+  template<unsigned short nBlk, class ScalarType>
+  void ILU_ForwardRow(const ScalarType *ilu, unsigned long iPoint, CSysVector & prod, su2double *aux);
+
+  /*!
+   * \brief Backward substitution of one row with the ILU factors.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \tparam ScalarType - Storage type of the factors.
+   * \param[in] iPoint - Row.
+   * \param[in] aux, sum - Work arrays of size nVar.
+   */
+  template<unsigned short nBlk, class ScalarType>
+  void ILU_BackwardRow(const ScalarType *ilu, unsigned long iPoint, CSysVector & prod, su2double *aux, su2double *sum);
+
+  /*!
+   * \brief First sweep of LU_SGS, (D+L).prod = vec.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   */
+  template<unsigned short nBlk>
+  void LU_SGS_ForwardSweep(const CSysVector & vec, CSysVector & prod);
+
+  /*!
+   * \brief Second sweep of LU_SGS, prod = prod - inv(D).U.prod.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   */
+  template<unsigned short nBlk>
+  void LU_SGS_BackwardSweep(CSysVector & prod);
+
+  /*!
+   * \brief First sweep of LU_SGS for one row.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \param[in] iPoint - Row.
+   * \param[in] aux, sum - Work arrays of size nVar.
+   */
+  template<unsigned short nBlk>
+  void LU_SGS_ForwardRow(const CSysVector & vec, unsigned long iPoint, CSysVector & prod, su2double *aux, su2double *sum);
+
+  /*!
+   * \brief Second sweep of LU_SGS for one row.
+   * \tparam nBlk - Block size, 0 if only known at run time.
+   * \param[in] iPoint - Row.
+   * \param[in] aux, sum - Work arrays of size nVar.
+   */
+  template<unsigned short nBlk>
+  void LU_SGS_BackwardRow(unsigned long iPoint, CSysVector & prod, su2double *aux, su2double *sum);
+
+  /*!
+   * \brief Frobenius norm of a block.
+   * \param[in] val_block - Block.
+   * \return Norm of the block.
+   */
+  su2double BlockNorm(const su2double *val_block) const;
+
+  /*!
+   * \brief Delete the levels of the AMG preconditioner.
+   */
+  void DeleteAMGHierarchy(void);
+
+  /*!
+   * \brief Allocate the work vectors and invert the diagonal blocks of an AMG level.
+   * \param[in] level - AMG level.
+   */
+  void AMG_SetLevel(CAMGLevel *level);
+
+  /*!
+   * \brief Group the points of an AMG level in aggregates (smoothed aggregation).
+   * \param[in] level - AMG level.
+   * \param[out] agg - Aggregate of each point, negative if the point is not aggregated.
+   * \param[out] nAgg - Number of aggregates.
+   */
+  void AMG_Aggregate(const CAMGLevel *level, long *agg, unsigned long &nAgg);
+
+  /*!
+   * \brief Check if the domain part of the matrix is symmetric (A_ij = A_ji^T).
+   * \return <code>TRUE</code> if the matrix is symmetric; otherwise <code>FALSE</code>.
+   */
+  bool AMG_Symmetric(void);
   
+  /*!
+   * \brief Build the (smoothed) prolongation and the restriction of an AMG level.
+   * \param[in,out] level - AMG level.
+   * \param[in] agg - Aggregate of each point.
+   * \param[in] nAgg - Number of aggregates.
+   * \param[in] smooth - Smooth the tentative prolongation with a damped Jacobi step.
+   */
+  void AMG_Prolongation(CAMGLevel *level, const long *agg, unsigned long nAgg, bool smooth);
+
+  /*!
+   * \brief Product of two block sparse matrices, C = A.B.
+   * \param[in] nRow - Number of block rows of A.
+   * \param[in] nColA - Number of block columns of A, blocks in columns beyond it are ignored.
+   * \param[in] nColB - Number of block columns of B.
+   * \param[out] c_row_ptr, c_col_ind, c_val - Block CSR structure of C, allocated here.
+   */
+  void AMG_MatrixProduct(unsigned long nRow, unsigned long nColA,
+                         const unsigned long *a_row_ptr, const unsigned long *a_col_ind, const su2double *a_val,
+                         const unsigned long *b_row_ptr, const unsigned long *b_col_ind, const su2double *b_val,
+                         unsigned long nColB, unsigned long *&c_row_ptr, unsigned long *&c_col_ind, su2double *&c_val);
+
+  /*!
+   * \brief Dense LU factorization (partial pivoting) of the operator of the coarsest AMG level.
+   * \param[in,out] level - AMG level.
+   */
+  void AMG_CoarseFactorization(CAMGLevel *level);
+
+  /*!
+   * \brief Solve the coarsest AMG level with the dense LU factors, x = inv(A).b.
+   * \param[in,out] level - AMG level.
+   */
+  void AMG_CoarseSolve(CAMGLevel *level);
+
+  /*!
+   * \brief One block Gauss-Seidel sweep on an AMG level.
+   * \param[in,out] level - AMG level.
+   * \param[in] forward - Sweep the rows in increasing (true) or decreasing (false) order.
+   */
+  void AMG_Smooth(CAMGLevel *level, bool forward);
+
+  /*!
+   * \brief V-cycle on the AMG levels, from iLevel to the coarsest one (x = 0 on entry).
+   * \param[in] iLevel - AMG level.
+   */
+  void AMG_Cycle(unsigned short iLevel);
+
 public:
   
   /*!
@@ -189,38 +535,46 @@ public:
    * \param[in] **val_block - Block to subtract to A(i, j).
    */
   void SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block);
-  
+
   /*!
-   * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
-   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
+   * \brief Adds the specified block to the diagonal (i, i) block of the sparse matrix.
+   * \param[in] block_i - Index of the block in the matrix-by-blocks structure.
+   * \param[in] **val_block - Block to add to A(i, i).
    */
-  su2double *GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j);
-  
+  void AddBlock2Diag(unsigned long block_i, su2double **val_block);
+
   /*!
-   * \brief Set the value of a block in the sparse matrix.
-   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] **val_block - Block to set to A(i, j).
+   * \brief Subtracts the specified block from the diagonal (i, i) block of the sparse matrix.
+   * \param[in] block_i - Index of the block in the matrix-by-blocks structure.
+   * \param[in] **val_block - Block to subtract to A(i, i).
    */
-  void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
-  
-  
+  void SubtractBlock2Diag(unsigned long block_i, su2double **val_block);
+
   /*!
-   * \brief Set the transposed value of a block in the sparse matrix.
-   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] **val_block - Block to set to A(i, j).
-   */
-  void SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
-  
+   * \brief Update the four blocks coupled by an edge, A(i, i) += Ji, A(i, j) += Jj,
+   *        A(j, i) -= Ji and A(j, j) -= Jj, without searching the sparse structure.
+   * \note Only available when the matrix was initialized with the edge connectivity. Edges
+   *       that share no point (same color) can be updated concurrently.
+   * \param[in] iEdge - Index of the edge that couples iPoint and jPoint.
+   * \param[in] iPoint - First node of the edge (geometry->edge[iEdge]->GetNode(0)).
+   * \param[in] jPoint - Second node of the edge (geometry->edge[iEdge]->GetNode(1)).
+   * \param[in] **block_i - Jacobian of the edge flux with respect to iPoint.
+   * \param[in] **block_j - Jacobian of the edge flux with respect to jPoint.
+   */
+  void UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j);
+
   /*!
-   * \brief Subtracts the specified block to the sparse matrix.
-   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] block_j - Indexes of the block in the matrix-by-blocks structure.
-   * \param[in] **val_block - Block to subtract to A(i, j).
+   * \brief Update the four blocks coupled by an edge with the opposite sign of UpdateBlocks,
+   *        A(i, i) -= Ji, A(i, j) -= Jj, A(j, i) += Ji and A(j, j) += Jj.
+   * \note Only available when the matrix was initialized with the edge connectivity. Edges
+   *       that share no point (same color) can be updated concurrently.
+   * \param[in] iEdge - Index of the edge that couples iPoint and jPoint.
+   * \param[in] iPoint - First node of the edge (geometry->edge[iEdge]->GetNode(0)).
+   * \param[in] jPoint - Second node of the edge (geometry->edge[iEdge]->GetNode(1)).
+   * \param[in] **block_i - Jacobian of the edge flux with respect to iPoint.
+   * \param[in] **block_j - Jacobian of the edge flux with respect to jPoint.
    */
-  void SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block);
+  void UpdateBlocksSub(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j);
   
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
@@ -300,14 +654,6 @@ public:
    */
   void Gauss_Elimination(su2double* Block, su2double* rhs);
   
-  /*!
-   * \brief Performs the Gauss Elimination algorithm to solve the linear subsystem of the (i, i) subblock and rhs.
-   * \param[in] block_i - Index of the (i, i) subblock in the matrix-by-blocks structure.
-   * \param[in] rhs - Right-hand-side of the linear system.
-   * \return Solution of the linear system (overwritten on rhs).
-   */
-  void Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs);
-  
   /*!
    * \fn void CSysMatrix::ProdBlockVector(unsigned long block_i, unsigned long block_j, su2double* vec);
    * \brief Performs the product of the block (i, j) by vector vec.
@@ -419,13 +765,6 @@ public:
    */
   void InverseDiagonalBlock(unsigned long block_i, su2double *invBlock, bool transpose = false);
   
- 	/*!
-   * \brief Inverse diagonal block.
-   * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
-   * \param[out] invBlock - Inverse block.
-   */
-  void InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double *invBlock);
-  
   /*!
    * \brief Inverse a block.
    * \param[in] Block - block matrix.
@@ -463,7 +802,12 @@ public:
   unsigned long Jacobi_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config);
   
   /*!
-   * \brief Build the ILU preconditioner.
+   * \brief Allocate the work arrays that each thread uses in the level scheduled sweeps.
+   */
+  void SetSweepWork(void);
+  
+  /*!
+   * \brief Build the ILU preconditioner, the diagonal blocks of the factorization are stored inverted.
    * \param[in] transposed - Flag to use the transposed matrix to construct the preconditioner.
    */
   void BuildILUPreconditioner(bool transposed = false);
@@ -492,6 +836,11 @@ public:
    */
   unsigned long ILU_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Build the LU_SGS preconditioner (inverse of the diagonal blocks).
+   */
+  void BuildLU_SGSPreconditioner(void);
+  
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -514,6 +863,20 @@ public:
    */
   unsigned long LU_SGS_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Build the smoothed aggregation AMG preconditioner (levels, transfer operators and coarse factorization).
+   */
+  void BuildAMGPreconditioner(void);
+  
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle of the AMG hierarchy).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M^-1*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Build the Linelet preconditioner.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -736,6 +1099,39 @@ public:
   void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CLineletPreconditioner
  * \brief specialization of preconditioner that uses CSysMatrix class
@@ -120,6 +120,21 @@ inline void CLU_SGSPreconditioner::operator()(const CSysVector & u, CSysVector &
   sparse_matrix->ComputeLU_SGSPreconditioner(u, v, geometry, config);
 }
 
+inline CAMGPreconditioner::CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CAMGPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CAMGPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeAMGPreconditioner(u, v, geometry, config);
+}
+
 inline CLineletPreconditioner::CLineletPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
   geometry = geometry_ref;
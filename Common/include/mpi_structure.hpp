@@ -44,6 +44,7 @@
 #endif
 
 #include "./datatype_structure.hpp"
+#include "./omp_structure.hpp"
 #include <stdlib.h>
 
 #ifdef HAVE_MPI
@@ -138,6 +139,16 @@ public:
 
   static void Waitall(int nrequests, Request *request, Status *status);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Startall(int nrequests, Request *request);
+
+  static void Request_free(Request *request);
+
   static void Waitany(int nrequests, Request *request,
                       int *index, Status *status);
 
@@ -163,6 +174,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -263,6 +277,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
@@ -382,6 +399,9 @@ public:
   static void Allreduce(void *sendbuf, void *recvbuf, int count,
                         Datatype datatype, Op op, Comm comm);
 
+  static void Iallreduce(void *sendbuf, void *recvbuf, int count,
+                         Datatype datatype, Op op, Comm comm, Request* request);
+
   static void Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                      void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm);
 
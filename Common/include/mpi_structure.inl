@@ -130,6 +130,24 @@ inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *st
   MPI_Waitall(nrequests, request, status);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                   int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                   int source, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,source,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Startall(int nrequests, Request *request) {
+  MPI_Startall(nrequests, request);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
 inline void CBaseMPIWrapper::Probe(int source, int tag, Comm comm, Status *status){
   MPI_Probe(source, tag, comm, status);
 }
@@ -164,6 +182,11 @@ inline void CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
   MPI_Allreduce(sendbuf,recvbuf,count,datatype,op,comm);
 }
 
+inline void CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request* request) {
+  MPI_Iallreduce(sendbuf,recvbuf,count,datatype,op,comm,request);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                                 void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm) {
   MPI_Gather(sendbuf,sendcnt,sendtype,recvbuf,recvcnt,recvtype,root,comm);
@@ -352,6 +375,11 @@ inline void CMediMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
   AMPI_Allreduce(sendbuf,recvbuf,count,convertDatatype(datatype),convertOp(op),convertComm(comm));
 }
 
+inline void CMediMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                    Datatype datatype, Op op, Comm comm, Request* request) {
+  AMPI_Iallreduce(sendbuf,recvbuf,count,convertDatatype(datatype),convertOp(op),convertComm(comm),request);
+}
+
 inline void CMediMPIWrapper::Gather(void *sendbuf, int sendcnt,Datatype sendtype,
                                 void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm) {
   AMPI_Gather(sendbuf,sendcnt,convertDatatype(sendtype),recvbuf,recvcnt,convertDatatype(recvtype),root,convertComm(comm));
@@ -469,6 +497,11 @@ inline void  CBaseMPIWrapper::Allreduce(void *sendbuf, void *recvbuf, int count,
    CopyData(sendbuf, recvbuf, count, datatype);
 }
 
+inline void  CBaseMPIWrapper::Iallreduce(void *sendbuf, void *recvbuf, int count,
+                                     Datatype datatype, Op op, Comm comm, Request* request){
+   CopyData(sendbuf, recvbuf, count, datatype);
+}
+
 inline void CBaseMPIWrapper::Gather(void *sendbuf, int sendcnt, Datatype sendtype,
                    void *recvbuf, int recvcnt, Datatype recvtype, int root, Comm comm){
   CopyData(sendbuf, recvbuf, sendcnt, sendtype);
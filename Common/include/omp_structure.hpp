@@ -0,0 +1,60 @@
+/*!
+ * \file omp_structure.hpp
+ * \brief Thin interface to OpenMP, the threaded loops of the solvers also
+ *        compile (serially) when the code is built without OpenMP support.
+ * \author the SU2 contributors
+ * \version 6.1.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2018, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/*--- The AD datatypes are not thread safe (the tape is global), threading
+ is only enabled for the primal build. ---*/
+
+#if defined HAVE_OMP && (defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+#undef HAVE_OMP
+#endif
+
+#ifdef HAVE_OMP
+#include <omp.h>
+#else
+
+/*--- Serial versions of the OpenMP runtime functions used in the code. ---*/
+
+inline int omp_get_max_threads(void) { return 1; }
+
+inline int omp_get_num_threads(void) { return 1; }
+
+inline int omp_get_thread_num(void) { return 0; }
+
+#endif
@@ -1388,14 +1388,19 @@ static const map<string, ENUM_ADAPT> Adapt_Map = CCreateMap<string, ENUM_ADAPT>
  */
 enum ENUM_INPUT {
   SU2 = 1,                       /*!< \brief SU2 input format. */
-  CGNS = 2                     /*!< \brief CGNS input format for the computational grid. */
+  CGNS = 2,                    /*!< \brief CGNS input format for the computational grid. */
+  SU2_BINARY = 3               /*!< \brief Binary SU2 input format. */
 };
 static const map<string, ENUM_INPUT> Input_Map = CCreateMap<string, ENUM_INPUT>
 ("SU2", SU2)
-("CGNS", CGNS);
+("CGNS", CGNS)
+("SU2_BINARY", SU2_BINARY);
 
 const int CGNS_STRING_SIZE = 33;/*!< \brief Length of strings used in the CGNS format. */
 
+const unsigned long SU2_BINARY_MESH_ID = 535533;    /*!< \brief First value of each zone of a binary SU2 mesh file. */
+const unsigned short SU2_BINARY_MESH_HEADER = 10;   /*!< \brief Number of unsigned longs in the header of each zone of a binary SU2 mesh file. */
+
 /*!
  * \brief type of solution output file formats
  */
@@ -1570,7 +1575,9 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER_LUSGS = 8,  /*!< \brief LU_SGS smoother. */
   SMOOTHER_JACOBI = 9,  /*!< \brief Jacobi smoother. */
   SMOOTHER_ILU = 10,  /*!< \brief ILU smoother. */
-  SMOOTHER_LINELET = 11  /*!< \brief Linelet smoother. */
+  SMOOTHER_LINELET = 11,  /*!< \brief Linelet smoother. */
+  PIPELINED_FGMRES = 12,  /*!< \brief FGMRES with the global reduction overlapped with the preconditioner. */
+  PIPELINED_BCGSTAB = 13  /*!< \brief BCGSTAB with the global reductions overlapped with the preconditioner and the matrix-vector product. */
 };
 static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<string, ENUM_LINEAR_SOLVER>
 ("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1583,7 +1590,33 @@ static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<stri
 ("SMOOTHER_LUSGS", SMOOTHER_LUSGS)
 ("SMOOTHER_JACOBI", SMOOTHER_JACOBI)
 ("SMOOTHER_LINELET", SMOOTHER_LINELET)
-("SMOOTHER_ILU", SMOOTHER_ILU);
+("SMOOTHER_ILU", SMOOTHER_ILU)
+("PIPELINED_FGMRES", PIPELINED_FGMRES)
+("PIPELINED_BCGSTAB", PIPELINED_BCGSTAB);
+
+/*!
+ * \brief types of orthogonalization of the Krylov basis (FGMRES)
+ */
+enum ENUM_ORTHOGONALIZATION {
+  MODIFIED_GRAM_SCHMIDT = 0,	/*!< \brief Modified Gram-Schmidt, one global reduction per inner product. */
+  CLASSICAL_GRAM_SCHMIDT = 1	/*!< \brief Classical Gram-Schmidt with reorthogonalization, the inner products are batched in one global reduction. */
+};
+static const map<string, ENUM_ORTHOGONALIZATION> Orthogonalization_Map = CCreateMap<string, ENUM_ORTHOGONALIZATION>
+("MGS", MODIFIED_GRAM_SCHMIDT)
+("CGS", CLASSICAL_GRAM_SCHMIDT);
+
+/*!
+ * \brief types of point renumbering applied at preprocessing
+ */
+enum ENUM_POINT_ORDERING {
+  NO_ORDERING = 0,		/*!< \brief Keep the ordering of the mesh file. */
+  RCM_ORDERING = 1,		/*!< \brief Reverse Cuthill-McKee ordering of the point graph. */
+  HILBERT_ORDERING = 2		/*!< \brief Ordering along a Hilbert space-filling curve through the point coordinates. */
+};
+static const map<string, ENUM_POINT_ORDERING> Point_Ordering_Map = CCreateMap<string, ENUM_POINT_ORDERING>
+("NONE", NO_ORDERING)
+("RCM", RCM_ORDERING)
+("HILBERT", HILBERT_ORDERING);
 
 /*!
  * \brief types surface continuity at the intersection with the FFD
@@ -1635,13 +1668,15 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  AMG = 5       /*!< \brief Smoothed aggregation algebraic multigrid preconditioner. */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU", ILU);
+("ILU", ILU)
+("AMG", AMG);
 
 /*!
  * \brief types of analytic definitions for various geometries
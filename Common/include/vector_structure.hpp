@@ -292,6 +292,24 @@ public:
 	 */
   void AddBlock(unsigned long val_ipoint, su2double *val_residual);
   
+  /*!
+   * \brief Add the flux of an edge to its first point and subtract it from the second one.
+   * \note Edges that share no point (same color) can be updated concurrently.
+   * \param[in] val_ipoint - First point of the edge.
+   * \param[in] val_jpoint - Second point of the edge.
+   * \param[in] val_residual - Flux of the edge.
+   */
+  void UpdateBlocks(unsigned long val_ipoint, unsigned long val_jpoint, su2double *val_residual);
+  
+  /*!
+   * \brief Subtract the flux of an edge from its first point and add it to the second one.
+   * \note Edges that share no point (same color) can be updated concurrently.
+   * \param[in] val_ipoint - First point of the edge.
+   * \param[in] val_jpoint - Second point of the edge.
+   * \param[in] val_residual - Flux of the edge.
+   */
+  void UpdateBlocksSub(unsigned long val_ipoint, unsigned long val_jpoint, su2double *val_residual);
+  
   /*!
 	 * \brief Set val_residual to the residual.
 	 * \param[in] val_ipoint - index of the point where set the residual.
@@ -343,6 +361,14 @@ public:
    */
   friend su2double dotProd(const CSysVector & u, const CSysVector & v);
   
+  /*!
+   * \brief dot-product between two CSysVectors over the domain points of this rank only
+   *        (no reduction, used to batch several products in one reduction)
+   * \param[in] u - first CSysVector in dot product
+   * \param[in] v - second CSysVector in dot product
+   */
+  friend su2double dotProdLocal(const CSysVector & u, const CSysVector & v);
+  
 };
 
 /*!
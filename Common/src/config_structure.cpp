@@ -149,6 +149,7 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
   ifstream mesh_file;
   short nZone = 1; // Default value
   unsigned short iLine, nLine = 10;
+  unsigned long Header[SU2_BINARY_MESH_HEADER];
   char cstr[200];
   string::size_type position;
   
@@ -181,6 +182,24 @@ unsigned short CConfig::GetnZone(string val_mesh_filename, unsigned short val_fo
 
       break;
 
+    case SU2_BINARY:
+
+      /*--- The number of zones is stored in the header of the first zone ---*/
+
+      strcpy (cstr, val_mesh_filename.c_str());
+      mesh_file.open(cstr, ios::in | ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("There is no geometry file called ") + string(cstr), CURRENT_FUNCTION);
+      }
+
+      mesh_file.read((char *)Header, SU2_BINARY_MESH_HEADER*sizeof(unsigned long));
+      if (mesh_file.fail() || (Header[0] != SU2_BINARY_MESH_ID)) {
+        SU2_MPI::Error(string("File ") + string(cstr) + string(" is not a binary SU2 mesh file."), CURRENT_FUNCTION);
+      }
+      nZone = Header[1];
+
+      break;
+
   }
 
   /*--- For harmonic balance integration, nZones = nTimeInstances. ---*/
@@ -198,13 +217,15 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
   ifstream mesh_file;
   short nDim = 3;
   unsigned short iLine, nLine = 10;
+  unsigned long Header[SU2_BINARY_MESH_HEADER];
   char cstr[200];
   string::size_type position;
 
   /*--- Open grid file ---*/
 
   strcpy (cstr, val_mesh_filename.c_str());
-  mesh_file.open(cstr, ios::in);
+  if (val_format == SU2_BINARY) mesh_file.open(cstr, ios::in | ios::binary);
+  else mesh_file.open(cstr, ios::in);
 
   switch (val_format) {
   case SU2:
@@ -224,6 +245,14 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
     }
     break;
 
+  case SU2_BINARY:
+
+    /*--- Read the dimension in the header of the first zone ---*/
+
+    mesh_file.read((char *)Header, SU2_BINARY_MESH_HEADER*sizeof(unsigned long));
+    if (!mesh_file.fail() && (Header[0] == SU2_BINARY_MESH_ID)) nDim = Header[2];
+    break;
+
   case CGNS:
 
 #ifdef HAVE_CGNS
@@ -1154,6 +1183,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief LINEAR_SOLVER_PREC
    *  \n DESCRIPTION: Preconditioner for the Krylov linear solvers \n OPTIONS: see \link Linear_Solver_Prec_Map \endlink \n DEFAULT: LU_SGS \ingroup Config*/
   addEnumOption("LINEAR_SOLVER_PREC", Kind_Linear_Solver_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Orthogonalization of the Krylov basis of FGMRES (MGS, CGS) */
+  addEnumOption("LINEAR_SOLVER_ORTHOGONALIZATION", Kind_Linear_Solver_Orthogonalization, Orthogonalization_Map, MODIFIED_GRAM_SCHMIDT);
   /* DESCRIPTION: Minimum error threshold for the linear solver for the implicit formulation */
   addDoubleOption("LINEAR_SOLVER_ERROR", Linear_Solver_Error, 1E-6);
   /* DESCRIPTION: Minimum error threshold for the linear solver for the implicit formulation for the FVM heat solver. */
@@ -1164,6 +1195,24 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_ITER_HEAT", Linear_Solver_Iter_Heat, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Store the factors of the ILU preconditioner in single precision */
+  addBoolOption("LINEAR_SOLVER_PREC_SINGLE", Linear_Solver_Prec_Single, false);
+  /* DESCRIPTION: Level scheduled (parallel) sweeps of the ILU and LU_SGS preconditioners, NO for the sequential sweeps */
+#ifdef HAVE_OMP
+  addBoolOption("LINEAR_SOLVER_LEVEL_SCHEDULING", Linear_Solver_Level_Scheduling, true);
+#else
+  addBoolOption("LINEAR_SOLVER_LEVEL_SCHEDULING", Linear_Solver_Level_Scheduling, false);
+#endif
+  /* DESCRIPTION: Number of directions recycled by FGMRES between consecutive linear solves (0 disables recycling) */
+  addUnsignedShortOption("LINEAR_SOLVER_RECYCLE", Linear_Solver_Recycle, 0);
+  /* DESCRIPTION: Number of nonlinear iterations between rebuilds of the JACOBI/ILU preconditioner of the Krylov solvers (1 rebuilds it at every iteration) */
+  addUnsignedLongOption("LINEAR_SOLVER_PREC_LAG", Linear_Solver_Prec_Lag, 1);
+  /* DESCRIPTION: Growth of the linear iterations per decade of residual reduction, w.r.t. the last rebuild, that forces a rebuild of a lagged preconditioner */
+  addDoubleOption("LINEAR_SOLVER_PREC_LAG_DEGRADE", Linear_Solver_Prec_Lag_Degrade, 2.0);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov for the flow equations, the Jacobian-vector products are finite differences of the residual */
+  addBoolOption("MATRIX_FREE_JACOBIAN", MatrixFree_Jacobian, false);
+  /* DESCRIPTION: Relative step of the finite differences of the matrix-free Jacobian-vector products */
+  addDoubleOption("MATRIX_FREE_STEP", MatrixFree_Step, 1E-7);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
@@ -1288,6 +1337,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addConvectOption("CONV_NUM_METHOD_FLOW", Kind_ConvNumScheme_Flow, Kind_Centered_Flow, Kind_Upwind_Flow);
   /*!\brief MUSCL_FLOW \n DESCRIPTION: Check if the MUSCL scheme should be used \ingroup Config*/
   addBoolOption("MUSCL_FLOW", MUSCL_Flow, true);
+  /*!\brief FLUX_BATCH_FLOW \n DESCRIPTION: Evaluate the convective flux (ROE, JST) in batches of edges of the same color \ingroup Config*/
+  addBoolOption("FLUX_BATCH_FLOW", Flux_Batch_Flow, false);
   /*!\brief SLOPE_LIMITER_FLOW
    * DESCRIPTION: Slope limiter for the direct solution. \n OPTIONS: See \link Limiter_Map \endlink \n DEFAULT VENKATAKRISHNAN \ingroup Config*/
   addEnumOption("SLOPE_LIMITER_FLOW", Kind_SlopeLimit_Flow, Limiter_Map, VENKATAKRISHNAN);
@@ -1412,6 +1463,18 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
   /* DESCRIPTION: Automatically reorient elements that seem flipped */
   addBoolOption("REORIENT_ELEMENTS",ReorientElements, true);
+  /* DESCRIPTION: Renumbering of the points at preprocessing (RCM, HILBERT, NONE) */
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_ORDERING);
+  /* DESCRIPTION: Weight the points (edges, boundaries, measured cost) and edges (shared elements) of the ParMETIS graph */
+  addBoolOption("PARTITION_WEIGHTS", Partition_Weights, false);
+  /* DESCRIPTION: Weight factor of the points on walls, actuator disks and interfaces for the partitioning */
+  addDoubleOption("PARTITION_WALL_WEIGHT", Partition_Wall_Weight, 2.0);
+  /* DESCRIPTION: File with the measured cost of each point, read before and written after a weighted run */
+  addStringOption("PARTITION_COST_FILENAME", Partition_Cost_FileName, string("partition_cost.dat"));
+  /* DESCRIPTION: Number of time steps between the checks of the load balance of the ranks (0 disables the rebalancing) */
+  addUnsignedLongOption("REBALANCE_FREQ", Rebalance_Freq, 0);
+  /* DESCRIPTION: Imbalance of the ranks (max/average time) above which the grid is partitioned again */
+  addDoubleOption("REBALANCE_THRESHOLD", Rebalance_Threshold, 1.2);
 
   /*!\par CONFIG_CATEGORY: Input/output files and formats \ingroup Config */
   /*--- Options related to input/output files and formats ---*/
@@ -1426,6 +1489,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Mesh output file format (SU2 or SU2_BINARY) \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /*!\brief CONV_FILENAME \n DESCRIPTION: Output file convergence history (w/o extension) \n DEFAULT: history \ingroup Config*/
   addStringOption("CONV_FILENAME", Conv_FileName, string("history"));
@@ -1982,6 +2047,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Write extra heat output for a given zone heat solver zone */
   addLongOption("EXTRA_HEAT_ZONE_OUTPUT", ExtraHeatOutputZone, -1);
 
+  /* DESCRIPTION: Stop the run if the scratch memory of the solvers allocates after the first iteration (debugging of the residual and boundary routines) */
+  addBoolOption("CHECK_SCRATCH_MEMORY", Check_Scratch_Memory, false);
+
   /*--- options related to the FFD problem ---*/
   /*!\par CONFIG_CATEGORY:FFD point inversion \ingroup Config*/
   
@@ -3558,6 +3626,35 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     SU2_MPI::Error("BC transition model currently only available in combination with SA turbulence model!", CURRENT_FUNCTION);
   }
   
+  /*--- The dynamic load balancing moves the state of unsteady flow solvers
+   between the ranks, and repartitions with the measured cost. ---*/
+  
+  if (Rebalance_Freq > 0) {
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+        ((Unsteady_Simulation != DT_STEPPING_1ST) && (Unsteady_Simulation != DT_STEPPING_2ND) &&
+         (Unsteady_Simulation != TIME_STEPPING)) || FSI_Problem) {
+      SU2_MPI::Error(string("REBALANCE_FREQ is only available for unsteady Euler, Navier-Stokes and RANS simulations.\n") +
+                     string("Please set REBALANCE_FREQ= 0 and try again."), CURRENT_FUNCTION);
+    }
+    Partition_Weights = true;
+  }
+  
+  /*--- Only the native formats can be written by SU2_DEF and SU2_MSH. ---*/
+  
+  if (Mesh_Out_FileFormat == CGNS) {
+    SU2_MPI::Error(string("CGNS grids can not be written, MESH_OUT_FORMAT must be SU2 or SU2_BINARY.\n") +
+                   string("Please change MESH_OUT_FORMAT and try again."), CURRENT_FUNCTION);
+  }
+  
+  /*--- SU2_DEF appends the FFD boxes to the output mesh as text, only an ASCII mesh can hold them. ---*/
+  
+  if ((Kind_SU2 == SU2_DEF) && (Mesh_Out_FileFormat == SU2_BINARY) && (nDV > 0) &&
+      (((Design_Variable[0] >= FFD_SETTING) && (Design_Variable[0] <= FFD_CONTROL_SURFACE)) ||
+       (Design_Variable[0] == FFD_ANGLE_OF_ATTACK))) {
+    SU2_MPI::Error(string("The FFD boxes can not be written to a SU2_BINARY mesh.\n") +
+                   string("Please set MESH_OUT_FORMAT= SU2 and try again."), CURRENT_FUNCTION);
+  }
+  
   /*--- Check for constant lift mode. Initialize the update flag for
    the AoA with each iteration to false  ---*/
   
@@ -3766,6 +3863,34 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     SU2_MPI::Error("Support for grid movement not yet implemented for incompressible flows.", CURRENT_FUNCTION);
   }
 
+  /*--- The matrix-free Jacobian-vector products are only implemented for the
+   compressible flow solvers with Krylov linear solvers. ---*/
+
+  if (MatrixFree_Jacobian) {
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+        (Kind_Regime != COMPRESSIBLE) || ContinuousAdjoint || DiscreteAdjoint) {
+      SU2_MPI::Error("MATRIX_FREE_JACOBIAN is only available for the direct compressible flow solvers.", CURRENT_FUNCTION);
+    }
+    if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) {
+      SU2_MPI::Error("MATRIX_FREE_JACOBIAN requires TIME_DISCRE_FLOW= EULER_IMPLICIT.", CURRENT_FUNCTION);
+    }
+    if ((Kind_Linear_Solver != BCGSTAB) && (Kind_Linear_Solver != FGMRES) &&
+        (Kind_Linear_Solver != RESTARTED_FGMRES) && (Kind_Linear_Solver != PIPELINED_FGMRES) &&
+        (Kind_Linear_Solver != PIPELINED_BCGSTAB)) {
+      SU2_MPI::Error("MATRIX_FREE_JACOBIAN requires a Krylov LINEAR_SOLVER (BCGSTAB or FGMRES variants).", CURRENT_FUNCTION);
+    }
+    if (Fixed_CL_Mode || Low_Mach_Precon || (Kind_Upwind_Flow == TURKEL)) {
+      SU2_MPI::Error("MATRIX_FREE_JACOBIAN is not compatible with FIXED_CL_MODE or low Mach preconditioning.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (Linear_Solver_Prec_Lag == 0) {
+    SU2_MPI::Error("LINEAR_SOLVER_PREC_LAG must be at least 1 (rebuild at every iteration).", CURRENT_FUNCTION);
+  }
+  if (Linear_Solver_Prec_Lag_Degrade < 1.0) {
+    SU2_MPI::Error("LINEAR_SOLVER_PREC_LAG_DEGRADE must be greater or equal than 1.", CURRENT_FUNCTION);
+  }
+
   /*--- Assert that there are two markers being analyzed if the
    pressure drop objective function is selected. ---*/
 
@@ -5243,6 +5368,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -5255,10 +5381,25 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
                break;
+            case PIPELINED_FGMRES:
+            case PIPELINED_BCGSTAB:
+              if (Kind_Linear_Solver == PIPELINED_FGMRES) cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              else cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              switch (Kind_Linear_Solver_Prec) {
+                case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
+                case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
+                case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
+              }
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of linear iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case SMOOTHER_JACOBI:
               cout << "A Jacobi method is used for smoothing the linear system." << endl;
               break;
@@ -5303,6 +5444,16 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
+            case PIPELINED_FGMRES:
+              cout << "Pipelined FGMRES is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
+            case PIPELINED_BCGSTAB:
+              cout << "Pipelined BCGSTAB is used for solving the linear system." << endl;
+              cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
+              cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
+              break;
             case CONJUGATE_GRADIENT:
               cout << "A Conjugate Gradient method is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
@@ -79,6 +79,9 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   /*--- Flip the normal orientation ---*/
   Flip_Orientation = false;
 
+  /*--- Coordinates and volume are owned by the point until they are packed ---*/
+  Contiguous = false;
+
   /*--- Indicator if the point is going to be moved in a volumetric deformation ---*/
   Move = true;
 
@@ -172,6 +175,9 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   /*--- Flip the normal orientation ---*/
   Flip_Orientation = false;
 
+  /*--- Coordinates and volume are owned by the point until they are packed ---*/
+  Contiguous = false;
+
   /*--- Indicator if the point is going to be moved in a volumetric deformation ---*/
   Move = true;
 
@@ -269,6 +275,9 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   /*--- Flip the normal orientation ---*/
   Flip_Orientation = false;
 
+  /*--- Coordinates and volume are owned by the point until they are packed ---*/
+  Contiguous = false;
+
   /*--- Identify boundaries, physical boundaries (not send-receive 
   condition), detect if an element belong to the domain or it must 
   be computed with other processor  ---*/
@@ -327,8 +336,8 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
 CPoint::~CPoint() {
 
   if (Vertex       != NULL && Boundary) delete[] Vertex;
-  if (Volume       != NULL) delete[] Volume;
-  if (Coord        != NULL) delete[] Coord;
+  if (Volume       != NULL && !Contiguous) delete[] Volume;
+  if (Coord        != NULL && !Contiguous) delete[] Coord;
   if (Coord_Old    != NULL) delete[] Coord_Old;
   if (Coord_Sum    != NULL) delete[] Coord_Sum;
   if (Coord_n      != NULL) delete[] Coord_n;
@@ -343,6 +352,26 @@ CPoint::~CPoint() {
   
 }
 
+void CPoint::SetStorage(su2double *val_coord, su2double *val_volume, unsigned short val_nVolume) {
+
+  unsigned short iDim, iVolume;
+
+  /*--- Copy the current values to the packed slots and release the own arrays ---*/
+
+  for (iDim = 0; iDim < nDim; iDim++) val_coord[iDim] = Coord[iDim];
+  for (iVolume = 0; iVolume < val_nVolume; iVolume++) val_volume[iVolume] = Volume[iVolume];
+
+  if (!Contiguous) {
+    delete[] Coord;
+    delete[] Volume;
+  }
+
+  Coord = val_coord;
+  Volume = val_volume;
+  Contiguous = true;
+
+}
+
 void CPoint::SetPoint(unsigned long val_point) {
 
   unsigned short iPoint;
@@ -389,6 +418,7 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
   Coord_CG = NULL;
   Normal   = NULL;
   Nodes    = NULL;
+  Contiguous = false;
 
   /*--- Allocate center of gravity coordinates, nodes, and face normal ---*/
   Coord_CG = new su2double [nDim];
@@ -409,8 +439,29 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
 CEdge::~CEdge() {
   
   if (Coord_CG != NULL) delete[] Coord_CG;
-  if (Normal   != NULL) delete[] Normal;
-  if (Nodes    != NULL) delete[] Nodes;
+  if (Normal   != NULL && !Contiguous) delete[] Normal;
+  if (Nodes    != NULL && !Contiguous) delete[] Nodes;
+  
+}
+
+void CEdge::SetStorage(unsigned long *val_nodes, su2double *val_normal) {
+  
+  unsigned short iDim;
+  
+  /*--- Copy the current values to the packed slots and release the own arrays ---*/
+  
+  val_nodes[0] = Nodes[0];
+  val_nodes[1] = Nodes[1];
+  for (iDim = 0; iDim < nDim; iDim++) val_normal[iDim] = Normal[iDim];
+  
+  if (!Contiguous) {
+    delete[] Nodes;
+    delete[] Normal;
+  }
+  
+  Nodes = val_nodes;
+  Normal = val_normal;
+  Contiguous = true;
   
 }
 
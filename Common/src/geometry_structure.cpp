@@ -38,8 +38,14 @@
 #include "../include/geometry_structure.hpp"
 #include "../include/adt_structure.hpp"
 #include <iomanip>
+#include <climits>
 #include <sys/types.h>
 #include <sys/stat.h>
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 /*--- Epsilon definition ---*/
 
 #define EPSILON 0.000001
@@ -79,6 +85,26 @@ CGeometry::CGeometry(void) {
   bound               = NULL;
   node                = NULL;
   edge                = NULL;
+  Edge_Nodes          = NULL;
+  Edge_Normal         = NULL;
+  Point_Coord         = NULL;
+  Point_Volume        = NULL;
+  nPoint_Volume       = 0;
+  Point_LSWeight      = NULL;
+  Point_LSWeight_Begin = NULL;
+  LSWeight_Valid      = false;
+  nEdge_Color         = 0;
+  Edge_Color_Ptr      = NULL;
+  Edge_Color_Edge     = NULL;
+  Edge_Color_Split    = NULL;
+  nHalo_Neighbor      = 0;
+  Halo_Send_Rank      = NULL;
+  Halo_Recv_Rank      = NULL;
+  Halo_Send_Ptr       = NULL;
+  Halo_Recv_Ptr       = NULL;
+  Halo_Send_Point     = NULL;
+  Halo_Recv_Point     = NULL;
+  Halo_Rotation       = NULL;
   vertex              = NULL;
   nVertex             = NULL;
   newBound            = NULL;
@@ -149,6 +175,23 @@ CGeometry::~CGeometry(void) {
     delete[] edge;
   }
 
+  if (Edge_Nodes   != NULL) delete [] Edge_Nodes;
+  if (Edge_Normal  != NULL) delete [] Edge_Normal;
+  if (Point_Coord  != NULL) delete [] Point_Coord;
+  if (Point_Volume != NULL) delete [] Point_Volume;
+  if (Point_LSWeight       != NULL) delete [] Point_LSWeight;
+  if (Point_LSWeight_Begin != NULL) delete [] Point_LSWeight_Begin;
+  if (Edge_Color_Ptr  != NULL) delete [] Edge_Color_Ptr;
+  if (Edge_Color_Edge != NULL) delete [] Edge_Color_Edge;
+  if (Edge_Color_Split != NULL) delete [] Edge_Color_Split;
+  if (Halo_Send_Rank  != NULL) delete [] Halo_Send_Rank;
+  if (Halo_Recv_Rank  != NULL) delete [] Halo_Recv_Rank;
+  if (Halo_Send_Ptr   != NULL) delete [] Halo_Send_Ptr;
+  if (Halo_Recv_Ptr   != NULL) delete [] Halo_Recv_Ptr;
+  if (Halo_Send_Point != NULL) delete [] Halo_Send_Point;
+  if (Halo_Recv_Point != NULL) delete [] Halo_Recv_Point;
+  if (Halo_Rotation   != NULL) delete [] Halo_Rotation;
+
   if (vertex != NULL) {
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
@@ -251,26 +294,38 @@ bool CGeometry::CheckEdge(unsigned long first_point, unsigned long second_point)
 }
 
 void CGeometry::SetEdges(void) {
-  unsigned long iPoint, jPoint;
+  unsigned long iPoint, jPoint, iNeighbor;
   long iEdge;
   unsigned short jNode, iNode;
-  long TestEdge = 0;
+  vector<pair<unsigned long, unsigned short> > Neighbor;
+  
+  /*--- The edges are numbered by their first point and then by their second
+   point, so consecutive edges of the residual loops reuse the data of iPoint
+   and gather the data of jPoint with increasing addresses. ---*/
   
   nEdge = 0;
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    Neighbor.clear();
     for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
       jPoint = node[iPoint]->GetPoint(iNode);
+      if (iPoint < jPoint) Neighbor.push_back(make_pair(jPoint, iNode));
+    }
+    sort(Neighbor.begin(), Neighbor.end());
+    
+    for (iNeighbor = 0; iNeighbor < Neighbor.size(); iNeighbor++) {
+      jPoint = Neighbor[iNeighbor].first;
+      iNode = Neighbor[iNeighbor].second;
       for (jNode = 0; jNode < node[jPoint]->GetnPoint(); jNode++)
         if (node[jPoint]->GetPoint(jNode) == iPoint) {
-          TestEdge = node[jPoint]->GetEdge(jNode);
+          node[iPoint]->SetEdge(nEdge, iNode);
+          node[jPoint]->SetEdge(nEdge, jNode);
+          nEdge++;
           break;
         }
-      if (TestEdge == -1) {
-        node[iPoint]->SetEdge(nEdge, iNode);
-        node[jPoint]->SetEdge(nEdge, jNode);
-        nEdge++;
-      }
     }
+    
+  }
   
   edge = new CEdge*[nEdge];
   
@@ -282,6 +337,353 @@ void CGeometry::SetEdges(void) {
     }
 }
 
+void CGeometry::SetPackedStorage(CConfig *config) {
+  
+  unsigned long iEdge, iPoint;
+  unsigned long *Edge_Nodes_Old = Edge_Nodes;
+  su2double *Edge_Normal_Old = Edge_Normal, *Point_Coord_Old = Point_Coord, *Point_Volume_Old = Point_Volume;
+  
+  /*--- The edge loops of the solvers read the node pairs, normals and
+   coordinates from contiguous arrays instead of one object per edge/point.
+   The objects are rebound to their slots, so the values set through them
+   (e.g. by the dual grid or the grid movement) are always in the packed arrays. ---*/
+  
+  Edge_Nodes  = new unsigned long [nEdge*2];
+  Edge_Normal = new su2double [nEdge*nDim];
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    edge[iEdge]->SetStorage(&Edge_Nodes[iEdge*2], &Edge_Normal[iEdge*nDim]);
+  
+  /*--- Same number of volumes per point as allocated by CPoint ---*/
+  
+  if (config->GetUnsteady_Simulation() == NO) nPoint_Volume = 1;
+  else nPoint_Volume = 3;
+  
+  Point_Coord  = new su2double [nPoint*nDim];
+  Point_Volume = new su2double [nPoint*nPoint_Volume];
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetStorage(&Point_Coord[iPoint*nDim], &Point_Volume[iPoint*nPoint_Volume], nPoint_Volume);
+  
+  /*--- Packing again (e.g. after renumbering) releases the previous arrays ---*/
+  
+  if (Edge_Nodes_Old   != NULL) delete [] Edge_Nodes_Old;
+  if (Edge_Normal_Old  != NULL) delete [] Edge_Normal_Old;
+  if (Point_Coord_Old  != NULL) delete [] Point_Coord_Old;
+  if (Point_Volume_Old != NULL) delete [] Point_Volume_Old;
+  
+}
+
+void CGeometry::SetEdge_Coloring(bool val_coloring) {
+  
+  unsigned long iEdge, iPoint, iColor;
+  unsigned short iNode, iEnd;
+  long jEdge, *Color = new long [nEdge];
+  vector<bool> Used;
+  vector<unsigned long> Color_Size;
+  
+  /*--- Greedy coloring: each edge takes the first color not used yet by
+   the edges of its two points, so the edges of one color have no point in
+   common and their contributions can be added to the points without conflicts.
+   Without coloring, a single color holds all the edges in their natural order. ---*/
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) Color[iEdge] = (val_coloring? -1 : 0);
+  if ((!val_coloring) && (nEdge != 0)) Color_Size.push_back(nEdge);
+  
+  for (iEdge = 0; val_coloring && (iEdge < nEdge); iEdge++) {
+    
+    Used.assign(Color_Size.size()+1, false);
+    for (iEnd = 0; iEnd < 2; iEnd++) {
+      iPoint = edge[iEdge]->GetNode(iEnd);
+      for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+        jEdge = node[iPoint]->GetEdge(iNode);
+        if ((jEdge != -1) && (Color[jEdge] != -1)) Used[Color[jEdge]] = true;
+      }
+    }
+    
+    iColor = 0;
+    while (Used[iColor]) iColor++;
+    if (iColor == Color_Size.size()) Color_Size.push_back(0);
+    
+    Color[iEdge] = iColor;
+    Color_Size[iColor]++;
+    
+  }
+  
+  /*--- List of the edges sorted by color, in increasing order within a color ---*/
+  
+  if (Edge_Color_Ptr  != NULL) delete [] Edge_Color_Ptr;
+  if (Edge_Color_Edge != NULL) delete [] Edge_Color_Edge;
+  
+  nEdge_Color = Color_Size.size();
+  Edge_Color_Ptr  = new unsigned long [nEdge_Color+1];
+  Edge_Color_Edge = new unsigned long [nEdge];
+  
+  Edge_Color_Ptr[0] = 0;
+  for (iColor = 0; iColor < nEdge_Color; iColor++)
+    Edge_Color_Ptr[iColor+1] = Edge_Color_Ptr[iColor] + Color_Size[iColor];
+  
+  for (iColor = 0; iColor < nEdge_Color; iColor++)
+    Color_Size[iColor] = Edge_Color_Ptr[iColor];
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    Edge_Color_Edge[Color_Size[Color[iEdge]]++] = iEdge;
+  
+  delete [] Color;
+  
+  SetEdge_Color_Split();
+  
+}
+
+void CGeometry::SetEdge_Color_Split(void) {
+  
+  unsigned long iColor, iEdge_Loop, iEdge, iRecv, nInterior;
+  vector<bool> Received(nPoint, false);
+  vector<unsigned long> Halo_Edge;
+  
+  if (Edge_Color_Split != NULL) delete [] Edge_Color_Split;
+  Edge_Color_Split = new unsigned long [nEdge_Color];
+  
+  /*--- Before the halo pattern is known all the edges are interior ---*/
+  
+  if (Halo_Recv_Ptr != NULL) {
+    for (iRecv = 0; iRecv < Halo_Recv_Ptr[nHalo_Neighbor]; iRecv++)
+      Received[Halo_Recv_Point[iRecv]] = true;
+  }
+  
+  /*--- Stable partition of each color, a color stays free of shared points
+   and keeps its edges in increasing order on both sides of the split ---*/
+  
+  for (iColor = 0; iColor < nEdge_Color; iColor++) {
+    Halo_Edge.clear();
+    nInterior = Edge_Color_Ptr[iColor];
+    for (iEdge_Loop = Edge_Color_Ptr[iColor]; iEdge_Loop < Edge_Color_Ptr[iColor+1]; iEdge_Loop++) {
+      iEdge = Edge_Color_Edge[iEdge_Loop];
+      if (Received[edge[iEdge]->GetNode(0)] || Received[edge[iEdge]->GetNode(1)])
+        Halo_Edge.push_back(iEdge);
+      else
+        Edge_Color_Edge[nInterior++] = iEdge;
+    }
+    Edge_Color_Split[iColor] = nInterior;
+    for (iEdge_Loop = 0; iEdge_Loop < Halo_Edge.size(); iEdge_Loop++)
+      Edge_Color_Edge[nInterior+iEdge_Loop] = Halo_Edge[iEdge_Loop];
+  }
+  
+}
+
+void CGeometry::SetHalo_Pattern(CConfig *config) {
+  
+  unsigned short iMarker, MarkerS, MarkerR, iPeriodic_Index, iNeighbor;
+  unsigned long iVertex, iSend, iRecv;
+  su2double *angles, *rotMatrix, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi;
+  
+  /*--- Each send/receive marker pair is one message each way, the points are
+   listed pair after pair so that one buffer holds the messages of all the pairs.
+   Built again if the markers change (e.g. after a repartitioning). ---*/
+  
+  if (Halo_Send_Rank  != NULL) delete [] Halo_Send_Rank;
+  if (Halo_Recv_Rank  != NULL) delete [] Halo_Recv_Rank;
+  if (Halo_Send_Ptr   != NULL) delete [] Halo_Send_Ptr;
+  if (Halo_Recv_Ptr   != NULL) delete [] Halo_Recv_Ptr;
+  if (Halo_Send_Point != NULL) delete [] Halo_Send_Point;
+  if (Halo_Recv_Point != NULL) delete [] Halo_Recv_Point;
+  if (Halo_Rotation   != NULL) delete [] Halo_Rotation;
+  
+  nHalo_Neighbor = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) nHalo_Neighbor++;
+  
+  Halo_Send_Rank = new int [nHalo_Neighbor];
+  Halo_Recv_Rank = new int [nHalo_Neighbor];
+  Halo_Send_Ptr  = new unsigned long [nHalo_Neighbor+1];
+  Halo_Recv_Ptr  = new unsigned long [nHalo_Neighbor+1];
+  
+  iNeighbor = 0;
+  Halo_Send_Ptr[0] = 0; Halo_Recv_Ptr[0] = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      Halo_Send_Rank[iNeighbor] = config->GetMarker_All_SendRecv(MarkerS)-1;
+      Halo_Recv_Rank[iNeighbor] = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+      Halo_Send_Ptr[iNeighbor+1] = Halo_Send_Ptr[iNeighbor] + nVertex[MarkerS];
+      Halo_Recv_Ptr[iNeighbor+1] = Halo_Recv_Ptr[iNeighbor] + nVertex[MarkerR];
+      iNeighbor++;
+    }
+  }
+  
+  Halo_Send_Point = new unsigned long [Halo_Send_Ptr[nHalo_Neighbor]];
+  Halo_Recv_Point = new unsigned long [Halo_Recv_Ptr[nHalo_Neighbor]];
+  Halo_Rotation   = new su2double [Halo_Recv_Ptr[nHalo_Neighbor]*9];
+  
+  iSend = 0; iRecv = 0;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+      
+      for (iVertex = 0; iVertex < nVertex[MarkerS]; iVertex++, iSend++)
+        Halo_Send_Point[iSend] = vertex[MarkerS][iVertex]->GetNode();
+      
+      for (iVertex = 0; iVertex < nVertex[MarkerR]; iVertex++, iRecv++) {
+        Halo_Recv_Point[iRecv] = vertex[MarkerR][iVertex]->GetNode();
+        
+        /*--- Compute the rotation matrix. Note that the implicit
+         ordering is rotation about the x-axis, y-axis,
+         then z-axis. Note that this is the transpose of the matrix
+         used during the preprocessing stage. ---*/
+        
+        iPeriodic_Index = vertex[MarkerR][iVertex]->GetRotation_Type();
+        angles = config->GetPeriodicRotation(iPeriodic_Index);
+        
+        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
+        
+        rotMatrix = &Halo_Rotation[iRecv*9];
+        rotMatrix[0] = cosPhi*cosPsi;    rotMatrix[3] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[6] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+        rotMatrix[1] = cosPhi*sinPsi;    rotMatrix[4] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[7] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+        rotMatrix[2] = -sinPhi;          rotMatrix[5] = sinTheta*cosPhi;                              rotMatrix[8] = cosTheta*cosPhi;
+      }
+    }
+  }
+  
+  /*--- The edges next to the received points are computed once the exchange is complete ---*/
+  
+  if (Edge_Color_Ptr != NULL) SetEdge_Color_Split();
+  
+}
+
+void CGeometry::SetLSGradient_Weights(void) {
+  
+  unsigned short iDim, jDim, iNeigh;
+  unsigned long iPoint, jPoint, nNeigh;
+  su2double *Coord_i, *Coord_j, *Weight, Delta[3], Smatrix[3][3], r11, r12, r13, r22, r23, r23_a,
+  r23_b, r33, weight, detR2, z11, z12, z13, z22, z23, z33;
+  bool singular;
+  
+  /*--- The least-squares matrix of a point only depends on the coordinates, the
+   inverse is folded with the neighbor distances so that computing a gradient is a
+   single sweep over the neighbors. Recomputed whenever the dual grid is updated. ---*/
+  
+  if (Point_LSWeight_Begin == NULL) Point_LSWeight_Begin = new unsigned long [nPointDomain+1];
+  
+  nNeigh = 0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Point_LSWeight_Begin[iPoint] = nNeigh;
+    nNeigh += node[iPoint]->GetnPoint();
+  }
+  Point_LSWeight_Begin[nPointDomain] = nNeigh;
+  
+  if (Point_LSWeight != NULL) delete [] Point_LSWeight;
+  Point_LSWeight = new su2double [nNeigh*nDim];
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    Coord_i = node[iPoint]->GetCoord();
+    
+    r11 = 0.0; r12 = 0.0;   r13 = 0.0;    r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0;  r33 = 0.0;
+    
+    /*--- Sumations for entries of upper triangular matrix R ---*/
+    
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      
+      if (weight != 0.0) {
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13   += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33   += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+      }
+    }
+    
+    /*--- Entries of upper triangular matrix R ---*/
+    
+    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
+    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
+    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
+    
+    if (nDim == 3) {
+      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
+      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
+      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
+    }
+    
+    /*--- Compute determinant and detect singular matrices ---*/
+    
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+    
+    singular = false;
+    if (abs(detR2) <= EPS) { detR2 = 1.0; singular = true; }
+    
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+    
+    if (singular) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        for (jDim = 0; jDim < nDim; jDim++)
+          Smatrix[iDim][jDim] = 0.0;
+    }
+    else {
+      if (nDim == 2) {
+        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+        Smatrix[0][1] = -r11*r12/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = r11*r11/detR2;
+      }
+      else {
+        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+        Smatrix[0][2] = (z13*z33)/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+        Smatrix[1][2] = (z23*z33)/detR2;
+        Smatrix[2][0] = Smatrix[0][2];
+        Smatrix[2][1] = Smatrix[1][2];
+        Smatrix[2][2] = (z33*z33)/detR2;
+      }
+    }
+    
+    /*--- Weight of each neighbor := S*(Coord_j-Coord_i)/|Coord_j-Coord_i|^2 ---*/
+    
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      Weight = &Point_LSWeight[(Point_LSWeight_Begin[iPoint]+iNeigh)*nDim];
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Delta[iDim] = Coord_j[iDim]-Coord_i[iDim];
+        weight += Delta[iDim]*Delta[iDim];
+      }
+      
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Weight[iDim] = 0.0;
+        if (weight != 0.0)
+          for (jDim = 0; jDim < nDim; jDim++)
+            Weight[iDim] += Smatrix[iDim][jDim]*Delta[jDim]/weight;
+      }
+    }
+    
+  }
+  
+  LSWeight_Valid = true;
+  
+}
+
 void CGeometry::SetFaces(void) {
   //	unsigned long iPoint, jPoint, iFace;
   //	unsigned short jNode, iNode;
@@ -1954,6 +2356,9 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
     case CGNS:
       Read_CGNS_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      Read_SU2_Binary_Format_Parallel(config, val_mesh_filename, val_iZone, val_nZone);
+      break;
     default:
       SU2_MPI::Error("Unrecognized mesh format specified!", CURRENT_FUNCTION);
       break;
@@ -8572,6 +8977,11 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
                           ((config->GetKind_SU2() == SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
   if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
 
+  /*--- Unless the actuator disk surfaces must be split, read the points
+   and the elements in parallel from a memory map of the file. ---*/
+  
+  if (!actuator_disk && Read_SU2_Format_Mapped(config, val_mesh_filename, val_iZone, val_nZone)) return;
+  
   nZone = val_nZone;
   
   /*--- Initialize some additional counters for the parallel partitioning ---*/
@@ -9852,7 +10262,9 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
   unsigned long loc_adjc_size=0;
   vector<unsigned long> adjac_vec;
+  vector<idx_t> adjwgt_vec;
   unsigned long adj_elem_size;
+  bool weighted = config->GetPartition_Weights();
   
   xadj = new idx_t [npoint_procs[rank]+1];
   xadj[0]=0;
@@ -9862,7 +10274,10 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   /*--- Here, we transfer the adjacency information from a multi-dim vector
    on a node-by-node basis into a single vector container. First, we sort
    the entries and remove the duplicates we find for each node, then we
-   copy it into the single vect and clear memory from the multi-dim vec. ---*/
+   copy it into the single vect and clear memory from the multi-dim vec.
+   For the weighted partitioning, the number of repeats of a neighbor is the
+   number of elements that share the edge, i.e. the halo elements created
+   if the edge is cut. ---*/
   
   for (unsigned long i = 0; i < nPoint; i++) {
     
@@ -9871,6 +10286,12 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
     }
     
     sort(temp_adjacency.begin(), temp_adjacency.end());
+    if (weighted) {
+      for (j = 0; j < temp_adjacency.size(); j++) {
+        if ((j == 0) || (temp_adjacency[j] != temp_adjacency[j-1])) adjwgt_vec.push_back(1);
+        else adjwgt_vec.back()++;
+      }
+    }
     it = unique(temp_adjacency.begin(), temp_adjacency.end());
     loc_adjc_size = it - temp_adjacency.begin();
     
@@ -9894,12 +10315,19 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   adjacency = new idx_t [adj_elem_size];
   copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
   
+  adjwgt = NULL;
+  if (weighted) {
+    adjwgt = new idx_t [adj_elem_size];
+    copy(adjwgt_vec.begin(), adjwgt_vec.end(), adjwgt);
+  }
+  
   xadj_size = npoint_procs[rank]+1;
   adjacency_size = adj_elem_size;
   
   /*--- Free temporary memory used to build the adjacency. ---*/
   
   adjac_vec.clear();
+  adjwgt_vec.clear();
   adj_nodes.clear();
   
 #endif
@@ -10554,100 +10982,1387 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
 }
 
-void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
-  
-  /*--- Original CGNS reader implementation by Thomas D. Economon,
-   Francisco Palacios. Improvements for mixed-element meshes generated
-   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
-   Parallel version by Thomas D. Economon, February 2015. ---*/
-  
-#ifdef HAVE_CGNS
-    
-  string text_line, Marker_Tag;
-  ifstream mesh_file;
-  unsigned short VTK_Type = 0, iMarker = 0;
-  unsigned short nMarker_Max = config->GetnMarker_Max();
-  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
-  unsigned long globalOffset = 0;
-  nZone = val_nZone;
+bool CPhysicalGeometry::Read_SU2_Format_Mapped(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+#if !defined(_WIN32)
+  
+  unsigned short iMarker, iDim, iNode, nNode, iPeriodic, nPeriodic = 0, iSection;
+  unsigned long iPoint, iElem_Bound, iRecord, nElem_Bound_, GlobalIndex, VTK_Type, jDomain, number, nNumber;
+  unsigned long File_Size = 0, Zone_Begin = 0, Zone_End = 0, Keyword, Line_End, Range_Begin, Range_End, Range[2];
+  unsigned long Sections[8], Found_Offset[2] = {0, 0}, nLocal, First_Local, Width;
+  unsigned long Key_Offset[5];
+  int iProc, iSend, iRecv, nSends = 0, nRecvs = 0, map_ok = 1, map_ok_all = 1;
+  passivedouble Offsets[2] = {0.0, 0.0}, value;
+  su2double AoA_Current, AoS_Current;
+  const char *buf = NULL, *p, *q;
+  const char *Offset_Keyword[2] = {"AOA_OFFSET=", "AOS_OFFSET="};
+  const char *Section_Keyword[5] = {"NPOIN=", "NELEM=", "NMARK=", "NPERIODIC=", "FFD_NBOX="};
+  void *map = MAP_FAILED;
+  int fd;
+  struct stat file_stat;
+  string Marker_Tag;
+  bool harmonic_balance = config->GetUnsteady_Simulation() == HARMONIC_BALANCE;
   
-  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+  /*--- Map the whole file in every rank. If any of them cannot, fall
+   back to the reader that streams the file line by line. ---*/
   
-  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
-  su2double Coord_cgns[3] = {0.0,0.0,0.0};
-  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
-  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
-  int interiorElems = 0, totalVerts = 0;
-  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
-  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
-  char coordname[CGNS_STRING_SIZE];
-  cgsize_t* cgsize; cgsize = new cgsize_t[3];
-  ZoneType_t zonetype;
-  DataType_t datatype;
-  passivedouble** coordArray = NULL;
-  passivedouble*** gridCoords = NULL;
-  ElementType_t elemType;
-  cgsize_t range_min, range_max, startE, endE;
-  range_min = 1;
-  string currentElem;
-  int** elemTypeVTK = NULL;
-  int** elemIndex = NULL;
-  int** elemBegin = NULL;
-  int** elemEnd = NULL;
-  int** nElems = NULL;
-  cgsize_t**** connElems = NULL;
-  cgsize_t* connElemCGNS = NULL;
-  cgsize_t* connElemTemp = NULL;
-  cgsize_t ElementDataSize = 0;
-  cgsize_t* parentData = NULL;
-  int** dataSize = NULL;
-  bool** isInternal = NULL;
-  char*** sectionNames = NULL;
+  fd = open(val_mesh_filename.c_str(), O_RDONLY);
+  if ((fd < 0) || (fstat(fd, &file_stat) != 0) || (file_stat.st_size == 0)) map_ok = 0;
+  if (map_ok) {
+    File_Size = file_stat.st_size;
+    map = mmap(NULL, File_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) map_ok = 0;
+    else buf = static_cast<const char*>(map);
+  }
   
-  /*--- Initialize counters for local/global points & elements ---*/
-
 #ifdef HAVE_MPI
-  unsigned long Local_nElem;
-  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
-  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
-  SU2_MPI::Request *send_req, *recv_req;
-  SU2_MPI::Status  status;
-  int ind;
+  SU2_MPI::Allreduce(&map_ok, &map_ok_all, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#else
+  map_ok_all = map_ok;
 #endif
   
-  /*--- Initialize counters for local/global points & elements ---*/
-  
-  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
-  nelem_edge     = 0; Global_nelem_edge     = 0;
-  nelem_triangle = 0; Global_nelem_triangle = 0;
-  nelem_quad     = 0; Global_nelem_quad     = 0;
-  nelem_tetra    = 0; Global_nelem_tetra    = 0;
-  nelem_hexa     = 0; Global_nelem_hexa     = 0;
-  nelem_prism    = 0; Global_nelem_prism    = 0;
-  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
-  
-  /*--- Initialize some additional counters for the parallel partitioning ---*/
-  
-  unsigned long total_pt_accounted = 0;
-  unsigned long rem_points         = 0;
-  unsigned long element_count      = 0;
-  unsigned long element_remainder  = 0;
-  unsigned long total_elems        = 0;
-  
-  /*--- Allocate memory for the linear partitioning of the mesh. These
-   arrays are the size of the number of ranks. ---*/
+  if (!map_ok_all) {
+    if (map != MAP_FAILED) munmap(map, File_Size);
+    if (fd >= 0) close(fd);
+    return false;
+  }
   
-  starting_node = new unsigned long[size];
-  ending_node   = new unsigned long[size];
-  npoint_procs  = new unsigned long[size];
-  nPoint_Linear = new unsigned long[size+1];
-
-  unsigned long *nElem_Linear  = new unsigned long[size];
+  nZone = val_nZone;
   
-  unsigned long *elemB = new unsigned long[size];
-  unsigned long *elemE = new unsigned long[size];
+  vector<char> Marker_Tags;
+  vector<long> Marker_Info;
+  vector<unsigned long> Marker_Conn;
+  vector<passivedouble> Periodic_Data;
   
-  unsigned long *elemGlobalID = NULL;
+  /*--- The master locates the zone and the sections once, and reads the
+   markers and the periodic transformations, which every rank needs. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    Zone_Begin = 0; Zone_End = File_Size;
+    
+    /*--- If more than one, find the zone in the mesh file ---*/
+    
+    if (val_nZone > 1 && !harmonic_balance) {
+      Keyword = Find_Mesh_Keyword(buf, 0, File_Size, "IZONE=");
+      while (Keyword < File_Size) {
+        Parse_Mesh_ULong(buf+Keyword+6, buf+File_Size, jDomain);
+        if (jDomain == (unsigned long)val_iZone+1) {
+          cout << "Reading zone " << val_iZone+1 << "." << endl;
+          Zone_Begin = Keyword+6;
+          Zone_End   = Find_Mesh_Keyword(buf, Zone_Begin, File_Size, "IZONE=");
+          break;
+        }
+        Keyword = Find_Mesh_Keyword(buf, Keyword+6, File_Size, "IZONE=");
+      }
+    }
+    else if (harmonic_balance) {
+      cout << "Reading time instance " << val_iZone+1 << "." << endl;
+    }
+    
+    /*--- Only the first NDIME= belongs to this zone ---*/
+    
+    Keyword = Find_Mesh_Keyword(buf, Zone_Begin, Zone_End, "NDIME=");
+    if (Keyword == Zone_End) {
+      SU2_MPI::Error(string("NDIME= not found in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+    }
+    Parse_Mesh_ULong(buf+Keyword+6, buf+Zone_End, number);
+    Sections[0] = number;
+    Keyword = Find_Mesh_Keyword(buf, Keyword+6, Zone_End, "NDIME=");
+    if (Keyword < Zone_End) Zone_End = Keyword;
+    
+    for (iSection = 0; iSection < 2; iSection++) {
+      Keyword = Find_Mesh_Keyword(buf, Zone_Begin, Zone_End, Offset_Keyword[iSection]);
+      if (Keyword < Zone_End) {
+        Parse_Mesh_Double(buf+Keyword+11, buf+Zone_End, Offsets[iSection]);
+        Found_Offset[iSection] = 1;
+      }
+    }
+    
+    for (iSection = 0; iSection < 5; iSection++)
+      Key_Offset[iSection] = Find_Mesh_Keyword(buf, Zone_Begin, Zone_End, Section_Keyword[iSection]);
+    
+    if ((Key_Offset[0] == Zone_End) || (Key_Offset[1] == Zone_End)) {
+      SU2_MPI::Error(string("NPOIN= or NELEM= not found in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+    }
+    
+    /*--- Number of points (and possible ghost points) and elements. The
+     data of a section ends at the line of the next keyword. ---*/
+    
+    q = Parse_Mesh_ULong(buf+Key_Offset[0]+6, buf+Zone_End, Sections[1]);
+    if (q == NULL) {
+      SU2_MPI::Error("NPOIN improperly specified", CURRENT_FUNCTION);
+    }
+    if (Parse_Mesh_ULong(q, buf+Zone_End, Sections[2]) == NULL) Sections[2] = Sections[1];
+    Parse_Mesh_ULong(buf+Key_Offset[1]+6, buf+Zone_End, Sections[3]);
+    
+    for (iSection = 0; iSection < 2; iSection++) {
+      p = static_cast<const char*>(memchr(buf+Key_Offset[iSection], '\n', Zone_End-Key_Offset[iSection]));
+      Range_Begin = (p == NULL)? Zone_End : p+1-buf;
+      Range_End = Zone_End;
+      for (iMarker = 0; iMarker < 5; iMarker++)
+        if ((Key_Offset[iMarker] > Key_Offset[iSection]) && (Key_Offset[iMarker] < Range_End))
+          Range_End = Key_Offset[iMarker];
+      
+      /*--- A range that stops at a keyword ends with the last complete line before
+       it, at the end of the file the last line may have no newline ---*/
+      
+      if (Range_End < File_Size)
+        while ((Range_End > Range_Begin) && (buf[Range_End-1] != '\n')) Range_End--;
+      Sections[4+2*iSection] = Range_Begin;
+      Sections[5+2*iSection] = Range_End;
+    }
+    
+    /*--- Boundary markers, as records of the type and the nodes (or the
+     node and the transformation of a SEND_RECEIVE vertex). ---*/
+    
+    if (Key_Offset[2] < Zone_End) {
+      
+      Parse_Mesh_ULong(buf+Key_Offset[2]+6, buf+Zone_End, number);
+      p = buf+Key_Offset[2];
+      Width = 1+N_POINTS_QUADRILATERAL;
+      
+      for (iMarker = 0; iMarker < number; iMarker++) {
+        
+        Keyword = Find_Mesh_Keyword(buf, p-buf, Zone_End, "MARKER_TAG=");
+        if (Keyword == Zone_End) {
+          SU2_MPI::Error(string("MARKER_TAG= not found in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+        }
+        Marker_Tag.clear();
+        for (q = buf+Keyword+11; (q < buf+Zone_End) && (*q != '\n'); q++)
+          if ((*q != ' ') && (*q != '\t') && (*q != '\r')) Marker_Tag += *q;
+        Marker_Tag.resize(min(Marker_Tag.size(), (size_t)MAX_STRING_SIZE-1));
+        Marker_Tags.resize((iMarker+1)*MAX_STRING_SIZE, '\0');
+        copy(Marker_Tag.begin(), Marker_Tag.end(), Marker_Tags.begin()+iMarker*MAX_STRING_SIZE);
+        
+        Keyword = Find_Mesh_Keyword(buf, q-buf, Zone_End, "MARKER_ELEMS=");
+        Parse_Mesh_ULong(buf+Keyword+13, buf+Zone_End, nElem_Bound_);
+        Marker_Info.push_back(nElem_Bound_);
+        Marker_Info.push_back(Width);
+        p = static_cast<const char*>(memchr(buf+Keyword, '\n', Zone_End-Keyword));
+        
+        if (Marker_Tag == "SEND_RECEIVE") {
+          Keyword = Find_Mesh_Keyword(buf, Keyword, Zone_End, "SEND_TO=");
+          q = buf+Keyword+8;
+          while ((q < buf+Zone_End) && ((*q == ' ') || (*q == '\t'))) q++;
+          Marker_Info.push_back(atol(string(q, min((unsigned long)(buf+Zone_End-q), (unsigned long)20)).c_str()));
+          p = static_cast<const char*>(memchr(buf+Keyword, '\n', Zone_End-Keyword));
+        }
+        else Marker_Info.push_back(NONE);
+        
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+          p = (p == NULL)? NULL : p+1;
+          if (p == NULL || p >= buf+Zone_End) {
+            SU2_MPI::Error(string("Not enough boundary elements in marker ") + Marker_Tag, CURRENT_FUNCTION);
+          }
+          q = Parse_Mesh_ULong(p, buf+Zone_End, VTK_Type);
+          nNode = (VTK_Type == VERTEX)? 2 : (VTK_Type == LINE)? N_POINTS_LINE :
+                  (VTK_Type == TRIANGLE)? N_POINTS_TRIANGLE : N_POINTS_QUADRILATERAL;
+          Marker_Conn.push_back(VTK_Type);
+          for (iRecord = 1; iRecord < Width; iRecord++) {
+            number = 0;
+            if (iRecord <= nNode) q = Parse_Mesh_ULong(q, buf+Zone_End, number);
+            Marker_Conn.push_back(number);
+          }
+          p = static_cast<const char*>(memchr(p, '\n', buf+Zone_End-p));
+        }
+        if (p == NULL) p = buf+Zone_End-1;
+      }
+    }
+    
+    /*--- Periodic transformations (center, rotation and translation) ---*/
+    
+    if (Key_Offset[3] < Zone_End) {
+      Parse_Mesh_ULong(buf+Key_Offset[3]+10, buf+Zone_End, number);
+      nPeriodic = number;
+      p = buf+Key_Offset[3];
+      for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+        Keyword = Find_Mesh_Keyword(buf, p-buf, Zone_End, "PERIODIC_INDEX=");
+        Parse_Mesh_ULong(buf+Keyword+15, buf+Zone_End, number);
+        if (number != iPeriodic) {
+          SU2_MPI::Error("PERIODIC_INDEX out of order in SU2 file!!", CURRENT_FUNCTION);
+        }
+        p = buf+Keyword;
+        for (iSection = 0; iSection < 3; iSection++) {
+          p = static_cast<const char*>(memchr(p, '\n', buf+Zone_End-p));
+          if (p == NULL) {
+            SU2_MPI::Error("Incomplete periodic transformation in SU2 file!!", CURRENT_FUNCTION);
+          }
+          q = ++p;
+          for (iDim = 0; iDim < 3; iDim++) {
+            value = 0.0;
+            if (q != NULL) q = Parse_Mesh_Double(q, buf+Zone_End, value);
+            Periodic_Data.push_back(value);
+          }
+        }
+      }
+    }
+    
+  }
+  
+  /*--- Broadcast what the master found ---*/
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(Sections, 8, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(Offsets, 2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(Found_Offset, 2, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  unsigned long nMarker_Conn = Marker_Conn.size();
+  number = Marker_Info.size()/3;
+  nPeriodic = Periodic_Data.size()/9;
+  SU2_MPI::Bcast(&nMarker_Conn, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(&number, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(&nPeriodic, 1, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
+  if (rank != MASTER_NODE) {
+    Marker_Tags.resize(number*MAX_STRING_SIZE);
+    Marker_Info.resize(number*3);
+    Marker_Conn.resize(nMarker_Conn);
+    Periodic_Data.resize(nPeriodic*9);
+  }
+  if (number > 0) {
+    SU2_MPI::Bcast(&Marker_Tags[0], number*MAX_STRING_SIZE, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&Marker_Info[0], number*3, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  }
+  if (nMarker_Conn > 0)
+    SU2_MPI::Bcast(&Marker_Conn[0], nMarker_Conn, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  if (nPeriodic > 0)
+    SU2_MPI::Bcast(&Periodic_Data[0], nPeriodic*9, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Read the dimension of the problem ---*/
+  
+  nDim = Sections[0];
+  if (rank == MASTER_NODE) {
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
+  }
+  
+  /*--- Offsets of the angle of attack and sideslip, in deg ---*/
+  
+  if (Found_Offset[0]) {
+    AoA_Current = config->GetAoA() + Offsets[0];
+    if (config->GetDiscard_InFiles() == false) {
+      if ((rank == MASTER_NODE) && (Offsets[0] != 0.0))  {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+        cout << "         AoA offset in mesh file (" << Offsets[0] << " deg.) = " << AoA_Current << " deg." << endl;
+      }
+      config->SetAoA_Offset(Offsets[0]);
+      config->SetAoA(AoA_Current);
+    }
+    else {
+      if ((rank == MASTER_NODE) && (Offsets[0] != 0.0))
+        cout <<"WARNING: Discarding the AoA offset in the geometry file." << endl;
+    }
+  }
+  
+  if (Found_Offset[1]) {
+    AoS_Current = config->GetAoS() + Offsets[1];
+    if (config->GetDiscard_InFiles() == false) {
+      if ((rank == MASTER_NODE) && (Offsets[1] != 0.0))  {
+        cout.precision(6);
+        cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+        cout << "         AoS offset in mesh file (" << Offsets[1] << " deg.) = " << AoS_Current << " deg." << endl;
+      }
+      config->SetAoS_Offset(Offsets[1]);
+      config->SetAoS(AoS_Current);
+    }
+    else {
+      if ((rank == MASTER_NODE) && (Offsets[1] != 0.0))
+        cout <<"WARNING: Discarding the AoS offset in the geometry file." << endl;
+    }
+  }
+  
+  /*--- Number of points and possible ghost points ---*/
+  
+  Global_nPoint  = Sections[1]; Global_nPointDomain = Sections[2]; Global_nElem = Sections[3]; Global_nElemDomain = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+  
+  if (rank == MASTER_NODE && size > SINGLE_NODE) {
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    cout << " ghost points before parallel partitioning." << endl;
+  } else if (rank == MASTER_NODE) {
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    cout << " ghost points." << endl;
+  }
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
+  
+  /*--- Linear partitioning of the points, with the remainder points
+   on the first ranks, as in the streaming reader. ---*/
+  
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  nPoint_Linear = new unsigned long[size+1];
+  
+  for (iProc = 0; iProc < size; iProc++)
+    npoint_procs[iProc] = Global_nPoint/size + ((unsigned long)iProc < Global_nPoint%size);
+  
+  starting_node[0] = 0;
+  ending_node[0]   = npoint_procs[0];
+  nPoint_Linear[0] = 0;
+  for (iProc = 1; iProc < size; iProc++) {
+    starting_node[iProc] = ending_node[iProc-1];
+    ending_node[iProc]   = starting_node[iProc] + npoint_procs[iProc];
+    nPoint_Linear[iProc] = nPoint_Linear[iProc-1] + npoint_procs[iProc-1];
+  }
+  nPoint_Linear[size] = Global_nPoint;
+  
+  nPoint = npoint_procs[rank];
+  nPointDomain = nPoint;
+  nPointNode = nPoint;
+  
+  /*--- Each rank parses an even share of the bytes of the points and of
+   the elements, starting at the first line that begins in its share.
+   The global index of the first line comes from the counts of the
+   lower ranks. ---*/
+  
+  unsigned long *nLocal_All = new unsigned long[size];
+  vector<su2double> Coord_Local;
+  vector<unsigned long> Elem_Local;
+  
+  for (iSection = 0; iSection < 2; iSection++) {
+    
+    for (iSend = 0; iSend < 2; iSend++) {
+      Range_Begin = Sections[4+2*iSection];
+      Range_End   = Sections[5+2*iSection];
+      Range[iSend] = Range_Begin + (unsigned long)((double(Range_End-Range_Begin)*(rank+iSend))/size);
+      if (rank+iSend == size) Range[iSend] = Range_End;
+      while ((Range[iSend] > Range_Begin) && (Range[iSend] < Range_End) && (buf[Range[iSend]-1] != '\n'))
+        Range[iSend]++;
+    }
+    
+    nLocal = 0;
+    p = buf+Range[0];
+    while (p < buf+Range[1]) {
+      q = static_cast<const char*>(memchr(p, '\n', buf+Range[1]-p));
+      Line_End = (q == NULL)? Range[1] : q-buf;
+      
+      if (iSection == 0) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          if (p != NULL) p = Parse_Mesh_Double(p, buf+Line_End, value);
+          if (p == NULL) break;
+          Coord_Local.push_back(value);
+        }
+        if (iDim == nDim) nLocal++;
+        else if (iDim > 0) {
+          SU2_MPI::Error(string("Incomplete point coordinates in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+        }
+      }
+      else {
+        p = Parse_Mesh_ULong(p, buf+Line_End, VTK_Type);
+        if (p != NULL) {
+          switch(VTK_Type) {
+            case TRIANGLE:      nNode = N_POINTS_TRIANGLE;      break;
+            case QUADRILATERAL: nNode = N_POINTS_QUADRILATERAL; break;
+            case TETRAHEDRON:   nNode = N_POINTS_TETRAHEDRON;   break;
+            case HEXAHEDRON:    nNode = N_POINTS_HEXAHEDRON;    break;
+            case PRISM:         nNode = N_POINTS_PRISM;         break;
+            case PYRAMID:       nNode = N_POINTS_PYRAMID;       break;
+            default:
+              SU2_MPI::Error(string("Unknown element type in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+              nNode = 0; break;
+          }
+          Elem_Local.push_back(VTK_Type);
+          for (iNode = 0; iNode < N_POINTS_HEXAHEDRON; iNode++) {
+            number = 0;
+            if ((iNode < nNode) && (p != NULL)) p = Parse_Mesh_ULong(p, buf+Line_End, number);
+            Elem_Local.push_back(number);
+          }
+          if (p == NULL) {
+            SU2_MPI::Error(string("Incomplete element connectivity in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+          }
+          nLocal++;
+        }
+      }
+      
+      p = buf+Line_End+1;
+    }
+    
+    SU2_MPI::Allgather(&nLocal, 1, MPI_UNSIGNED_LONG, nLocal_All, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+    nNumber = 0; First_Local = 0;
+    for (iProc = 0; iProc < size; iProc++) {
+      if (iProc == rank) First_Local = nNumber;
+      nNumber += nLocal_All[iProc];
+    }
+    
+    if (nNumber != ((iSection == 0)? Global_nPoint : Global_nElem)) {
+      SU2_MPI::Error(string("The number of ") + string((iSection == 0)? "points" : "elements") +
+                     string(" does not match the header in the mesh file ") + val_mesh_filename, CURRENT_FUNCTION);
+    }
+    
+    /*--- The elements go to the ranks that own their nodes ---*/
+    
+    if (iSection == 1) {
+      if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+        cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+      Distribute_Elements_Linear(config, (nLocal > 0)? &Elem_Local[0] : NULL, nLocal, First_Local, 1+N_POINTS_HEXAHEDRON);
+      break;
+    }
+    
+    /*--- The parsed points and the linear partition are both contiguous
+     ranges of global indices, send the overlaps to their owners. ---*/
+    
+    int *nPoint_Send = new int[size+1]; nPoint_Send[0] = 0;
+    int *nPoint_Recv = new int[size+1]; nPoint_Recv[0] = 0;
+    
+    nNumber = 0;
+    for (iProc = 0; iProc < size; iProc++) {
+      Range_Begin = max(First_Local, starting_node[iProc]);
+      Range_End   = min(First_Local+nLocal, ending_node[iProc]);
+      nPoint_Send[iProc+1] = (Range_End > Range_Begin)? int(Range_End-Range_Begin) : 0;
+      Range_Begin = max(nNumber, starting_node[rank]);
+      Range_End   = min(nNumber+nLocal_All[iProc], ending_node[rank]);
+      nPoint_Recv[iProc+1] = (Range_End > Range_Begin)? int(Range_End-Range_Begin) : 0;
+      nNumber += nLocal_All[iProc];
+      if ((iProc != rank) && (nPoint_Send[iProc+1] > 0)) nSends++;
+      if ((iProc != rank) && (nPoint_Recv[iProc+1] > 0)) nRecvs++;
+    }
+    for (iProc = 0; iProc < size; iProc++) {
+      nPoint_Send[iProc+1] += nPoint_Send[iProc];
+      nPoint_Recv[iProc+1] += nPoint_Recv[iProc];
+    }
+    
+    su2double *Coord_Recv = new su2double[nPoint*nDim];
+    
+    SU2_MPI::Request *pointSendReq = NULL, *pointRecvReq = NULL;
+    if (nSends > 0) pointSendReq = new SU2_MPI::Request[nSends];
+    if (nRecvs > 0) pointRecvReq = new SU2_MPI::Request[nRecvs];
+    
+    InitiateComms((nLocal > 0)? &Coord_Local[0] : NULL, nPoint_Send, pointSendReq,
+                  Coord_Recv, nPoint_Recv, pointRecvReq,
+                  nDim, COMM_TYPE_DOUBLE);
+    
+    /*--- Copy my own rank's data into the recv buffer directly. ---*/
+    
+    iRecv = nPoint_Recv[rank];
+    for (iSend = nPoint_Send[rank]; iSend < nPoint_Send[rank+1]; iSend++) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coord_Recv[iRecv*nDim+iDim] = Coord_Local[iSend*nDim+iDim];
+      iRecv++;
+    }
+    
+    CompleteComms(nSends, pointSendReq, nRecvs, pointRecvReq);
+    
+    if (pointSendReq != NULL) delete [] pointSendReq;
+    if (pointRecvReq != NULL) delete [] pointRecvReq;
+    delete [] nPoint_Send;
+    delete [] nPoint_Recv;
+    vector<su2double>().swap(Coord_Local);
+    
+    /*--- Create the points of the linear partition ---*/
+    
+    node = new CPoint*[nPoint];
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      GlobalIndex = starting_node[rank] + iPoint;
+      if (nDim == 2)
+        node[iPoint] = new CPoint(Coord_Recv[iPoint*nDim], Coord_Recv[iPoint*nDim+1], GlobalIndex, config);
+      else
+        node[iPoint] = new CPoint(Coord_Recv[iPoint*nDim], Coord_Recv[iPoint*nDim+1], Coord_Recv[iPoint*nDim+2], GlobalIndex, config);
+    }
+    delete [] Coord_Recv;
+    
+  }
+  
+  delete [] nLocal_All;
+  vector<unsigned long>().swap(Elem_Local);
+  
+  munmap(map, File_Size);
+  close(fd);
+  
+  /*--- Boundary markers and periodic transformations ---*/
+  
+  Set_Markers_Linear(config, Marker_Tags, Marker_Info, Marker_Conn, Periodic_Data);
+  
+  return true;
+  
+#else
+  
+  /*--- There is no mmap on Windows, every rank returns before any
+   collective call and the file is streamed line by line instead. ---*/
+  
+  return false;
+  
+#endif
+  
+}
+
+unsigned long CPhysicalGeometry::Find_Mesh_Keyword(const char *val_buffer, unsigned long val_begin,
+                                                   unsigned long val_end, const char *val_keyword) {
+  
+  const char *p = val_buffer+val_begin, *end = val_buffer+val_end;
+  size_t length = strlen(val_keyword);
+  
+  /*--- The numeric lines never contain the first (capital) letter of the
+   keywords, hence memchr skips them quickly. ---*/
+  
+  while (p+length <= end) {
+    p = static_cast<const char*>(memchr(p, val_keyword[0], end-p));
+    if ((p == NULL) || (p+length > end)) break;
+    if (strncmp(p, val_keyword, length) == 0) return p-val_buffer;
+    p++;
+  }
+  
+  return val_end;
+  
+}
+
+const char* CPhysicalGeometry::Parse_Mesh_ULong(const char *val_begin, const char *val_end, unsigned long &val_number) {
+  
+  const char *p = val_begin;
+  
+  while ((p < val_end) && ((*p == ' ') || (*p == '\t') || (*p == '\r'))) p++;
+  if ((p == val_end) || (*p < '0') || (*p > '9')) return NULL;
+  
+  val_number = 0;
+  while ((p < val_end) && (*p >= '0') && (*p <= '9')) {
+    val_number = 10*val_number + (*p-'0');
+    p++;
+  }
+  
+  return p;
+  
+}
+
+const char* CPhysicalGeometry::Parse_Mesh_Double(const char *val_begin, const char *val_end, passivedouble &val_number) {
+  
+  static const passivedouble Power_10[23] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                             1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                             1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  const char *p = val_begin, *start;
+  unsigned long long mantissa = 0;
+  int nDigits = 0, exponent = 0, exp_value = 0;
+  bool negative = false, exp_negative = false, digits = false;
+  char token[64];
+  
+  while ((p < val_end) && ((*p == ' ') || (*p == '\t') || (*p == '\r'))) p++;
+  start = p;
+  
+  if ((p < val_end) && ((*p == '-') || (*p == '+'))) { negative = (*p == '-'); p++; }
+  
+  /*--- Integer and fractional parts, the leading zeros are not significant ---*/
+  
+  for (; (p < val_end) && (*p >= '0') && (*p <= '9'); p++) {
+    digits = true;
+    if ((nDigits == 0) && (*p == '0')) continue;
+    if (nDigits < 19) { mantissa = 10*mantissa + (*p-'0'); nDigits++; }
+    else { exponent++; nDigits++; }
+  }
+  if ((p < val_end) && (*p == '.')) {
+    for (p++; (p < val_end) && (*p >= '0') && (*p <= '9'); p++) {
+      digits = true;
+      if ((nDigits == 0) && (*p == '0')) { exponent--; continue; }
+      if (nDigits < 19) { mantissa = 10*mantissa + (*p-'0'); nDigits++; exponent--; }
+      else nDigits++;
+    }
+  }
+  if (!digits) return NULL;
+  
+  if ((p < val_end) && ((*p == 'e') || (*p == 'E'))) {
+    p++;
+    if ((p < val_end) && ((*p == '-') || (*p == '+'))) { exp_negative = (*p == '-'); p++; }
+    for (; (p < val_end) && (*p >= '0') && (*p <= '9'); p++)
+      if (exp_value < 10000) exp_value = 10*exp_value + (*p-'0');
+    exponent += exp_negative? -exp_value : exp_value;
+  }
+  
+  /*--- When the mantissa and the power of 10 are both exact doubles, a
+   single product or quotient is correctly rounded. Otherwise use the
+   (slower) library conversion. ---*/
+  
+  while ((nDigits > 0) && (nDigits <= 19) && (mantissa % 10 == 0) && (mantissa > 0)) {
+    mantissa /= 10; nDigits--; exponent++;
+  }
+  
+  if ((nDigits <= 19) && (mantissa <= (1ULL << 53)) && (exponent >= -22) && (exponent <= 22)) {
+    val_number = passivedouble(mantissa);
+    if (exponent < 0) val_number /= Power_10[-exponent];
+    else val_number *= Power_10[exponent];
+    if (negative) val_number = -val_number;
+  }
+  else {
+    size_t length = min((size_t)(p-start), sizeof(token)-1);
+    strncpy(token, start, length); token[length] = '\0';
+    val_number = strtod(token, NULL);
+  }
+  
+  return p;
+  
+}
+
+void CPhysicalGeometry::Read_SU2_Binary_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  unsigned short iMarker, jZone, iZone_File;
+  unsigned long iPoint, GlobalIndex, nElem_Slab, Elem_Begin, Elem_Width;
+  unsigned long Header[SU2_BINARY_MESH_HEADER], Zone_Disp = 0, Coord_Disp, Elem_Disp, Marker_Disp, nMarker_Conn = 0;
+  int iProc;
+  char fname[MAX_STRING_SIZE];
+  passivedouble Offsets[2] = {0.0, 0.0};
+  su2double AoA_Current, AoS_Current;
+  FILE *fhw = NULL;
+  size_t ret;
+  bool harmonic_balance = config->GetUnsteady_Simulation() == HARMONIC_BALANCE;
+  bool actuator_disk  = (((config->GetnMarker_ActDiskInlet() != 0) ||
+                          (config->GetnMarker_ActDiskOutlet() != 0)) &&
+                         ((config->GetKind_SU2() == SU2_CFD) ||
+                          ((config->GetKind_SU2() == SU2_DEF) && (config->GetActDisk_SU2_DEF()))));
+  if (config->GetActDisk_DoubleSurface()) actuator_disk = false;
+  
+  nZone = val_nZone;
+  
+  /*--- The actuator disk surfaces are split while the ASCII file is read. ---*/
+  
+  if (actuator_disk) {
+    SU2_MPI::Error(string("The actuator disk surfaces can only be split when reading an ASCII SU2 mesh.\n") +
+                   string("Please set MESH_FORMAT= SU2 and try again."), CURRENT_FUNCTION);
+  }
+  
+  /*--- Each zone of the file is stored as: the header (ID, number of zones, nDim,
+   nPoint, nPointDomain, nElem, width of the element records, nMarker, nPeriodic
+   and size of the zone in bytes), the angle of attack and sideslip offsets, the
+   coordinates, the element records (VTK type and nodes, padded to a fixed width),
+   the markers (tag, number of elements, record width, SEND_TO and the records)
+   and the periodic transformations (center, rotation and translation). ---*/
+  
+  strcpy(fname, val_mesh_filename.c_str());
+  
+  vector<char> Marker_Tags;
+  vector<long> Marker_Info;
+  vector<unsigned long> Marker_Conn;
+  vector<passivedouble> Periodic_Data;
+  
+  /*--- The master reads the data that every rank needs (header, markers and
+   periodic transformations) and broadcasts it. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    fhw = fopen(fname, "rb");
+    if (!fhw) {
+      SU2_MPI::Error(string("Unable to open binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+    }
+    
+    /*--- If more than one, skip the zones that precede this one ---*/
+    
+    iZone_File = ((val_nZone > 1) && !harmonic_balance)? val_iZone : 0;
+    for (jZone = 0; jZone <= iZone_File; jZone++) {
+      if (jZone > 0) Zone_Disp += Header[9];
+      fseek(fhw, Zone_Disp, SEEK_SET);
+      ret = fread(Header, sizeof(unsigned long), SU2_BINARY_MESH_HEADER, fhw);
+      if ((ret != SU2_BINARY_MESH_HEADER) || (Header[0] != SU2_BINARY_MESH_ID)) {
+        SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 mesh file."), CURRENT_FUNCTION);
+      }
+    }
+    
+    ret = fread(Offsets, sizeof(passivedouble), 2, fhw);
+    
+    /*--- Skip the coordinates and the elements to reach the markers ---*/
+    
+    Marker_Disp = Zone_Disp + SU2_BINARY_MESH_HEADER*sizeof(unsigned long) + 2*sizeof(passivedouble) +
+                  Header[3]*Header[2]*sizeof(passivedouble) + Header[5]*Header[6]*sizeof(unsigned long);
+    fseek(fhw, Marker_Disp, SEEK_SET);
+    
+    Marker_Tags.resize(Header[7]*MAX_STRING_SIZE);
+    Marker_Info.resize(Header[7]*3);
+    for (iMarker = 0; iMarker < Header[7]; iMarker++) {
+      ret = fread(&Marker_Tags[iMarker*MAX_STRING_SIZE], sizeof(char), MAX_STRING_SIZE, fhw);
+      ret = fread(&Marker_Info[iMarker*3], sizeof(long), 3, fhw);
+      Marker_Conn.resize(nMarker_Conn + Marker_Info[iMarker*3]*Marker_Info[iMarker*3+1]);
+      if (Marker_Conn.size() > nMarker_Conn) {
+        ret = fread(&Marker_Conn[nMarker_Conn], sizeof(unsigned long), Marker_Conn.size()-nMarker_Conn, fhw);
+        if (ret != Marker_Conn.size()-nMarker_Conn) {
+          SU2_MPI::Error(string("Error reading the markers of the binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+        }
+      }
+      nMarker_Conn = Marker_Conn.size();
+    }
+    
+    Periodic_Data.resize(Header[8]*9);
+    if (Header[8] > 0) {
+      ret = fread(&Periodic_Data[0], sizeof(passivedouble), Header[8]*9, fhw);
+      if (ret != Header[8]*9) {
+        SU2_MPI::Error(string("Error reading the periodic transformations of the binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+      }
+    }
+    
+  }
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(Header, SU2_BINARY_MESH_HEADER, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(&Zone_Disp, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(Offsets, 2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(&nMarker_Conn, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  if (rank != MASTER_NODE) {
+    Marker_Tags.resize(Header[7]*MAX_STRING_SIZE);
+    Marker_Info.resize(Header[7]*3);
+    Marker_Conn.resize(nMarker_Conn);
+    Periodic_Data.resize(Header[8]*9);
+  }
+  if (Header[7] > 0) {
+    SU2_MPI::Bcast(&Marker_Tags[0], Header[7]*MAX_STRING_SIZE, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&Marker_Info[0], Header[7]*3, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  }
+  if (nMarker_Conn > 0)
+    SU2_MPI::Bcast(&Marker_Conn[0], nMarker_Conn, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  if (Header[8] > 0)
+    SU2_MPI::Bcast(&Periodic_Data[0], Header[8]*9, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Read the dimension of the problem ---*/
+  
+  nDim = Header[2];
+  if (rank == MASTER_NODE) {
+    if (nDim == 2) cout << "Two dimensional problem." << endl;
+    if (nDim == 3) cout << "Three dimensional problem." << endl;
+  }
+  
+  /*--- Offsets of the angle of attack and sideslip, in deg ---*/
+  
+  if (config->GetDiscard_InFiles() == false) {
+    AoA_Current = config->GetAoA() + Offsets[0];
+    AoS_Current = config->GetAoS() + Offsets[1];
+    if ((rank == MASTER_NODE) && (Offsets[0] != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoA in the config file (" << config->GetAoA() << " deg.) +" << endl;
+      cout << "         AoA offset in mesh file (" << Offsets[0] << " deg.) = " << AoA_Current << " deg." << endl;
+    }
+    if ((rank == MASTER_NODE) && (Offsets[1] != 0.0))  {
+      cout.precision(6);
+      cout << fixed <<"WARNING: AoS in the config file (" << config->GetAoS() << " deg.) +" << endl;
+      cout << "         AoS offset in mesh file (" << Offsets[1] << " deg.) = " << AoS_Current << " deg." << endl;
+    }
+    config->SetAoA_Offset(Offsets[0]); config->SetAoA(AoA_Current);
+    config->SetAoS_Offset(Offsets[1]); config->SetAoS(AoS_Current);
+  }
+  else {
+    if ((rank == MASTER_NODE) && ((Offsets[0] != 0.0) || (Offsets[1] != 0.0)))
+      cout <<"WARNING: Discarding the AoA and AoS offsets in the geometry file." << endl;
+  }
+  
+  /*--- Number of points and possible ghost points ---*/
+  
+  Global_nPoint  = Header[3]; Global_nPointDomain = Header[4]; Global_nElem = 0; Global_nElemDomain = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+  
+  if (rank == MASTER_NODE && size > SINGLE_NODE) {
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    cout << " ghost points before parallel partitioning." << endl;
+  } else if (rank == MASTER_NODE) {
+    cout << Global_nPointDomain << " points and " << Global_nPoint-Global_nPointDomain;
+    cout << " ghost points." << endl;
+  }
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Performing linear partitioning of the grid nodes." << endl;
+  
+  /*--- Linear partitioning of the points, with the remainder points
+   on the first ranks, as in the ASCII reader. ---*/
+  
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  nPoint_Linear = new unsigned long[size+1];
+  
+  for (iProc = 0; iProc < size; iProc++)
+    npoint_procs[iProc] = Global_nPoint/size + ((unsigned long)iProc < Global_nPoint%size);
+  
+  starting_node[0] = 0;
+  ending_node[0]   = npoint_procs[0];
+  nPoint_Linear[0] = 0;
+  for (iProc = 1; iProc < size; iProc++) {
+    starting_node[iProc] = ending_node[iProc-1];
+    ending_node[iProc]   = starting_node[iProc] + npoint_procs[iProc];
+    nPoint_Linear[iProc] = nPoint_Linear[iProc-1] + npoint_procs[iProc-1];
+  }
+  nPoint_Linear[size] = Global_nPoint;
+  
+  nPoint = npoint_procs[rank];
+  nPointDomain = nPoint;
+  nPointNode = nPoint;
+  
+  /*--- Slab of the elements of this rank ---*/
+  
+  Global_nElem = Header[5];
+  Elem_Width   = Header[6];
+  nElem_Slab   = Global_nElem/size + ((unsigned long)rank < Global_nElem%size);
+  Elem_Begin   = rank*(Global_nElem/size) + min((unsigned long)rank, Global_nElem%size);
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << Global_nElem << " interior elements before parallel partitioning." << endl;
+  
+  Coord_Disp = Zone_Disp + SU2_BINARY_MESH_HEADER*sizeof(unsigned long) + 2*sizeof(passivedouble);
+  Elem_Disp  = Coord_Disp + Global_nPoint*nDim*sizeof(passivedouble);
+  
+  passivedouble *Coord_Buf = new passivedouble[nPoint*nDim];
+  unsigned long *Elem_Buf  = new unsigned long[nElem_Slab*Elem_Width];
+  
+#ifndef HAVE_MPI
+  
+  /*--- Serial binary input, the only rank reads everything. ---*/
+  
+  fseek(fhw, Coord_Disp, SEEK_SET);
+  ret = fread(Coord_Buf, sizeof(passivedouble), nPoint*nDim, fhw);
+  if (ret != nPoint*nDim) {
+    SU2_MPI::Error(string("Error reading the coordinates of the binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+  
+  fseek(fhw, Elem_Disp, SEEK_SET);
+  ret = fread(Elem_Buf, sizeof(unsigned long), nElem_Slab*Elem_Width, fhw);
+  if (ret != nElem_Slab*Elem_Width) {
+    SU2_MPI::Error(string("Error reading the elements of the binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+  
+#else
+  
+  /*--- Parallel binary input using MPI I/O, each rank reads the coordinates
+   of its linear partition and a slab of the elements with collective calls. ---*/
+  
+  MPI_File fh;
+  MPI_Offset disp;
+  MPI_Status status;
+  int ierr, nRead;
+  unsigned short iArray;
+  unsigned long iChunk, nChunk, My_nChunk, Chunk_Begin, Chunk_Count;
+  
+  /*--- The counts of MPI I/O are int, the arrays are read in chunks that fit
+   in one. The calls are collective, all the ranks make the same number of
+   them even when they have nothing left to read. ---*/
+  
+  const unsigned long Chunk_Size = INT_MAX/2;
+  
+  char *Read_Buf[2]           = {(char *)Coord_Buf, (char *)Elem_Buf};
+  unsigned long nRead_Value[2] = {nPoint*nDim, nElem_Slab*Elem_Width};
+  unsigned long Value_Size[2]  = {sizeof(passivedouble), sizeof(unsigned long)};
+  MPI_Datatype Value_Type[2]   = {MPI_DOUBLE, MPI_UNSIGNED_LONG};
+  MPI_Offset Read_Disp[2]      = {(MPI_Offset)(Coord_Disp + starting_node[rank]*nDim*sizeof(passivedouble)),
+                                  (MPI_Offset)(Elem_Disp + Elem_Begin*Elem_Width*sizeof(unsigned long))};
+  string Read_Name[2]          = {"coordinates", "elements"};
+  
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open binary SU2 mesh file ") + string(fname), CURRENT_FUNCTION);
+  }
+  
+  for (iArray = 0; iArray < 2; iArray++) {
+    
+    My_nChunk = (nRead_Value[iArray] + Chunk_Size - 1)/Chunk_Size;
+    SU2_MPI::Allreduce(&My_nChunk, &nChunk, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+    
+    for (iChunk = 0; iChunk < nChunk; iChunk++) {
+      Chunk_Begin = min(iChunk*Chunk_Size, nRead_Value[iArray]);
+      Chunk_Count = min(Chunk_Size, nRead_Value[iArray]-Chunk_Begin);
+      disp = Read_Disp[iArray] + Chunk_Begin*Value_Size[iArray];
+      ierr = MPI_File_read_at_all(fh, disp, Read_Buf[iArray] + Chunk_Begin*Value_Size[iArray],
+                                  (int)Chunk_Count, Value_Type[iArray], &status);
+      nRead = 0;
+      if (ierr == MPI_SUCCESS) MPI_Get_count(&status, Value_Type[iArray], &nRead);
+      if ((ierr != MPI_SUCCESS) || (nRead != (int)Chunk_Count)) {
+        SU2_MPI::Error(string("Error reading the ") + Read_Name[iArray] + string(" of the binary SU2 mesh file ") +
+                       string(fname), CURRENT_FUNCTION);
+      }
+    }
+  }
+  
+  MPI_File_close(&fh);
+  
+#endif
+  
+  if (rank == MASTER_NODE) fclose(fhw);
+  
+  /*--- Create the points of the linear partition ---*/
+  
+  node = new CPoint*[nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    GlobalIndex = starting_node[rank] + iPoint;
+    if (nDim == 2)
+      node[iPoint] = new CPoint(Coord_Buf[iPoint*nDim], Coord_Buf[iPoint*nDim+1], GlobalIndex, config);
+    else
+      node[iPoint] = new CPoint(Coord_Buf[iPoint*nDim], Coord_Buf[iPoint*nDim+1], Coord_Buf[iPoint*nDim+2], GlobalIndex, config);
+  }
+  delete [] Coord_Buf;
+  
+  /*--- Send the elements of the slab to the ranks that need them and
+  build the adjacency for ParMETIS. ---*/
+  
+  Distribute_Elements_Linear(config, Elem_Buf, nElem_Slab, Elem_Begin, Elem_Width);
+  delete [] Elem_Buf;
+  
+  /*--- Boundary markers and periodic transformations ---*/
+  
+  Set_Markers_Linear(config, Marker_Tags, Marker_Info, Marker_Conn, Periodic_Data);
+  
+}
+
+void CPhysicalGeometry::Distribute_Elements_Linear(CConfig *config, unsigned long *Elem_Buf, unsigned long nElem_Slab,
+                                                   unsigned long Elem_Begin, unsigned long Elem_Width) {
+  
+  unsigned short iNode, jNode, nNode = 0;
+  unsigned long iElem, VTK_Type, nCount, iCount;
+  unsigned long *Conn = NULL;
+  int iProc, iSend, iRecv, nSends = 0, nRecvs = 0, nRank;
+  int Elem_Rank[N_POINTS_HEXAHEDRON];
+  
+#ifdef HAVE_MPI
+  unsigned long iPoint, j;
+  long local_index;
+#endif
+  
+  /*--- Send each element of the slab to every rank that owns one of its
+   nodes in the linear partition (redundant elements on the boundaries
+   of the linear partitions, as in the ASCII reader). Each record holds
+   the VTK type and the nodes of the element. ---*/
+  
+  nCount = Elem_Width+1;
+  
+  int *nElem_Send = new int[size+1]; nElem_Send[0] = 0;
+  int *nElem_Recv = new int[size+1]; nElem_Recv[0] = 0;
+  for (iProc = 0; iProc < size; iProc++) { nElem_Send[iProc+1] = 0; nElem_Recv[iProc+1] = 0; }
+  
+  vector<int> Slab_Rank;
+  vector<unsigned long> Slab_Rank_Begin(nElem_Slab+1, 0);
+  
+  for (iElem = 0; iElem < nElem_Slab; iElem++) {
+    Conn = &Elem_Buf[iElem*Elem_Width];
+    switch (Conn[0]) {
+      case TRIANGLE:      nNode = N_POINTS_TRIANGLE;      break;
+      case QUADRILATERAL: nNode = N_POINTS_QUADRILATERAL; break;
+      case TETRAHEDRON:   nNode = N_POINTS_TETRAHEDRON;   break;
+      case HEXAHEDRON:    nNode = N_POINTS_HEXAHEDRON;    break;
+      case PRISM:         nNode = N_POINTS_PRISM;         break;
+      case PYRAMID:       nNode = N_POINTS_PYRAMID;       break;
+      default:
+        SU2_MPI::Error(string("Unknown element type in the mesh file."), CURRENT_FUNCTION);
+        break;
+    }
+    nRank = 0;
+    for (iNode = 0; iNode < nNode; iNode++) {
+      iProc = int(upper_bound(nPoint_Linear, nPoint_Linear+size+1, Conn[iNode+1]) - nPoint_Linear) - 1;
+      for (jNode = 0; jNode < nRank; jNode++)
+        if (Elem_Rank[jNode] == iProc) break;
+      if (jNode == nRank) Elem_Rank[nRank++] = iProc;
+    }
+    for (jNode = 0; jNode < nRank; jNode++) {
+      Slab_Rank.push_back(Elem_Rank[jNode]);
+      nElem_Send[Elem_Rank[jNode]+1]++;
+    }
+    Slab_Rank_Begin[iElem+1] = Slab_Rank.size();
+  }
+  
+  SU2_MPI::Alltoall(&(nElem_Send[1]), 1, MPI_INT,
+                    &(nElem_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  for (iProc = 0; iProc < size; iProc++) {
+    if ((iProc != rank) && (nElem_Send[iProc+1] > 0)) nSends++;
+    if ((iProc != rank) && (nElem_Recv[iProc+1] > 0)) nRecvs++;
+    nElem_Send[iProc+1] += nElem_Send[iProc];
+    nElem_Recv[iProc+1] += nElem_Recv[iProc];
+  }
+  
+  /*--- Global index of the element followed by its record ---*/
+  
+  unsigned long *Elem_Send = new unsigned long[nCount*nElem_Send[size]];
+  vector<int> Send_Index(nElem_Send, nElem_Send+size);
+  for (iElem = 0; iElem < nElem_Slab; iElem++) {
+    for (iCount = Slab_Rank_Begin[iElem]; iCount < Slab_Rank_Begin[iElem+1]; iCount++) {
+      iSend = Send_Index[Slab_Rank[iCount]]++;
+      Elem_Send[iSend*nCount] = Elem_Begin + iElem;
+      for (iNode = 0; iNode < Elem_Width; iNode++)
+        Elem_Send[iSend*nCount+iNode+1] = Elem_Buf[iElem*Elem_Width+iNode];
+    }
+  }
+  vector<int>().swap(Slab_Rank);
+  
+  unsigned long *Elem_Recv = new unsigned long[nCount*nElem_Recv[size]];
+  
+  SU2_MPI::Request *elemSendReq = NULL, *elemRecvReq = NULL;
+  if (nSends > 0) elemSendReq = new SU2_MPI::Request[nSends];
+  if (nRecvs > 0) elemRecvReq = new SU2_MPI::Request[nRecvs];
+  
+  InitiateComms(Elem_Send, nElem_Send, elemSendReq,
+                Elem_Recv, nElem_Recv, elemRecvReq,
+                nCount, COMM_TYPE_UNSIGNED_LONG);
+  
+  /*--- Copy my own rank's data into the recv buffer directly. ---*/
+  
+  iRecv = nElem_Recv[rank];
+  for (iSend = nElem_Send[rank]; iSend < nElem_Send[rank+1]; iSend++) {
+    for (iCount = 0; iCount < nCount; iCount++)
+      Elem_Recv[iRecv*nCount+iCount] = Elem_Send[iSend*nCount+iCount];
+    iRecv++;
+  }
+  
+  CompleteComms(nSends, elemSendReq, nRecvs, elemRecvReq);
+  
+  if (elemSendReq != NULL) delete [] elemSendReq;
+  if (elemRecvReq != NULL) delete [] elemRecvReq;
+  delete [] Elem_Send;
+  
+  /*--- The slabs are ordered by rank, hence the received elements are
+   already sorted by global index. Store them and build the adjacency. ---*/
+  
+  Global_nElemDomain = Global_nElem;
+  nElem = nElem_Recv[size];
+  elem = new CPrimalGrid*[nElem];
+  Global_to_Local_Elem.clear();
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  vector< vector<unsigned long> > adj_nodes(nPoint, vector<unsigned long>(0));
+#endif
+#endif
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Distributing elements across all ranks." << endl;
+  
+  for (iElem = 0; iElem < nElem; iElem++) {
+    
+    Global_to_Local_Elem[Elem_Recv[iElem*nCount]] = iElem;
+    VTK_Type = Elem_Recv[iElem*nCount+1];
+    Conn = &Elem_Recv[iElem*nCount+2];
+    
+    switch(VTK_Type) {
+      case TRIANGLE:
+        elem[iElem] = new CTriangle(Conn[0], Conn[1], Conn[2], 2);
+        nNode = N_POINTS_TRIANGLE; nelem_triangle++; break;
+      case QUADRILATERAL:
+        elem[iElem] = new CQuadrilateral(Conn[0], Conn[1], Conn[2], Conn[3], 2);
+        nNode = N_POINTS_QUADRILATERAL; nelem_quad++; break;
+      case TETRAHEDRON:
+        elem[iElem] = new CTetrahedron(Conn[0], Conn[1], Conn[2], Conn[3]);
+        nNode = N_POINTS_TETRAHEDRON; nelem_tetra++; break;
+      case HEXAHEDRON:
+        elem[iElem] = new CHexahedron(Conn[0], Conn[1], Conn[2], Conn[3], Conn[4], Conn[5], Conn[6], Conn[7]);
+        nNode = N_POINTS_HEXAHEDRON; nelem_hexa++; break;
+      case PRISM:
+        elem[iElem] = new CPrism(Conn[0], Conn[1], Conn[2], Conn[3], Conn[4], Conn[5]);
+        nNode = N_POINTS_PRISM; nelem_prism++; break;
+      case PYRAMID:
+        elem[iElem] = new CPyramid(Conn[0], Conn[1], Conn[2], Conn[3], Conn[4]);
+        nNode = N_POINTS_PYRAMID; nelem_pyramid++; break;
+    }
+    
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+    /*--- Build adjacency assuming the VTK connectivity ---*/
+    for (iNode = 0; iNode < nNode; iNode++) {
+      local_index = Conn[iNode]-starting_node[rank];
+      if ((local_index >= 0) && (local_index < (long)nPoint)) {
+        for (jNode = 0; jNode < nNode; jNode++)
+          if (iNode != jNode) adj_nodes[local_index].push_back(Conn[jNode]);
+      }
+    }
+#endif
+#endif
+    
+  }
+  
+  delete [] Elem_Recv;
+  delete [] nElem_Send;
+  delete [] nElem_Recv;
+  
+  /*--- Adjacency information for ParMETIS, as in the ASCII reader ---*/
+  
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  
+  if ((rank == MASTER_NODE) && (size > SINGLE_NODE))
+    cout << "Building the graph adjacency structure." << endl;
+  
+  unsigned long loc_adjc_size = 0, adj_elem_size;
+  vector<unsigned long> adjac_vec, temp_adjacency;
+  vector<unsigned long>::iterator it;
+  vector<idx_t> adjwgt_vec;
+  bool weighted = config->GetPartition_Weights();
+  
+  xadj = new idx_t [npoint_procs[rank]+1];
+  xadj[0] = 0;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    for (j = 0; j < adj_nodes[iPoint].size(); j++)
+      temp_adjacency.push_back(adj_nodes[iPoint][j]);
+    
+    sort(temp_adjacency.begin(), temp_adjacency.end());
+    if (weighted) {
+      for (j = 0; j < temp_adjacency.size(); j++) {
+        if ((j == 0) || (temp_adjacency[j] != temp_adjacency[j-1])) adjwgt_vec.push_back(1);
+        else adjwgt_vec.back()++;
+      }
+    }
+    it = unique(temp_adjacency.begin(), temp_adjacency.end());
+    loc_adjc_size = it - temp_adjacency.begin();
+    
+    temp_adjacency.resize(loc_adjc_size);
+    xadj[iPoint+1] = xadj[iPoint]+loc_adjc_size;
+    
+    for (j = 0; j < loc_adjc_size; j++)
+      adjac_vec.push_back(temp_adjacency[j]);
+    
+    temp_adjacency.clear();
+    adj_nodes[iPoint].clear();
+    
+  }
+  
+  adj_elem_size = xadj[npoint_procs[rank]];
+  adjacency = new idx_t [adj_elem_size];
+  copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
+  
+  adjwgt = NULL;
+  if (weighted) {
+    adjwgt = new idx_t [adj_elem_size];
+    copy(adjwgt_vec.begin(), adjwgt_vec.end(), adjwgt);
+  }
+  
+  xadj_size = npoint_procs[rank]+1;
+  adjacency_size = adj_elem_size;
+  
+  adjac_vec.clear();
+  adjwgt_vec.clear();
+  adj_nodes.clear();
+  
+#endif
+#endif
+  
+  
+}
+
+void CPhysicalGeometry::Set_Markers_Linear(CConfig *config, vector<char> &Marker_Tags, vector<long> &Marker_Info,
+                                           vector<unsigned long> &Marker_Conn, vector<passivedouble> &Periodic_Data) {
+  
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned short iMarker, iNode, iPeriodic, nPeriodic, iChar;
+  unsigned long iElem_Bound, Elem_Width;
+  unsigned long *Conn = NULL;
+  char str_buf[MAX_STRING_SIZE];
+  string Marker_Tag;
+  
+  /*--- Boundary markers, stored by all the ranks ---*/
+  
+  nMarker = Marker_Info.size()/3;
+  if (rank == MASTER_NODE) cout << nMarker << " surface markers." << endl;
+  config->SetnMarker_All(nMarker);
+  bound = new CPrimalGrid**[nMarker];
+  nElem_Bound = new unsigned long [nMarker];
+  Tag_to_Marker = new string [nMarker_Max];
+  
+  Conn = (Marker_Conn.size() > 0)? &Marker_Conn[0] : NULL;
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    
+    for (iChar = 0; iChar < MAX_STRING_SIZE; iChar++)
+      str_buf[iChar] = Marker_Tags[iMarker*MAX_STRING_SIZE+iChar];
+    str_buf[MAX_STRING_SIZE-1] = '\0';
+    Marker_Tag = str_buf;
+    
+    nElem_Bound[iMarker] = Marker_Info[iMarker*3];
+    Elem_Width = Marker_Info[iMarker*3+1];
+    bound[iMarker] = new CPrimalGrid* [nElem_Bound[iMarker]];
+    
+    /*--- Physical boundaries definition ---*/
+    
+    if (Marker_Tag != "SEND_RECEIVE") {
+      
+      if (rank == MASTER_NODE)
+        cout << nElem_Bound[iMarker]  << " boundary elements in index "<< iMarker <<" (Marker = " <<Marker_Tag<< ")." << endl;
+      
+      nelem_edge_bound = 0; nelem_triangle_bound = 0; nelem_quad_bound = 0;
+      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+        switch(Conn[0]) {
+          case LINE:
+            if (nDim == 3) {
+              SU2_MPI::Error("Please remove line boundary conditions from the mesh file!", CURRENT_FUNCTION);
+            }
+            bound[iMarker][iElem_Bound] = new CLine(Conn[1], Conn[2], 2);
+            nelem_edge_bound++; break;
+          case TRIANGLE:
+            bound[iMarker][iElem_Bound] = new CTriangle(Conn[1], Conn[2], Conn[3], 3);
+            nelem_triangle_bound++; break;
+          case QUADRILATERAL:
+            bound[iMarker][iElem_Bound] = new CQuadrilateral(Conn[1], Conn[2], Conn[3], Conn[4], 3);
+            nelem_quad_bound++; break;
+          default:
+            SU2_MPI::Error(string("Unknown boundary element type in marker ") + Marker_Tag, CURRENT_FUNCTION);
+            break;
+        }
+        Conn += Elem_Width;
+      }
+      
+      /*--- Update config information storing the boundary information in the right place ---*/
+      
+      Tag_to_Marker[config->GetMarker_CfgFile_TagBound(Marker_Tag)] = Marker_Tag;
+      config->SetMarker_All_TagBound(iMarker, Marker_Tag);
+      config->SetMarker_All_KindBC(iMarker, config->GetMarker_CfgFile_KindBC(Marker_Tag));
+      config->SetMarker_All_Monitoring(iMarker, config->GetMarker_CfgFile_Monitoring(Marker_Tag));
+      config->SetMarker_All_GeoEval(iMarker, config->GetMarker_CfgFile_GeoEval(Marker_Tag));
+      config->SetMarker_All_Designing(iMarker, config->GetMarker_CfgFile_Designing(Marker_Tag));
+      config->SetMarker_All_Plotting(iMarker, config->GetMarker_CfgFile_Plotting(Marker_Tag));
+      config->SetMarker_All_Analyze(iMarker, config->GetMarker_CfgFile_Analyze(Marker_Tag));
+      config->SetMarker_All_ZoneInterface(iMarker, config->GetMarker_CfgFile_ZoneInterface(Marker_Tag));
+      config->SetMarker_All_DV(iMarker, config->GetMarker_CfgFile_DV(Marker_Tag));
+      config->SetMarker_All_Moving(iMarker, config->GetMarker_CfgFile_Moving(Marker_Tag));
+      config->SetMarker_All_PyCustom(iMarker, config->GetMarker_CfgFile_PyCustom(Marker_Tag));
+      config->SetMarker_All_PerBound(iMarker, config->GetMarker_CfgFile_PerBound(Marker_Tag));
+      config->SetMarker_All_SendRecv(iMarker, NONE);
+      config->SetMarker_All_Turbomachinery(iMarker, config->GetMarker_CfgFile_Turbomachinery(Marker_Tag));
+      config->SetMarker_All_TurbomachineryFlag(iMarker, config->GetMarker_CfgFile_TurbomachineryFlag(Marker_Tag));
+      config->SetMarker_All_MixingPlaneInterface(iMarker, config->GetMarker_CfgFile_MixingPlaneInterface(Marker_Tag));
+      
+    }
+    
+    /*--- Send-Receive boundaries definition, the records hold the node
+     and the type of transformation. ---*/
+    
+    else {
+      
+      config->SetMarker_All_KindBC(iMarker, SEND_RECEIVE);
+      config->SetMarker_All_SendRecv(iMarker, Marker_Info[iMarker*3+2]);
+      
+      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+        bound[iMarker][iElem_Bound] = new CVertexMPI(Conn[1], nDim);
+        bound[iMarker][iElem_Bound]->SetRotation_Type(Conn[2]);
+        Conn += Elem_Width;
+      }
+      
+    }
+    
+  }
+  
+  /*--- Periodic transformations (center, rotation and translation), or
+   default zeros if there are none. ---*/
+  
+  nPeriodic = Periodic_Data.size()/9;
+  if (nPeriodic > 0) {
+    if ((rank == MASTER_NODE) && (nPeriodic - 1 != 0))
+      cout << nPeriodic - 1 << " periodic transformations." << endl;
+    config->SetnPeriodicIndex(nPeriodic);
+  } else {
+    config->SetnPeriodicIndex(1);
+  }
+  
+  su2double* center    = new su2double[3];
+  su2double* rotation  = new su2double[3];
+  su2double* translate = new su2double[3];
+  for (iPeriodic = 0; iPeriodic < max(nPeriodic, (unsigned short)1); iPeriodic++) {
+    for (iNode = 0; iNode < 3; iNode++) {
+      center[iNode]    = (nPeriodic > 0)? Periodic_Data[iPeriodic*9+iNode]   : 0.0;
+      rotation[iNode]  = (nPeriodic > 0)? Periodic_Data[iPeriodic*9+3+iNode] : 0.0;
+      translate[iNode] = (nPeriodic > 0)? Periodic_Data[iPeriodic*9+6+iNode] : 0.0;
+    }
+    config->SetPeriodicCenter(iPeriodic, center);
+    config->SetPeriodicRotation(iPeriodic, rotation);
+    config->SetPeriodicTranslate(iPeriodic, translate);
+  }
+  delete [] center; delete [] rotation; delete [] translate;
+  
+  
+}
+
+void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
+  
+  /*--- Original CGNS reader implementation by Thomas D. Economon,
+   Francisco Palacios. Improvements for mixed-element meshes generated
+   by ICEM added by Martin Spel (3D) & Shlomy Shitrit (2D), April 2014.
+   Parallel version by Thomas D. Economon, February 2015. ---*/
+  
+#ifdef HAVE_CGNS
+    
+  string text_line, Marker_Tag;
+  ifstream mesh_file;
+  unsigned short VTK_Type = 0, iMarker = 0;
+  unsigned short nMarker_Max = config->GetnMarker_Max();
+  unsigned long iPoint = 0, iProcessor = 0, ielem = 0, GlobalIndex = 0;
+  unsigned long globalOffset = 0;
+  nZone = val_nZone;
+  
+  /*--- Local variables needed when calling the CGNS mid-level API. ---*/
+  
+  unsigned long vnodes_cgns[8] = {0,0,0,0,0,0,0,0};
+  su2double Coord_cgns[3] = {0.0,0.0,0.0};
+  int fn, nbases = 0, nzones = 0, ngrids = 0, ncoords = 0, nsections = 0;
+  int *vertices = NULL, *cells = NULL, nMarkers = 0, *boundVerts = NULL, npe;
+  int interiorElems = 0, totalVerts = 0;
+  int cell_dim = 0, phys_dim = 0, nbndry, parent_flag, file_type;
+  char basename[CGNS_STRING_SIZE], zonename[CGNS_STRING_SIZE];
+  char coordname[CGNS_STRING_SIZE];
+  cgsize_t* cgsize; cgsize = new cgsize_t[3];
+  ZoneType_t zonetype;
+  DataType_t datatype;
+  passivedouble** coordArray = NULL;
+  passivedouble*** gridCoords = NULL;
+  ElementType_t elemType;
+  cgsize_t range_min, range_max, startE, endE;
+  range_min = 1;
+  string currentElem;
+  int** elemTypeVTK = NULL;
+  int** elemIndex = NULL;
+  int** elemBegin = NULL;
+  int** elemEnd = NULL;
+  int** nElems = NULL;
+  cgsize_t**** connElems = NULL;
+  cgsize_t* connElemCGNS = NULL;
+  cgsize_t* connElemTemp = NULL;
+  cgsize_t ElementDataSize = 0;
+  cgsize_t* parentData = NULL;
+  int** dataSize = NULL;
+  bool** isInternal = NULL;
+  char*** sectionNames = NULL;
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+
+#ifdef HAVE_MPI
+  unsigned long Local_nElem;
+  unsigned long Local_nElemTri, Local_nElemQuad, Local_nElemTet;
+  unsigned long Local_nElemHex, Local_nElemPrism, Local_nElemPyramid;
+  SU2_MPI::Request *send_req, *recv_req;
+  SU2_MPI::Status  status;
+  int ind;
+#endif
+  
+  /*--- Initialize counters for local/global points & elements ---*/
+  
+  Global_nPoint  = 0; Global_nPointDomain = 0; Global_nElem = 0;
+  nelem_edge     = 0; Global_nelem_edge     = 0;
+  nelem_triangle = 0; Global_nelem_triangle = 0;
+  nelem_quad     = 0; Global_nelem_quad     = 0;
+  nelem_tetra    = 0; Global_nelem_tetra    = 0;
+  nelem_hexa     = 0; Global_nelem_hexa     = 0;
+  nelem_prism    = 0; Global_nelem_prism    = 0;
+  nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
+  
+  /*--- Initialize some additional counters for the parallel partitioning ---*/
+  
+  unsigned long total_pt_accounted = 0;
+  unsigned long rem_points         = 0;
+  unsigned long element_count      = 0;
+  unsigned long element_remainder  = 0;
+  unsigned long total_elems        = 0;
+  
+  /*--- Allocate memory for the linear partitioning of the mesh. These
+   arrays are the size of the number of ranks. ---*/
+  
+  starting_node = new unsigned long[size];
+  ending_node   = new unsigned long[size];
+  npoint_procs  = new unsigned long[size];
+  nPoint_Linear = new unsigned long[size+1];
+
+  unsigned long *nElem_Linear  = new unsigned long[size];
+  
+  unsigned long *elemB = new unsigned long[size];
+  unsigned long *elemE = new unsigned long[size];
+  
+  unsigned long *elemGlobalID = NULL;
   
   unsigned short *nPoinPerElem = NULL;
   unsigned short *elemTypes = NULL;
@@ -11834,8 +13549,10 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   
   unsigned long loc_adjc_size=0;
   vector<unsigned long> adjac_vec;
+  vector<idx_t> adjwgt_vec;
   unsigned long adj_elem_size;
   vector<unsigned long>::iterator it;
+  bool weighted = config->GetPartition_Weights();
   
   xadj = new idx_t[npoint_procs[rank]+1];
   xadj[0]=0;
@@ -11849,6 +13566,15 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
     }
     
     sort(temp_adjacency.begin(), temp_adjacency.end());
+    
+    /*--- Edge weights, number of elements that share the edge ---*/
+    
+    if (weighted) {
+      for (unsigned long j = 0; j < temp_adjacency.size(); j++) {
+        if ((j == 0) || (temp_adjacency[j] != temp_adjacency[j-1])) adjwgt_vec.push_back(1);
+        else adjwgt_vec.back()++;
+      }
+    }
     it = unique( temp_adjacency.begin(), temp_adjacency.end());
     loc_adjc_size=it - temp_adjacency.begin();
     
@@ -11869,12 +13595,19 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   adjacency = new idx_t [adj_elem_size];
   copy(adjac_vec.begin(), adjac_vec.end(), adjacency);
   
+  adjwgt = NULL;
+  if (weighted) {
+    adjwgt = new idx_t [adj_elem_size];
+    copy(adjwgt_vec.begin(), adjwgt_vec.end(), adjwgt);
+  }
+  
   xadj_size = npoint_procs[rank]+1;
   adjacency_size = adj_elem_size;
   
   /*--- Free temporary memory used to build the adjacency. ---*/
   
   adjac_vec.clear();
+  adjwgt_vec.clear();
   
 #endif
 #endif
@@ -12860,10 +14593,10 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
   
 }
 
-void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
-  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iElem, iNode, jNode;
-  vector<unsigned long> Queue, AuxQueue, Result;
-  unsigned short Degree, MinDegree, iDim, iMarker;
+void CPhysicalGeometry::SetRCM_Ordering(vector<unsigned long> &Result) {
+  unsigned long iPoint, AdjPoint, AuxPoint, AddPoint, iNode, jNode;
+  vector<unsigned long> Queue, AuxQueue;
+  unsigned short Degree, MinDegree;
   bool *inQueue;
   
   inQueue = new bool [nPoint];
@@ -12951,6 +14684,114 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
     Result.push_back(iPoint);
   }
   
+}
+
+void CPhysicalGeometry::SetHilbert_Ordering(vector<unsigned long> &Result) {
+  unsigned long iPoint, Q, P, t, Key, Coord[3], Max_Coord;
+  unsigned short iDim, jDim, nBits;
+  su2double Coord_Min[3], Coord_Max[3], Delta;
+  vector<pair<unsigned long, unsigned long> > Keys;
+  
+  /*--- Bits per direction of the curve, such that the interleaved
+   key of the nDim coordinates fits in an unsigned long. ---*/
+  
+  nBits = (nDim == 2) ? 31 : 21;
+  Max_Coord = (1ul << nBits) - 1;
+  
+  /*--- Bounding box of the points of the domain ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Coord_Min[iDim] = node[0]->GetCoord(iDim);
+    Coord_Max[iDim] = node[0]->GetCoord(iDim);
+  }
+  for (iPoint = 1; iPoint < nPointDomain; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord_Min[iDim] = min(Coord_Min[iDim], node[iPoint]->GetCoord(iDim));
+      Coord_Max[iDim] = max(Coord_Max[iDim], node[iPoint]->GetCoord(iDim));
+    }
+  
+  Keys.resize(nPointDomain);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    /*--- Integer coordinates on the grid of the curve ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Delta = Coord_Max[iDim] - Coord_Min[iDim];
+      if (Delta > 0.0)
+        Coord[iDim] = (unsigned long)(SU2_TYPE::GetValue((node[iPoint]->GetCoord(iDim) - Coord_Min[iDim])/Delta)*Max_Coord);
+      else
+        Coord[iDim] = 0;
+    }
+    
+    /*--- Transposed Hilbert index of the coordinates (J. Skilling,
+     "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004). ---*/
+    
+    for (Q = 1ul << (nBits-1); Q > 1; Q >>= 1) {
+      P = Q - 1;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        if (Coord[iDim] & Q) Coord[0] ^= P;
+        else {
+          t = (Coord[0] ^ Coord[iDim]) & P;
+          Coord[0] ^= t; Coord[iDim] ^= t;
+        }
+      }
+    }
+    for (iDim = 1; iDim < nDim; iDim++)
+      Coord[iDim] ^= Coord[iDim-1];
+    t = 0;
+    for (Q = 1ul << (nBits-1); Q > 1; Q >>= 1)
+      if (Coord[nDim-1] & Q) t ^= Q - 1;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord[iDim] ^= t;
+    
+    /*--- Interleave the bits of the transposed index into the key ---*/
+    
+    Key = 0;
+    for (jDim = nBits; jDim > 0; jDim--)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Key = (Key << 1) | ((Coord[iDim] >> (jDim-1)) & 1ul);
+    
+    Keys[iPoint] = make_pair(Key, iPoint);
+    
+  }
+  
+  /*--- Points along the curve, ties are broken with the original index ---*/
+  
+  sort(Keys.begin(), Keys.end());
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result.push_back(Keys[iPoint].second);
+  
+  /*--- Add the MPI points ---*/
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    Result.push_back(iPoint);
+  
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(CConfig *config) {
+  unsigned long iPoint, iElem, iNode;
+  unsigned short iDim, iMarker;
+  vector<unsigned long> Result;
+  
+  /*--- New position of the points, the halo points keep their position
+   at the end. The global index is permuted with the points, so the restart
+   files and the output, which go through the global index, are not affected. ---*/
+  
+  switch (config->GetKind_Point_Ordering()) {
+    case RCM_ORDERING:
+      SetRCM_Ordering(Result);
+      break;
+    case HILBERT_ORDERING:
+      SetHilbert_Ordering(Result);
+      break;
+    default:
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        Result.push_back(iPoint);
+      break;
+  }
+  
   /*--- Reset old data structures ---*/
   
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -15752,6 +17593,9 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
   Volume, DomainVolume, my_DomainVolume, *NormalFace = NULL;
   bool change_face_orientation;
 
+  /*--- The least-squares gradient weights follow the coordinates of the dual grid ---*/
+  LSWeight_Valid = false;
+
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
     for (iEdge = 0; iEdge < (long)nEdge; iEdge++)
@@ -16022,6 +17866,11 @@ void CPhysicalGeometry::SetMeshFile (CConfig *config, string val_mesh_out_filena
   char *cstr;
   su2double *center, *angles, *transl;
   
+  if (config->GetMesh_Out_FileFormat() == SU2_BINARY) {
+    SetMeshFile_Binary(config, val_mesh_out_filename);
+    return;
+  }
+  
   cstr = new char [val_mesh_out_filename.size()+1];
   strcpy (cstr, val_mesh_out_filename.c_str());
   
@@ -16127,6 +17976,131 @@ void CPhysicalGeometry::SetMeshFile (CConfig *config, string val_mesh_out_filena
   output_file.close();
 }
 
+void CPhysicalGeometry::SetMeshFile_Binary(CConfig *config, string val_mesh_out_filename) {
+  
+  unsigned long iElem, iPoint, iElem_Bound, iRecord, Elem_Width, Zone_Size;
+  unsigned long Header[SU2_BINARY_MESH_HEADER];
+  unsigned short iMarker, iNodes, iDim, iPeriodic, nPeriodic;
+  long Marker_Info[3];
+  bool send_recv;
+  char Marker_Name[MAX_STRING_SIZE];
+  passivedouble Offsets[2], Periodic_Data[9];
+  su2double *center, *angles, *transl;
+  FILE *fhw;
+  
+  /*--- Width of the element records and size of the zone ---*/
+  
+  Elem_Width = 1;
+  for (iElem = 0; iElem < nElem; iElem++)
+    Elem_Width = max(Elem_Width, (unsigned long)(elem[iElem]->GetnNodes()+1));
+  
+  nPeriodic = config->GetnPeriodicIndex();
+  
+  Zone_Size = SU2_BINARY_MESH_HEADER*sizeof(unsigned long) + 2*sizeof(passivedouble) +
+              nPoint*nDim*sizeof(passivedouble) + nElem*Elem_Width*sizeof(unsigned long) +
+              nPeriodic*9*sizeof(passivedouble);
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    Zone_Size += MAX_STRING_SIZE*sizeof(char) + 3*sizeof(long) + nElem_Bound[iMarker]*(1+N_POINTS_QUADRILATERAL)*sizeof(unsigned long);
+  
+  Header[0] = SU2_BINARY_MESH_ID;
+  Header[1] = 1;
+  Header[2] = nDim;
+  Header[3] = nPoint;
+  Header[4] = nPointDomain;
+  Header[5] = nElem;
+  Header[6] = Elem_Width;
+  Header[7] = nMarker;
+  Header[8] = nPeriodic;
+  Header[9] = Zone_Size;
+  
+  /*--- Open .su2 binary grid file ---*/
+  
+  fhw = fopen(val_mesh_out_filename.c_str(), "wb");
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open binary SU2 mesh file ") + val_mesh_out_filename, CURRENT_FUNCTION);
+  }
+  
+  fwrite(Header, sizeof(unsigned long), SU2_BINARY_MESH_HEADER, fhw);
+  
+  Offsets[0] = SU2_TYPE::GetValue(config->GetAoA_Offset());
+  Offsets[1] = SU2_TYPE::GetValue(config->GetAoS_Offset());
+  fwrite(Offsets, sizeof(passivedouble), 2, fhw);
+  
+  /*--- Write the node coordinates ---*/
+  
+  passivedouble *Coord_Buf = new passivedouble[nPoint*nDim];
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_Buf[iPoint*nDim+iDim] = SU2_TYPE::GetValue(node[iPoint]->GetCoord(iDim));
+  fwrite(Coord_Buf, sizeof(passivedouble), nPoint*nDim, fhw);
+  delete [] Coord_Buf;
+  
+  /*--- Write the elements, padded to the width of the records ---*/
+  
+  unsigned long *Elem_Buf = new unsigned long[max(Elem_Width, (unsigned long)(1+N_POINTS_QUADRILATERAL))];
+  for (iElem = 0; iElem < nElem; iElem++) {
+    for (iRecord = 0; iRecord < Elem_Width; iRecord++) Elem_Buf[iRecord] = 0;
+    Elem_Buf[0] = elem[iElem]->GetVTK_Type();
+    for (iNodes = 0; iNodes < elem[iElem]->GetnNodes(); iNodes++)
+      Elem_Buf[iNodes+1] = elem[iElem]->GetNode(iNodes);
+    fwrite(Elem_Buf, sizeof(unsigned long), Elem_Width, fhw);
+  }
+  
+  /*--- Loop through and write the boundary info, the SEND_RECEIVE
+   records hold the node and the type of transformation ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    
+    /*--- An empty marker has no element to look at, its kind tells if it is a SEND_RECEIVE ---*/
+    
+    if (nElem_Bound[iMarker] > 0) send_recv = (bound[iMarker][0]->GetVTK_Type() == VERTEX);
+    else send_recv = (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE);
+    
+    memset(Marker_Name, 0, MAX_STRING_SIZE);
+    if (!send_recv) {
+      strncpy(Marker_Name, config->GetMarker_All_TagBound(iMarker).c_str(), MAX_STRING_SIZE-1);
+      Marker_Info[2] = NONE;
+    } else {
+      strncpy(Marker_Name, "SEND_RECEIVE", MAX_STRING_SIZE-1);
+      Marker_Info[2] = config->GetMarker_All_SendRecv(iMarker);
+    }
+    Marker_Info[0] = nElem_Bound[iMarker];
+    Marker_Info[1] = 1+N_POINTS_QUADRILATERAL;
+    fwrite(Marker_Name, sizeof(char), MAX_STRING_SIZE, fhw);
+    fwrite(Marker_Info, sizeof(long), 3, fhw);
+    for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
+      for (iRecord = 0; iRecord < 1+N_POINTS_QUADRILATERAL; iRecord++) Elem_Buf[iRecord] = 0;
+      Elem_Buf[0] = bound[iMarker][iElem_Bound]->GetVTK_Type();
+      if (Elem_Buf[0] == VERTEX) {
+        Elem_Buf[1] = bound[iMarker][iElem_Bound]->GetNode(0);
+        Elem_Buf[2] = bound[iMarker][iElem_Bound]->GetRotation_Type();
+      } else {
+        for (iNodes = 0; iNodes < bound[iMarker][iElem_Bound]->GetnNodes(); iNodes++)
+          Elem_Buf[iNodes+1] = bound[iMarker][iElem_Bound]->GetNode(iNodes);
+      }
+      fwrite(Elem_Buf, sizeof(unsigned long), 1+N_POINTS_QUADRILATERAL, fhw);
+    }
+  }
+  delete [] Elem_Buf;
+  
+  /*--- Write the periodic transformations ---*/
+  
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    center = config->GetPeriodicCenter(iPeriodic);
+    angles = config->GetPeriodicRotation(iPeriodic);
+    transl = config->GetPeriodicTranslate(iPeriodic);
+    for (iDim = 0; iDim < 3; iDim++) {
+      Periodic_Data[iDim]   = SU2_TYPE::GetValue(center[iDim]);
+      Periodic_Data[3+iDim] = SU2_TYPE::GetValue(angles[iDim]);
+      Periodic_Data[6+iDim] = SU2_TYPE::GetValue(transl[iDim]);
+    }
+    fwrite(Periodic_Data, sizeof(passivedouble), 9, fhw);
+  }
+  
+  fclose(fhw);
+  
+}
+
 void CPhysicalGeometry::SetCoord_Smoothing (unsigned short val_nSmooth, su2double val_smooth_coeff, CConfig *config) {
   unsigned short iSmooth, nneigh, iMarker;
   su2double *Coord_Old, *Coord_Sum, *Coord, *Coord_i, *Coord_j, Position_Plane = 0.0;
@@ -16662,8 +18636,11 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 #ifdef HAVE_MPI
 #ifdef HAVE_PARMETIS
   
-  unsigned long iPoint;
+  unsigned long iPoint, iElem, iGlobal;
+  unsigned short iMarker, iNode;
+  long local_index;
   MPI_Comm comm = MPI_COMM_WORLD;
+  bool weighted = config->GetPartition_Weights();
 
   /*--- Only call ParMETIS if we have more than one rank to avoid errors ---*/
   
@@ -16675,6 +18652,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     
     idx_t *vtxdist = new idx_t[size+1];
     idx_t *part    = new idx_t[nPoint];
+    idx_t *vwgt    = NULL;
     
     real_t ubvec;
     real_t *tpwgts = new real_t[size];
@@ -16703,9 +18681,79 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       vtxdist[i+1] = (idx_t)ending_node[i];
     }
     
+    /*--- Weights of the points: the edge loops dominate the cost of a point,
+     so it starts from its number of neighbors (which reflects the type of
+     the elements around it), the points on walls, actuator disks and
+     interfaces are scaled by PARTITION_WALL_WEIGHT, and the correction
+     measured by a previous run multiplies the result. ---*/
+    
+    vector<passivedouble> Point_Weight;
+    
+    if (weighted) {
+      
+      Point_Weight.resize(nPoint);
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        Point_Weight[iPoint] = 1.0 + (passivedouble)(xadj[iPoint+1] - xadj[iPoint]);
+      
+      vector<bool> Heavy(nPoint, false);
+      for (iMarker = 0; iMarker < nMarker; iMarker++) {
+        if (!GetPartition_Heavy_Marker(config, iMarker)) continue;
+        for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+          for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            local_index = (long)bound[iMarker][iElem]->GetNode(iNode) - (long)starting_node[rank];
+            if ((local_index >= 0) && (local_index < (long)nPoint)) Heavy[local_index] = true;
+          }
+        }
+      }
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        if (Heavy[iPoint]) Point_Weight[iPoint] *= SU2_TYPE::GetValue(config->GetPartition_Wall_Weight());
+      
+      /*--- Measured cost, each rank keeps the lines of its own points ---*/
+      
+      string cost_filename = config->GetMultizone_FileName(config->GetPartition_Cost_FileName(), config->GetiZone());
+      ifstream cost_file(cost_filename.c_str(), ios::in);
+      
+      if (cost_file.fail()) {
+        if (rank == MASTER_NODE)
+          cout << "No partition cost file (" << cost_filename << "), the measured cost is not used." << endl;
+      }
+      else {
+        string text_line;
+        passivedouble cost;
+        while (getline(cost_file, text_line)) {
+          if (text_line.empty() || (text_line[0] == '%')) continue;
+          istringstream cost_line(text_line);
+          if (!(cost_line >> iGlobal >> cost)) continue;
+          local_index = (long)iGlobal - (long)starting_node[rank];
+          if ((local_index >= 0) && (local_index < (long)nPoint) && (cost > 0.0))
+            Point_Weight[local_index] *= cost;
+        }
+        cost_file.close();
+        if (rank == MASTER_NODE)
+          cout << "Partition weights corrected by the measured cost in " << cost_filename << "." << endl;
+      }
+      
+      /*--- ParMETIS adds the weights in idx_t, scale them so that the total
+       stays far from overflowing (one decimal of resolution when possible) ---*/
+      
+      passivedouble MyTotal_Weight = 0.0, Total_Weight = 0.0, Scale;
+      for (iPoint = 0; iPoint < nPoint; iPoint++) MyTotal_Weight += Point_Weight[iPoint];
+      MPI_Allreduce(&MyTotal_Weight, &Total_Weight, 1, MPI_DOUBLE, MPI_SUM, comm);
+      
+      Scale = 10.0;
+      if (sizeof(idx_t) == 4) Scale = min(Scale, 1.0e9/max(Total_Weight, 1.0));
+      
+      vwgt = new idx_t[nPoint];
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        vwgt[iPoint] = max((idx_t)1, (idx_t)(Point_Weight[iPoint]*Scale + 0.5));
+      
+      wgtflag = (adjwgt != NULL)? 3 : 2;
+      
+    }
+    
     /*--- Calling ParMETIS ---*/
     if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, NULL, NULL, &wgtflag,
+    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, vwgt, adjwgt, &wgtflag,
                          &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
                          &edgecut, part, &comm);
     if (rank == MASTER_NODE) {
@@ -16721,11 +18769,33 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       node[iPoint]->SetColor(part[iPoint]);
     }
     
+    /*--- Load imbalance of the partition (largest part over the average
+     part), in number of points and, if used, in weight ---*/
+    
+    vector<passivedouble> MyPart_Load(2*size, 0.0), Part_Load(2*size, 0.0);
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      MyPart_Load[part[iPoint]] += 1.0;
+      if (weighted) MyPart_Load[size+part[iPoint]] += (passivedouble)vwgt[iPoint];
+    }
+    MPI_Allreduce(&MyPart_Load[0], &Part_Load[0], 2*size, MPI_DOUBLE, MPI_SUM, comm);
+    
+    if (rank == MASTER_NODE) {
+      passivedouble Max_Points = 0.0, Sum_Points = 0.0, Max_Weight = 0.0, Sum_Weight = 0.0;
+      for (int i = 0; i < size; i++) {
+        Max_Points = max(Max_Points, Part_Load[i]);      Sum_Points += Part_Load[i];
+        Max_Weight = max(Max_Weight, Part_Load[size+i]); Sum_Weight += Part_Load[size+i];
+      }
+      cout << "Load imbalance of the partition (max/average): " << Max_Points*size/Sum_Points << " in points";
+      if (weighted) cout << ", " << Max_Weight*size/Sum_Weight << " in weight";
+      cout << "." << endl;
+    }
+    
     /*--- Free all memory needed for the ParMETIS structures ---*/
     
     delete [] vtxdist;
     delete [] part;
     delete [] tpwgts;
+    if (vwgt != NULL) delete [] vwgt;
     
   }
   
@@ -16734,10 +18804,337 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
   
   delete [] xadj;
   delete [] adjacency;
+  if (adjwgt != NULL) delete [] adjwgt;
+  
+#endif
+#endif
+  
+}
+
+bool CPhysicalGeometry::GetPartition_Heavy_Marker(CConfig *config, unsigned short val_marker) {
+  
+  switch (config->GetMarker_All_KindBC(val_marker)) {
+    case HEAT_FLUX: case ISOTHERMAL: case CHT_WALL_INTERFACE:
+    case ACTDISK_INLET: case ACTDISK_OUTLET: case ENGINE_INFLOW: case ENGINE_EXHAUST:
+    case FLUID_INTERFACE: case INTERFACE_BOUNDARY: case NEARFIELD_BOUNDARY:
+      return true;
+    default:
+      return false;
+  }
+  
+}
+
+void CPhysicalGeometry::Write_Partition_Cost(CConfig *config, su2double val_time) {
+  
+  unsigned long iPoint, iVertex;
+  unsigned short iMarker;
+  int iRank;
+  passivedouble MyLoad[2], Load[2], Correction;
+  vector<bool> Heavy(nPoint, false);
+  
+  /*--- Only meaningful for partitioned grids ---*/
+  
+  if (size == SINGLE_NODE) return;
+  
+  /*--- Static weight of the domain points of this rank, as in
+   SetColorGrid_Parallel, and the time it took to compute them ---*/
   
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    if (GetPartition_Heavy_Marker(config, iMarker))
+      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+        Heavy[vertex[iMarker][iVertex]->GetNode()] = true;
+  
+  MyLoad[0] = SU2_TYPE::GetValue(val_time); MyLoad[1] = 0.0;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    MyLoad[1] += (1.0 + node[iPoint]->GetnPoint())*(Heavy[iPoint]? SU2_TYPE::GetValue(config->GetPartition_Wall_Weight()) : 1.0);
+  
+#ifdef HAVE_MPI
+  MPI_Allreduce(MyLoad, Load, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Load[0] = MyLoad[0]; Load[1] = MyLoad[1];
+#endif
+  
+  if ((Load[0] <= 0.0) || (MyLoad[1] <= 0.0)) return;
+  
+  /*--- Time per unit of static weight of this rank, relative to the average:
+   what the static weights miss, applied to all the points of the rank ---*/
+  
+  Correction = (MyLoad[0]/MyLoad[1])/(Load[0]/Load[1]);
+  
+  string cost_filename = config->GetMultizone_FileName(config->GetPartition_Cost_FileName(), config->GetiZone());
+  
+  if (rank == MASTER_NODE)
+    cout << "Writing the partition cost file (" << cost_filename << ")." << endl;
+  
+  /*--- The ranks write their points one after the other ---*/
+  
+  for (iRank = 0; iRank < size; iRank++) {
+    if (rank == iRank) {
+      ofstream cost_file;
+      if (rank == MASTER_NODE) {
+        cost_file.open(cost_filename.c_str(), ios::out);
+        cost_file << "% Global index of the point, correction of its partition weight" << endl;
+      }
+      else cost_file.open(cost_filename.c_str(), ios::app);
+      cost_file.precision(6);
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        cost_file << node[iPoint]->GetGlobalIndex() << "\t" << Correction << "\n";
+      cost_file.close();
+    }
+#ifdef HAVE_MPI
+    SU2_MPI::Barrier(MPI_COMM_WORLD);
+#endif
+  }
+  
+}
+
+void CPhysicalGeometry::CollectLinear_State(CConfig *config, su2double *val_state, unsigned short val_nState,
+                                            unsigned long &val_nPoint_Global, vector<su2double> &val_linear) {
+  
+  unsigned long iPoint, MyMax_Global = 0;
+  unsigned short iCount, nCount = val_nState+1;
+  int iProc, iSend, iRecv, nSends = 0, nRecvs = 0;
+  SU2_MPI::Request *idSendReq = NULL, *stateSendReq = NULL;
+  SU2_MPI::Request *idRecvReq = NULL, *stateRecvReq = NULL;
+  
+  /*--- Linear partitioning of the global indices, as done by the grid readers ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    MyMax_Global = max(MyMax_Global, node[iPoint]->GetGlobalIndex());
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&MyMax_Global, &val_nPoint_Global, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
+#else
+  val_nPoint_Global = MyMax_Global;
 #endif
+  val_nPoint_Global++;
+  
+  vector<unsigned long> Linear_Begin(size+1, 0);
+  for (iProc = 0; iProc < size; iProc++)
+    Linear_Begin[iProc+1] = Linear_Begin[iProc] + val_nPoint_Global/size + ((unsigned long)iProc < val_nPoint_Global%size);
+  
+  /*--- Every local point (halos included, the periodic ones may have no
+   owner) is sent to the rank of its global index. ---*/
+  
+  int *nPoint_Send = new int[size+1]; nPoint_Send[0] = 0;
+  int *nPoint_Recv = new int[size+1]; nPoint_Recv[0] = 0;
+  for (iProc = 0; iProc < size; iProc++) { nPoint_Send[iProc+1] = 0; nPoint_Recv[iProc+1] = 0; }
+  
+  vector<int> Linear_Rank(nPoint);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Linear_Rank[iPoint] = int(upper_bound(Linear_Begin.begin(), Linear_Begin.end(), node[iPoint]->GetGlobalIndex()) - Linear_Begin.begin()) - 1;
+    nPoint_Send[Linear_Rank[iPoint]+1]++;
+  }
+  
+  SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
+                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  for (iProc = 0; iProc < size; iProc++) {
+    if ((iProc != rank) && (nPoint_Send[iProc+1] > 0)) nSends++;
+    if ((iProc != rank) && (nPoint_Recv[iProc+1] > 0)) nRecvs++;
+    nPoint_Send[iProc+1] += nPoint_Send[iProc];
+    nPoint_Recv[iProc+1] += nPoint_Recv[iProc];
+  }
+  
+  /*--- Load the global index, the flag (2 for the owner of the point, 1 for
+   a halo copy) and the state of each point. ---*/
+  
+  unsigned long *idSend = new unsigned long[nPoint_Send[size]];
+  su2double *stateSend  = new su2double[nCount*nPoint_Send[size]];
+  
+  vector<int> Send_Index(nPoint_Send, nPoint_Send+size);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    iSend = Send_Index[Linear_Rank[iPoint]]++;
+    idSend[iSend] = node[iPoint]->GetGlobalIndex();
+    stateSend[iSend*nCount] = (node[iPoint]->GetDomain())? 2.0 : 1.0;
+    for (iCount = 1; iCount < nCount; iCount++)
+      stateSend[iSend*nCount+iCount] = val_state[iPoint*val_nState+iCount-1];
+  }
+  
+  unsigned long *idRecv = new unsigned long[nPoint_Recv[size]];
+  su2double *stateRecv  = new su2double[nCount*nPoint_Recv[size]];
+  
+  if (nSends > 0) {
+    idSendReq    = new SU2_MPI::Request[nSends];
+    stateSendReq = new SU2_MPI::Request[nSends];
+  }
+  if (nRecvs > 0) {
+    idRecvReq    = new SU2_MPI::Request[nRecvs];
+    stateRecvReq = new SU2_MPI::Request[nRecvs];
+  }
+  
+  InitiateComms(idSend, nPoint_Send, idSendReq,
+                idRecv, nPoint_Recv, idRecvReq,
+                1, COMM_TYPE_UNSIGNED_LONG);
+  
+  InitiateComms(stateSend, nPoint_Send, stateSendReq,
+                stateRecv, nPoint_Recv, stateRecvReq,
+                nCount, COMM_TYPE_DOUBLE);
+  
+  /*--- Copy my own rank's data into the recv buffer directly. ---*/
+  
+  iRecv = nPoint_Recv[rank];
+  for (iSend = nPoint_Send[rank]; iSend < nPoint_Send[rank+1]; iSend++) {
+    idRecv[iRecv] = idSend[iSend];
+    for (iCount = 0; iCount < nCount; iCount++)
+      stateRecv[iRecv*nCount+iCount] = stateSend[iSend*nCount+iCount];
+    iRecv++;
+  }
+  
+  CompleteComms(nSends,    idSendReq, nRecvs,    idRecvReq);
+  CompleteComms(nSends, stateSendReq, nRecvs, stateRecvReq);
+  
+  /*--- Keep the copy of the owner of each point, or a halo copy if no
+   rank owns it. ---*/
+  
+  val_linear.assign(nCount*(Linear_Begin[rank+1]-Linear_Begin[rank]), 0.0);
+  
+  for (iRecv = 0; iRecv < nPoint_Recv[size]; iRecv++) {
+    iPoint = idRecv[iRecv] - Linear_Begin[rank];
+    if (stateRecv[iRecv*nCount] >= val_linear[iPoint*nCount])
+      for (iCount = 0; iCount < nCount; iCount++)
+        val_linear[iPoint*nCount+iCount] = stateRecv[iRecv*nCount+iCount];
+  }
+  
+  /*--- Free temporary memory from communications ---*/
+  
+  if (idSendReq    != NULL) delete [] idSendReq;
+  if (stateSendReq != NULL) delete [] stateSendReq;
+  if (idRecvReq    != NULL) delete [] idRecvReq;
+  if (stateRecvReq != NULL) delete [] stateRecvReq;
+  
+  delete [] idSend;
+  delete [] idRecv;
+  delete [] stateSend;
+  delete [] stateRecv;
+  delete [] nPoint_Send;
+  delete [] nPoint_Recv;
+  
+}
+
+void CPhysicalGeometry::DistributeLinear_State(CConfig *config, vector<su2double> &val_linear, unsigned short val_nState,
+                                               unsigned long val_nPoint_Global, su2double *val_state) {
+  
+  unsigned long iPoint, nMissing = 0, nMissing_Global = 0;
+  unsigned short iCount, nCount = val_nState+1;
+  int iProc, iSend, iRecv, nSends = 0, nRecvs = 0;
+  SU2_MPI::Request *idSendReq = NULL, *stateSendReq = NULL;
+  SU2_MPI::Request *idRecvReq = NULL, *stateRecvReq = NULL;
+  
+  vector<unsigned long> Linear_Begin(size+1, 0);
+  for (iProc = 0; iProc < size; iProc++)
+    Linear_Begin[iProc+1] = Linear_Begin[iProc] + val_nPoint_Global/size + ((unsigned long)iProc < val_nPoint_Global%size);
+  
+  /*--- Ask the rank of the linear partitioning of each local point for its state ---*/
+  
+  int *nPoint_Send = new int[size+1]; nPoint_Send[0] = 0;
+  int *nPoint_Recv = new int[size+1]; nPoint_Recv[0] = 0;
+  for (iProc = 0; iProc < size; iProc++) { nPoint_Send[iProc+1] = 0; nPoint_Recv[iProc+1] = 0; }
+  
+  vector<int> Linear_Rank(nPoint);
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Linear_Rank[iPoint] = int(upper_bound(Linear_Begin.begin(), Linear_Begin.end(), node[iPoint]->GetGlobalIndex()) - Linear_Begin.begin()) - 1;
+    nPoint_Send[Linear_Rank[iPoint]+1]++;
+  }
+  
+  SU2_MPI::Alltoall(&(nPoint_Send[1]), 1, MPI_INT,
+                    &(nPoint_Recv[1]), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  for (iProc = 0; iProc < size; iProc++) {
+    if ((iProc != rank) && (nPoint_Send[iProc+1] > 0)) nSends++;
+    if ((iProc != rank) && (nPoint_Recv[iProc+1] > 0)) nRecvs++;
+    nPoint_Send[iProc+1] += nPoint_Send[iProc];
+    nPoint_Recv[iProc+1] += nPoint_Recv[iProc];
+  }
+  
+  unsigned long *idSend = new unsigned long[nPoint_Send[size]];
+  unsigned long *idRecv = new unsigned long[nPoint_Recv[size]];
+  
+  vector<int> Send_Index(nPoint_Send, nPoint_Send+size);
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    idSend[Send_Index[Linear_Rank[iPoint]]++] = node[iPoint]->GetGlobalIndex();
+  
+  if (nSends > 0) {
+    idSendReq    = new SU2_MPI::Request[nSends];
+    stateRecvReq = new SU2_MPI::Request[nSends];
+  }
+  if (nRecvs > 0) {
+    idRecvReq    = new SU2_MPI::Request[nRecvs];
+    stateSendReq = new SU2_MPI::Request[nRecvs];
+  }
+  
+  InitiateComms(idSend, nPoint_Send, idSendReq,
+                idRecv, nPoint_Recv, idRecvReq,
+                1, COMM_TYPE_UNSIGNED_LONG);
+  
+  iRecv = nPoint_Recv[rank];
+  for (iSend = nPoint_Send[rank]; iSend < nPoint_Send[rank+1]; iSend++)
+    idRecv[iRecv++] = idSend[iSend];
+  
+  CompleteComms(nSends, idSendReq, nRecvs, idRecvReq);
+  
+  /*--- Answer with the flag and the state of the requested points, in the
+   order of the requests (the roles of the counters are swapped). ---*/
+  
+  su2double *stateSend = new su2double[nCount*nPoint_Recv[size]];
+  su2double *stateRecv = new su2double[nCount*nPoint_Send[size]];
+  
+  for (iRecv = 0; iRecv < nPoint_Recv[size]; iRecv++) {
+    iPoint = idRecv[iRecv] - Linear_Begin[rank];
+    for (iCount = 0; iCount < nCount; iCount++)
+      stateSend[iRecv*nCount+iCount] = val_linear[iPoint*nCount+iCount];
+  }
+  
+  InitiateComms(stateSend, nPoint_Recv, stateSendReq,
+                stateRecv, nPoint_Send, stateRecvReq,
+                nCount, COMM_TYPE_DOUBLE);
+  
+  iSend = nPoint_Send[rank];
+  for (iRecv = nPoint_Recv[rank]; iRecv < nPoint_Recv[rank+1]; iRecv++) {
+    for (iCount = 0; iCount < nCount; iCount++)
+      stateRecv[iSend*nCount+iCount] = stateSend[iRecv*nCount+iCount];
+    iSend++;
+  }
+  
+  CompleteComms(nRecvs, stateSendReq, nSends, stateRecvReq);
+  
+  /*--- Store the state of the local points, every domain point must have one ---*/
+  
+  for (iProc = 0; iProc < size; iProc++) Send_Index[iProc] = nPoint_Send[iProc];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    iSend = Send_Index[Linear_Rank[iPoint]]++;
+    if (stateRecv[iSend*nCount] > 0.0) {
+      for (iCount = 1; iCount < nCount; iCount++)
+        val_state[iPoint*val_nState+iCount-1] = stateRecv[iSend*nCount+iCount];
+    }
+    else if (node[iPoint]->GetDomain()) nMissing++;
+  }
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nMissing, &nMissing_Global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#else
+  nMissing_Global = nMissing;
 #endif
   
+  if (nMissing_Global > 0) {
+    SU2_MPI::Error(string("The state of some points was lost while moving it to the new partition.\n") +
+                   string("The old and the new partitions do not share the same global indices."), CURRENT_FUNCTION);
+  }
+  
+  /*--- Free temporary memory from communications ---*/
+  
+  if (idSendReq    != NULL) delete [] idSendReq;
+  if (stateSendReq != NULL) delete [] stateSendReq;
+  if (idRecvReq    != NULL) delete [] idRecvReq;
+  if (stateRecvReq != NULL) delete [] stateRecvReq;
+  
+  delete [] idSend;
+  delete [] idRecv;
+  delete [] stateSend;
+  delete [] stateRecv;
+  delete [] nPoint_Send;
+  delete [] nPoint_Recv;
+  
 }
 
 void CPhysicalGeometry::GetQualityStatistics(su2double *statistics) {
@@ -21199,6 +23596,8 @@ void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
   su2double *Coordinates_Fine, *Coordinates;
   Coordinates = new su2double[nDim];
   
+  LSWeight_Valid = false;
+  
   for (Point_Coarse = 0; Point_Coarse < GetnPoint(); Point_Coarse++) {
     Area_Parent = node[Point_Coarse]->GetVolume();
     for (iDim = 0; iDim < nDim; iDim++) Coordinates[iDim] = 0.0;
@@ -22025,6 +24424,13 @@ void CPeriodicGeometry::SetMeshFile(CGeometry *geometry, CConfig *config, string
   char *cstr;
   su2double *center, *angles, *transl;
   
+  /*--- The renumbered periodic grid is only written in the ASCII format ---*/
+  
+  if (config->GetMesh_Out_FileFormat() == SU2_BINARY) {
+    SU2_MPI::Error(string("The periodic grid can not be written as a SU2_BINARY mesh.\n") +
+                   string("Please set MESH_OUT_FORMAT= SU2 and try again."), CURRENT_FUNCTION);
+  }
+  
   cstr = new char [val_mesh_out_filename.size()+1];
   strcpy (cstr, val_mesh_out_filename.c_str());
   
@@ -22466,3 +24872,135 @@ void CMultiGridQueue::Update(unsigned long iPoint, CGeometry *fine_grid) {
   }
   
 }
+
+CHaloExchange::CHaloExchange(CGeometry *val_geometry, unsigned short val_nCount) {
+  
+  unsigned short nNeighbor;
+  
+  geometry = val_geometry;
+  nCount   = val_nCount;
+  nNeighbor = geometry->GetnHalo_Neighbor();
+  
+  Buffer_Send = new su2double [max(geometry->GetHalo_Send_Begin(nNeighbor)*nCount, (unsigned long)1)];
+  Buffer_Recv = new su2double [max(geometry->GetHalo_Recv_Begin(nNeighbor)*nCount, (unsigned long)1)];
+  
+  nRequest = 0;
+  Request = new SU2_MPI::Request [2*nNeighbor+1];
+  Request_Status = new SU2_MPI::Status [2*nNeighbor+1];
+  Active = false;
+  
+  /*--- MeDiPack has no persistent requests, the AD builds post new ones at each exchange ---*/
+  
+#if defined HAVE_MPI && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  Persistent = true;
+  PostRequests(true);
+#else
+  Persistent = false;
+#endif
+  
+}
+
+CHaloExchange::~CHaloExchange(void) {
+  
+#if defined HAVE_MPI && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (Active) Complete();
+  for (int iRequest = 0; iRequest < nRequest; iRequest++)
+    SU2_MPI::Request_free(&Request[iRequest]);
+#endif
+  
+  delete [] Buffer_Send;
+  delete [] Buffer_Recv;
+  delete [] Request;
+  delete [] Request_Status;
+  
+}
+
+void CHaloExchange::PostRequests(bool val_init) {
+  
+#ifdef HAVE_MPI
+  
+  unsigned short iNeighbor, nNeighbor = geometry->GetnHalo_Neighbor();
+  unsigned long offset;
+  int count;
+  
+  nRequest = 0;
+  
+  /*--- Receives first, the messages of a pair of ranks are matched in marker
+   order (same tag), as with the blocking exchange. Zero length messages are
+   skipped on both sides. ---*/
+  
+  for (iNeighbor = 0; iNeighbor < nNeighbor; iNeighbor++) {
+    offset = geometry->GetHalo_Recv_Begin(iNeighbor);
+    count  = nCount*(geometry->GetHalo_Recv_Begin(iNeighbor+1)-offset);
+    if (count == 0) continue;
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+    if (val_init)
+      SU2_MPI::Recv_init(&Buffer_Recv[offset*nCount], count, MPI_DOUBLE, geometry->GetHalo_Recv_Rank(iNeighbor),
+                         0, MPI_COMM_WORLD, &Request[nRequest]);
+    else
+#endif
+      SU2_MPI::Irecv(&Buffer_Recv[offset*nCount], count, MPI_DOUBLE, geometry->GetHalo_Recv_Rank(iNeighbor),
+                     0, MPI_COMM_WORLD, &Request[nRequest]);
+    nRequest++;
+  }
+  
+  for (iNeighbor = 0; iNeighbor < nNeighbor; iNeighbor++) {
+    offset = geometry->GetHalo_Send_Begin(iNeighbor);
+    count  = nCount*(geometry->GetHalo_Send_Begin(iNeighbor+1)-offset);
+    if (count == 0) continue;
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+    if (val_init)
+      SU2_MPI::Send_init(&Buffer_Send[offset*nCount], count, MPI_DOUBLE, geometry->GetHalo_Send_Rank(iNeighbor),
+                         0, MPI_COMM_WORLD, &Request[nRequest]);
+    else
+#endif
+      SU2_MPI::Isend(&Buffer_Send[offset*nCount], count, MPI_DOUBLE, geometry->GetHalo_Send_Rank(iNeighbor),
+                     0, MPI_COMM_WORLD, &Request[nRequest]);
+    nRequest++;
+  }
+  
+#endif
+  
+}
+
+void CHaloExchange::Start(void) {
+  
+  /*--- A previous exchange must be finished before its requests are reused ---*/
+  
+  if (Active) Complete();
+  Active = true;
+  
+#ifdef HAVE_MPI
+  
+#if !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (Persistent) {
+    if (nRequest > 0) SU2_MPI::Startall(nRequest, Request);
+    return;
+  }
+#endif
+  PostRequests(false);
+  
+#else
+  
+  /*--- Without MPI the pairs are the periodic ones, sent to this same process ---*/
+  
+  unsigned short nNeighbor = geometry->GetnHalo_Neighbor();
+  unsigned long iValue, nValue = min(geometry->GetHalo_Send_Begin(nNeighbor),
+                                     geometry->GetHalo_Recv_Begin(nNeighbor))*nCount;
+  for (iValue = 0; iValue < nValue; iValue++)
+    Buffer_Recv[iValue] = Buffer_Send[iValue];
+  
+#endif
+  
+}
+
+void CHaloExchange::Complete(void) {
+  
+  if (!Active) return;
+  Active = false;
+  
+#ifdef HAVE_MPI
+  if (nRequest > 0) SU2_MPI::Waitall(nRequest, Request, Request_Status);
+#endif
+  
+}
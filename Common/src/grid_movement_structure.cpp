@@ -209,6 +209,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     	if (config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# LU_SGS preconditioner." << endl;
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+    		StiffMatrix.BuildLU_SGSPreconditioner();
     		precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == ILU) {
@@ -223,14 +224,26 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		StiffMatrix.BuildAMGPreconditioner();
+    		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
-    	/*--- Build the ILU or Jacobi preconditioner for the transposed system ---*/
+    	/*--- Build the ILU or Jacobi preconditioner for the transposed system,
+    	 LU_SGS and AMG have no transposed version and fall back to ILU. ---*/
 
     	if ((config->GetKind_Deform_Linear_Solver_Prec() == ILU) ||
-    			(config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS)) {
-        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# ILU preconditioner." << endl;
+    			(config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS) ||
+    			(config->GetKind_Deform_Linear_Solver_Prec() == AMG)) {
+        if ((rank == MASTER_NODE) && Screen_Output) {
+          if (config->GetKind_Deform_Linear_Solver_Prec() != ILU)
+            cout << "\n# No transposed version of the requested preconditioner, using ILU." << endl;
+          cout << "\n# ILU preconditioner." << endl;
+        }
     		StiffMatrix.BuildILUPreconditioner(true);
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
     		precond = new CILUPreconditioner(StiffMatrix, geometry, config);
@@ -244,7 +257,12 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
     }
 
+    if ((mat_vec == NULL) || (precond == NULL)) {
+      SU2_MPI::Error("The DEFORM_LINEAR_SOLVER_PREC is not available for the mesh deformation.", CURRENT_FUNCTION);
+    }
+
     CSysSolve *system  = new CSysSolve();
+    system->SetKind_Orthogonalization(config->GetKind_Linear_Solver_Orthogonalization());
     
     if (LinSysRes.norm() != 0.0){
       switch (config->GetKind_Deform_Linear_Solver()) {
@@ -302,6 +320,22 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           break;
 
+          /*--- Solve the linear system (pipelined GMRES) ---*/
+
+        case PIPELINED_FGMRES:
+
+          Tot_Iter = system->PipelinedFGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+
+          break;
+
+          /*--- Solve the linear system (pipelined BCGSTAB) ---*/
+
+        case PIPELINED_BCGSTAB:
+
+          Tot_Iter = system->PipelinedBCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+
+          break;
+
 
         case CONJUGATE_GRADIENT:
 
@@ -6990,6 +7024,13 @@ void CSurfaceMovement::ReadFFDInfo(CGeometry *geometry, CConfig *config, CFreeFo
   unsigned short SplineOrder[3];
   unsigned short Blending = 0;
 
+  /*--- The FFD boxes are text sections at the end of an ASCII SU2 mesh, a binary mesh does not store them ---*/
+  
+  if (config->GetMesh_FileFormat() == SU2_BINARY) {
+    SU2_MPI::Error(string("The FFD boxes can not be read from a SU2_BINARY mesh.\n") +
+                   string("Please use a mesh in the SU2 format (MESH_FORMAT= SU2) and try again."), CURRENT_FUNCTION);
+  }
+  
 	char *cstr = new char [val_mesh_filename.size()+1];
 	strcpy (cstr, val_mesh_filename.c_str());
 	
@@ -7815,6 +7856,13 @@ void CSurfaceMovement::WriteFFDInfo(CSurfaceMovement** surface_movement, CGeomet
 
   unsigned short nDim = geometry[ZONE_0]->GetnDim();
   
+  /*--- The FFD boxes are appended as text, which would be read as mesh data after a binary mesh ---*/
+  
+  if ((nFFDBox != 0) && (config[ZONE_0]->GetMesh_Out_FileFormat() == SU2_BINARY)) {
+    SU2_MPI::Error(string("The FFD boxes can not be written to a SU2_BINARY mesh.\n") +
+                   string("Please set MESH_OUT_FORMAT= SU2 and try again."), CURRENT_FUNCTION);
+  }
+  
   for (iZone = 0; iZone < config[ZONE_0]->GetnZone(); iZone++){
 
     /*--- Merge the parallel FFD info ---*/
@@ -9528,6 +9576,7 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
 
   CMatrixVectorProduct* mat_vec = NULL;
   CSysSolve *system  = new CSysSolve();
+  system->SetKind_Orthogonalization(config->GetKind_Linear_Solver_Orthogonalization());
 
   bool TapeActive = NO;
 
@@ -9557,7 +9606,9 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
   if (config->GetKind_Deform_Linear_Solver() == BCGSTAB ||
       config->GetKind_Deform_Linear_Solver() == FGMRES ||
       config->GetKind_Deform_Linear_Solver() == RESTARTED_FGMRES ||
-      config->GetKind_Deform_Linear_Solver() == CONJUGATE_GRADIENT) {
+      config->GetKind_Deform_Linear_Solver() == CONJUGATE_GRADIENT ||
+      config->GetKind_Deform_Linear_Solver() == PIPELINED_FGMRES ||
+      config->GetKind_Deform_Linear_Solver() == PIPELINED_BCGSTAB) {
 
     /*--- Independently of whether we are using or not derivatives,
      *--- as the matrix is now symmetric, the matrix-vector product
@@ -9578,12 +9629,17 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
       precond = new CILUPreconditioner(StiffMatrix, geometry, config);
       break;
     case LU_SGS:
+      StiffMatrix.BuildLU_SGSPreconditioner();
       precond = new CLU_SGSPreconditioner(StiffMatrix, geometry, config);
       break;
     case LINELET:
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner(StiffMatrix, geometry, config);
       break;
+    case AMG:
+      StiffMatrix.BuildAMGPreconditioner();
+      precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      break;
     default:
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
@@ -9600,6 +9656,12 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
     case CONJUGATE_GRADIENT:
       IterLinSol = system->CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
       break;
+    case PIPELINED_FGMRES:
+      IterLinSol = system->PipelinedFGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
+      break;
+    case PIPELINED_BCGSTAB:
+      IterLinSol = system->PipelinedBCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
+      break;
     case RESTARTED_FGMRES:
       IterLinSol = 0;
       while (IterLinSol < config->GetLinear_Solver_Iter()) {
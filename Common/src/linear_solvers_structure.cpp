@@ -177,6 +177,97 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<
 
 }
 
+void CSysSolve::GramSchmidtProducts(int i, const vector<CSysVector> & w, vector<su2double> & prod) {
+  
+  prod.resize(i+2);
+  for (int k = 0; k < i+1; k++)
+    prod[k] = dotProdLocal(w[k], w[i+1]);
+  prod[i+1] = dotProdLocal(w[i+1], w[i+1]);
+  
+}
+
+void CSysSolve::ClassicalGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w,
+                                     const vector<su2double> & prod, vector<CSysVector> *z) {
+  
+  /*--- Parameter for reorthonormalization (squared 1/sqrt(2), "twice is enough") ---*/
+  
+  static const su2double reorth = 0.5;
+  
+  /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN, the products are global
+   so all ranks take the same decision without further communication ---*/
+  
+  su2double nrm0 = prod[i+1];
+  
+  if ((nrm0 <= 0.0) || (nrm0 != nrm0)) {
+    SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
+  }
+  
+  /*--- First pass, the norm of the result is obtained from the products ---*/
+  
+  su2double nrm = nrm0;
+  for (int k = 0; k < i+1; k++) {
+    Hsbg[k][i] = prod[k];
+    w[i+1].Plus_AX(-prod[k], w[k]);
+    if (z != NULL) (*z)[i+1].Plus_AX(-prod[k], (*z)[k]);
+    nrm -= prod[k]*prod[k];
+  }
+  
+  /*--- Second pass if too much cancellation took place, the norm is then
+   obtained from the products of the second pass ---*/
+  
+  if (nrm < reorth*nrm0) {
+    
+    vector<su2double> local, global(i+2, 0.0);
+    SU2_MPI::Request request;
+    
+    GramSchmidtProducts(i, w, local);
+    StartReduction(local, global, &request);
+    FinishReduction(&request);
+    
+    nrm = global[i+1];
+    for (int k = 0; k < i+1; k++) {
+      Hsbg[k][i] += global[k];
+      w[i+1].Plus_AX(-global[k], w[k]);
+      if (z != NULL) (*z)[i+1].Plus_AX(-global[k], (*z)[k]);
+      nrm -= global[k]*global[k];
+    }
+    
+  }
+  
+  /*--- Fall back to an explicit norm if the estimate is not usable ---*/
+  
+  if (nrm > 0.0) nrm = sqrt(nrm);
+  else nrm = w[i+1].norm();
+  Hsbg[i+1][i] = nrm;
+  
+  /*--- Scale the resulting vector ---*/
+  
+  w[i+1] /= nrm;
+  if (z != NULL) (*z)[i+1] /= nrm;
+  
+}
+
+void CSysSolve::StartReduction(vector<su2double> & local, vector<su2double> & global, SU2_MPI::Request *request) {
+  
+  global.resize(local.size());
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Iallreduce(&local[0], &global[0], (int)local.size(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD, request);
+#else
+  global = local;
+#endif
+  
+}
+
+void CSysSolve::FinishReduction(SU2_MPI::Request *request) {
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Status status;
+  SU2_MPI::Wait(request, &status);
+#endif
+  
+}
+
 void CSysSolve::WriteHeader(const string & solver, const su2double & restol, const su2double & resinit) {
   
   cout << "\n# " << solver << " residual history" << endl;
@@ -341,6 +432,8 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   vector<su2double> cs(m+1, 0.0);
   vector<su2double> y(m, 0.0);
   vector<vector<su2double> > H(m+1, vector<su2double>(m, 0.0));
+  vector<su2double> local, global;
+  SU2_MPI::Request request;
   
   /*---  Calculate the norm of the rhs vector ---*/
   
@@ -399,9 +492,17 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     
     mat_vec(z[i], w[i+1]);
     
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Gram-Schmidt orthogonalization ---*/
     
-    ModGramSchmidt(i, H, w);
+    if (Kind_Orthogonalization == CLASSICAL_GRAM_SCHMIDT) {
+      GramSchmidtProducts(i, w, local);
+      StartReduction(local, global, &request);
+      FinishReduction(&request);
+      ClassicalGramSchmidt(i, H, w, global, NULL);
+    }
+    else {
+      ModGramSchmidt(i, H, w);
+    }
     
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix
 		 then generate the new Givens rotation matrix and apply it to
@@ -587,12 +688,536 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
   return (unsigned long) i;
 }
 
+unsigned long CSysSolve::FGCRO_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                         CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = SU2_MPI::GetRank();
+  unsigned short iRec, jRec;
+  
+  /*---  Check the subspace size ---*/
+  
+  if (m < 1) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size, m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  if (m > 5000) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size (too high), m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  /*---  The recycled directions are only valid for systems of the same size ---*/
+  
+  if ((!Recycle_U.empty()) && (Recycle_U[0].GetLocSize() != x.GetLocSize())) {
+    Recycle_U.clear();
+    Recycle_C.clear();
+  }
+  
+  /*---  Images of the recycled directions with the current operator, C = A*U,
+   orthonormalized by modified Gram-Schmidt (the same combinations are applied
+   to U), the directions that became dependent are dropped ---*/
+  
+  Recycle_C.resize(Recycle_U.size(), x);
+  for (iRec = 0; iRec < Recycle_U.size(); iRec++)
+    mat_vec(Recycle_U[iRec], Recycle_C[iRec]);
+  
+  for (iRec = 0; iRec < Recycle_U.size(); ) {
+    su2double nrm0 = Recycle_C[iRec].norm();
+    for (jRec = 0; jRec < iRec; jRec++) {
+      su2double prod = dotProd(Recycle_C[jRec], Recycle_C[iRec]);
+      Recycle_C[iRec].Plus_AX(-prod, Recycle_C[jRec]);
+      Recycle_U[iRec].Plus_AX(-prod, Recycle_U[jRec]);
+    }
+    su2double nrm = Recycle_C[iRec].norm();
+    if ((nrm0 == 0.0) || (nrm < 1E-8*nrm0)) {
+      Recycle_U.erase(Recycle_U.begin()+iRec);
+      Recycle_C.erase(Recycle_C.begin()+iRec);
+      continue;
+    }
+    Recycle_C[iRec] /= nrm;
+    Recycle_U[iRec] /= nrm;
+    iRec++;
+  }
+  
+  const unsigned short nRec = Recycle_U.size();
+  
+  /*---  Define various arrays (see FGMRES_LinSolver), B holds the products of
+   the Arnoldi vectors with the recycled images ---*/
+  
+  vector<CSysVector> w(m+1, x);
+  vector<CSysVector> z(m+1, x);
+  vector<su2double> g(m+1, 0.0);
+  vector<su2double> sn(m+1, 0.0);
+  vector<su2double> cs(m+1, 0.0);
+  vector<su2double> y(m, 0.0);
+  vector<vector<su2double> > H(m+1, vector<su2double>(m, 0.0));
+  vector<vector<su2double> > B(nRec, vector<su2double>(m, 0.0));
+  vector<su2double> local, global;
+  SU2_MPI::Request request;
+  
+  /*---  Initial residual (positive here), its norm is the reference of the
+   convergence criterion so that the projection counts as progress ---*/
+  
+  mat_vec(x, w[0]);
+  w[0] -= b;
+  w[0] *= -1.0;
+  
+  su2double norm0 = w[0].norm();
+  
+  if ( (norm0 < tol*b.norm()) || (norm0 < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::FGCRO(): system solved by initial guess." << endl;
+    return 0;
+  }
+  
+  /*---  Project the residual out of the recycled subspace, x += U*C^T*r ---*/
+  
+  for (iRec = 0; iRec < nRec; iRec++) {
+    su2double prod = dotProd(Recycle_C[iRec], w[0]);
+    x.Plus_AX(prod, Recycle_U[iRec]);
+    w[0].Plus_AX(-prod, Recycle_C[iRec]);
+  }
+  
+  su2double beta = w[0].norm();
+  
+  if (beta != 0.0) w[0] /= beta;
+  g[0] = beta;
+  
+  int i = 0;
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("FGCRO", tol, norm0);
+    WriteHistory(i, beta, norm0);
+  }
+  
+  /*---  Loop over all search directions ---*/
+  
+  for (i = 0; i < (int)m; i++) {
+    
+    if (beta < tol*norm0) break;
+    
+    precond(w[i], z[i]);
+    mat_vec(z[i], w[i+1]);
+    
+    /*---  Orthogonalize against the recycled images, then against the Krylov basis ---*/
+    
+    for (iRec = 0; iRec < nRec; iRec++) {
+      B[iRec][i] = dotProd(Recycle_C[iRec], w[i+1]);
+      w[i+1].Plus_AX(-B[iRec][i], Recycle_C[iRec]);
+    }
+    
+    if (Kind_Orthogonalization == CLASSICAL_GRAM_SCHMIDT) {
+      GramSchmidtProducts(i, w, local);
+      StartReduction(local, global, &request);
+      FinishReduction(&request);
+      ClassicalGramSchmidt(i, H, w, global, NULL);
+    }
+    else {
+      ModGramSchmidt(i, H, w);
+    }
+    
+    for (int k = 0; k < i; k++)
+      ApplyGivens(sn[k], cs[k], H[k][i], H[k+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+    
+    beta = fabs(g[i+1]);
+    
+    if (((monitoring) && (rank == MASTER_NODE)) && ((i+1) % 10 == 0)) WriteHistory(i+1, beta, norm0);
+    
+  }
+  
+  /*---  Solve the least-squares system, the correction d = Z*y - U*B*y
+   (A*d = W*H*y since A*Z = C*B + W*H) updates the solution and becomes
+   the newest recycled direction ---*/
+  
+  if (i > 0) {
+    
+    SolveReduced(i, H, g, y);
+    
+    CSysVector d(x);
+    d = 0.0;
+    for (int k = 0; k < i; k++)
+      d.Plus_AX(y[k], z[k]);
+    for (iRec = 0; iRec < nRec; iRec++) {
+      su2double prod = 0.0;
+      for (int k = 0; k < i; k++) prod += B[iRec][k]*y[k];
+      d.Plus_AX(-prod, Recycle_U[iRec]);
+    }
+    
+    x += d;
+    
+    su2double nrm = d.norm();
+    if ((nRecycle > 0) && (nrm > 0.0)) {
+      d /= nrm;
+      if (Recycle_U.size() == nRecycle) Recycle_U.erase(Recycle_U.begin());
+      Recycle_U.push_back(d);
+    }
+    
+  }
+  
+  /*---  The images are recomputed in the next call ---*/
+  
+  Recycle_C.clear();
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# FGCRO final (true) residual:" << endl;
+    cout << "# Iteration = " << i << ": |res|/|res0| = " << beta/norm0 << ".\n" << endl;
+  }
+  
+  if (monitoring) {
+    mat_vec(x, w[0]);
+    w[0] -= b;
+    su2double res = w[0].norm();
+    
+    if ((fabs(res - beta) > tol*10) && (rank == MASTER_NODE)) {
+      cout << "# WARNING in CSysSolve::FGCRO_LinSolver(): " << endl;
+      cout << "# true residual norm and calculated residual norm do not agree." << endl;
+      cout << "# res = " << res <<", beta = " << beta <<", tol = " << tol*10 <<"."<< endl;
+      cout << "# res - beta = " << res - beta << endl << endl;
+    }
+  }
+  
+  (*residual) = beta;
+  return (unsigned long) i;
+  
+}
+
+unsigned long CSysSolve::PipelinedFGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                   CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = SU2_MPI::GetRank();
+  
+  /*---  Check the subspace size ---*/
+  
+  if (m < 1) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size, m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  if (m > 5000) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size (too high), m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  /*---  Define various arrays, w is the Krylov basis and z the preconditioned basis ---*/
+  
+  vector<CSysVector> w(m+1, x);
+  vector<CSysVector> z(m+1, x);
+  vector<su2double> g(m+1, 0.0);
+  vector<su2double> sn(m+1, 0.0);
+  vector<su2double> cs(m+1, 0.0);
+  vector<su2double> y(m, 0.0);
+  vector<vector<su2double> > H(m+1, vector<su2double>(m, 0.0));
+  vector<su2double> local, global;
+  SU2_MPI::Request request;
+  
+  /*---  Calculate the norm of the rhs vector ---*/
+  
+  su2double norm0 = b.norm();
+  
+  /*---  Calculate the initial residual (actually the negative residual)
+   and compute its norm ---*/
+  
+  mat_vec(x, w[0]);
+  w[0] -= b;
+  
+  su2double beta = w[0].norm();
+  
+  if ( (beta < tol*norm0) || (beta < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::PipelinedFGMRES(): system solved by initial guess." << endl;
+    return 0;
+  }
+  
+  w[0] /= -beta;
+  g[0] = beta;
+  norm0 = beta;
+  
+  /*---  The first preconditioned vector is computed explicitly ---*/
+  
+  precond(w[0], z[0]);
+  
+  int i = 0;
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("Pipelined FGMRES", tol, beta);
+    WriteHistory(i, beta, norm0);
+  }
+  
+  /*---  Loop over all search directions ---*/
+  
+  for (i = 0; i < (int)m; i++) {
+    
+    /*---  Check if solution has converged ---*/
+    
+    if (beta < tol*norm0) break;
+    
+    /*---  Add to Krylov subspace and start the reduction of the Gram-Schmidt products ---*/
+    
+    mat_vec(z[i], w[i+1]);
+    
+    GramSchmidtProducts(i, w, local);
+    StartReduction(local, global, &request);
+    
+    /*---  Overlap the reduction with the preconditioning of the new vector,
+     the orthogonalization is then applied to it by linearity. The Arnoldi
+     relation A*z = w*H holds regardless, as in any flexible method. ---*/
+    
+    precond(w[i+1], z[i+1]);
+    
+    FinishReduction(&request);
+    
+    ClassicalGramSchmidt(i, H, w, global, &z);
+    
+    /*---  Apply old Givens rotations to new column of the Hessenberg matrix
+     then generate the new Givens rotation matrix and apply it to
+     the last two elements of H[:][i] and g ---*/
+    
+    for (int k = 0; k < i; k++)
+      ApplyGivens(sn[k], cs[k], H[k][i], H[k+1][i]);
+    GenerateGivens(H[i][i], H[i+1][i], sn[i], cs[i]);
+    ApplyGivens(sn[i], cs[i], g[i], g[i+1]);
+    
+    beta = fabs(g[i+1]);
+    
+    if (((monitoring) && (rank == MASTER_NODE)) && ((i+1) % 10 == 0)) WriteHistory(i+1, beta, norm0);
+    
+  }
+  
+  /*---  Solve the least-squares system and update solution ---*/
+  
+  SolveReduced(i, H, g, y);
+  for (int k = 0; k < i; k++) {
+    x.Plus_AX(y[k], z[k]);
+  }
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# Pipelined FGMRES final (true) residual:" << endl;
+    cout << "# Iteration = " << i << ": |res|/|res0| = " << beta/norm0 << ".\n" << endl;
+  }
+  
+  /*---  Recalculate final (neg.) residual (this should be optional) ---*/
+  
+  if (monitoring) {
+    mat_vec(x, w[0]);
+    w[0] -= b;
+    su2double res = w[0].norm();
+    
+    if ((fabs(res - beta) > tol*10) && (rank == MASTER_NODE)) {
+      cout << "# WARNING in CSysSolve::PipelinedFGMRES_LinSolver(): " << endl;
+      cout << "# true residual norm and calculated residual norm do not agree." << endl;
+      cout << "# res = " << res <<", beta = " << beta <<", tol = " << tol*10 <<"."<< endl;
+      cout << "# res - beta = " << res - beta << endl << endl;
+    }
+  }
+  
+  (*residual) = beta;
+  return (unsigned long) i;
+  
+}
+
+unsigned long CSysSolve::PipelinedBCGSTAB_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                    CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+  
+  int rank = SU2_MPI::GetRank();
+  
+  /*--- Check the subspace size ---*/
+  
+  if (m < 1) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size, m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  /*--- Vectors of the recurrences, the "hat" vectors are the preconditioned
+   counterparts (e.g. rhat = M^-1 r) and the following relations are kept:
+   w = A rhat, t = A what, s = A phat, z = A shat, v = A zhat, y = A qhat ---*/
+  
+  CSysVector r(b), r_0(b), rhat(b), w(b), what(b), t(b);
+  CSysVector phat(b), s(b), shat(b), z(b), zhat(b), v(b);
+  CSysVector q(b), qhat(b), y(b);
+  
+  vector<su2double> local(5, 0.0), global(5, 0.0);
+  SU2_MPI::Request request;
+  
+  /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
+  
+  mat_vec(x, t);
+  r -= t; r_0 = r; // recall, r holds b initially
+  su2double norm_r = r.norm();
+  su2double norm0 = b.norm();
+  if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::PipelinedBCGSTAB(): system solved by initial guess." << endl;
+    return 0;
+  }
+  
+  /*--- Initialization ---*/
+  
+  precond(r, rhat);
+  mat_vec(rhat, w);
+  precond(w, what);
+  mat_vec(what, t);
+  
+  phat = 0.0; s = 0.0; shat = 0.0; z = 0.0; zhat = 0.0; v = 0.0;
+  
+  su2double rho = dotProd(r_0, r);
+  su2double alpha = rho / dotProd(r_0, w), beta = 0.0, omega = 0.0;
+  
+  norm0 = norm_r;
+  
+  int i = 0;
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("Pipelined BCGSTAB", tol, norm_r);
+    WriteHistory(i, norm_r, norm0);
+  }
+  
+  /*---  Loop over all search directions ---*/
+  
+  for (i = 0; i < (int)m; i++) {
+    
+    /*--- Update the search directions and their products with A and M^-1 ---*/
+    
+    su2double beta_omega = -beta*omega;
+    phat.Equals_AX_Plus_BY(beta, phat, beta_omega, shat); phat += rhat;
+    s.Equals_AX_Plus_BY(beta, s, beta_omega, z);          s += w;
+    shat.Equals_AX_Plus_BY(beta, shat, beta_omega, zhat); shat += what;
+    z.Equals_AX_Plus_BY(beta, z, beta_omega, v);          z += t;
+    
+    q.Equals_AX_Plus_BY(1.0, r, -alpha, s);
+    qhat.Equals_AX_Plus_BY(1.0, rhat, -alpha, shat);
+    y.Equals_AX_Plus_BY(1.0, w, -alpha, z);
+    
+    /*--- First reduction, overlapped with zhat = M^-1 z and v = A zhat ---*/
+    
+    local.resize(2);
+    local[0] = dotProdLocal(q, y);
+    local[1] = dotProdLocal(y, y);
+    StartReduction(local, global, &request);
+    
+    precond(z, zhat);
+    mat_vec(zhat, v);
+    
+    FinishReduction(&request);
+    
+    omega = global[0] / global[1];
+    
+    /*--- Update solution and residuals ---*/
+    
+    x.Plus_AX(alpha, phat); x.Plus_AX(omega, qhat);
+    r.Equals_AX_Plus_BY(1.0, q, -omega, y);
+    rhat.Equals_AX_Plus_BY(1.0, qhat, -omega, what); rhat.Plus_AX(alpha*omega, zhat);
+    w.Equals_AX_Plus_BY(1.0, y, -omega, t);          w.Plus_AX(alpha*omega, v);
+    
+    /*--- Second reduction, overlapped with what = M^-1 w and t = A what ---*/
+    
+    local.resize(5);
+    local[0] = dotProdLocal(r_0, r);
+    local[1] = dotProdLocal(r_0, w);
+    local[2] = dotProdLocal(r_0, s);
+    local[3] = dotProdLocal(r_0, z);
+    local[4] = dotProdLocal(r, r);
+    StartReduction(local, global, &request);
+    
+    precond(w, what);
+    mat_vec(what, t);
+    
+    FinishReduction(&request);
+    
+    /*--- Check if solution has converged, else output the relative residual if necessary ---*/
+    
+    norm_r = sqrt(global[4]);
+    if (norm_r != norm_r) {
+      SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
+    }
+    if (norm_r < tol*norm0) break;
+    if (((monitoring) && (rank == MASTER_NODE)) && ((i+1) % 10 == 0)) WriteHistory(i+1, norm_r, norm0);
+    
+    /*--- Step lengths of the next iteration ---*/
+    
+    beta = (alpha / omega) * (global[0] / rho);
+    rho = global[0];
+    alpha = rho / (global[1] + beta*global[2] - beta*omega*global[3]);
+    
+  }
+  
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# Pipelined BCGSTAB final (true) residual:" << endl;
+    cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
+  }
+  
+  /*--- Recalculate final residual (this should be optional) ---*/
+  
+  if (monitoring) {
+    mat_vec(x, t);
+    r = b; r -= t;
+    su2double true_res = r.norm();
+    
+    if ((fabs(true_res - norm_r) > tol*10.0) && (rank == MASTER_NODE)) {
+      cout << "# WARNING in CSysSolve::PipelinedBCGSTAB_LinSolver(): " << endl;
+      cout << "# true residual norm and calculated residual norm do not agree." << endl;
+      cout << "# true_res = " << true_res <<", calc_res = " << norm_r <<", tol = " << tol*10 <<"."<< endl;
+      cout << "# true_res - calc_res = " << true_res - norm_r << endl;
+    }
+  }
+  
+  (*residual) = norm_r;
+  return (unsigned long) i;
+  
+}
+
+bool CSysSolve::RebuildPreconditioner(bool lagged, CConfig *config) {
+  
+  unsigned long MaxAge = config->GetLinear_Solver_Prec_Lag();
+  
+  /*--- The discrete adjoint overwrites the factorization with the one of the
+   transposed system, the preconditioner cannot be kept between solves. ---*/
+  
+  if (config->GetDiscrete_Adjoint()) lagged = false;
+  
+  Prec_Rebuilt = (!lagged || (MaxAge <= 1) || (Prec_Age == 0) || (Prec_Age >= MaxAge) || Prec_Degraded);
+  
+  if (Prec_Rebuilt) {
+    Prec_Age = 0;
+    Prec_Degraded = false;
+  }
+  Prec_Age++;
+  
+  return Prec_Rebuilt;
+  
+}
+
+void CSysSolve::UpdatePreconditionerAge(su2double norm_b, su2double residual, unsigned long iter, CConfig *config) {
+  
+  su2double IterPerDecade = 0.0;
+  
+  /*--- Nothing to measure without lagging or if the system was already solved ---*/
+  
+  if ((config->GetLinear_Solver_Prec_Lag() <= 1) || (norm_b == 0.0)) return;
+  
+  /*--- Linear iterations needed per decade of residual reduction, a solve
+   that did not reduce the residual always marks the preconditioner as stale. ---*/
+  
+  bool reduced = ((iter > 0) && (residual < norm_b));
+  if (reduced) IterPerDecade = su2double(iter)/log10(norm_b/max(residual, EPS*norm_b));
+  
+  /*--- The solve right after a rebuild sets the reference rate, the following
+   ones force a rebuild once the rate degrades past the threshold. ---*/
+  
+  if (Prec_Rebuilt) Prec_IterPerDecade = IterPerDecade;
+  else if (!reduced || (IterPerDecade > config->GetLinear_Solver_Prec_Lag_Degrade()*Prec_IterPerDecade))
+    Prec_Degraded = true;
+  
+}
+
 unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
   
   su2double SolverTol = config->GetLinear_Solver_Error(), Residual;
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
   unsigned long IterLinSol = 0;
   CMatrixVectorProduct *mat_vec;
+  bool lagged = false, rebuild = true;
+  su2double StartTime, norm_b = 0.0;
 
   bool TapeActive = NO;
 
@@ -610,48 +1235,85 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
 #endif
   }
 
+  /*--- The staleness of a lagged preconditioner is measured relative to the initial residual ---*/
+  
+  Prec_BuildTime = 0.0;
+  if (config->GetLinear_Solver_Prec_Lag() > 1) norm_b = LinSysRes.norm();
+  
   /*--- Solve the linear system using a Krylov subspace method ---*/
   
   if (config->GetKind_Linear_Solver() == BCGSTAB ||
       config->GetKind_Linear_Solver() == FGMRES ||
       config->GetKind_Linear_Solver() == RESTARTED_FGMRES ||
-      config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT) {
+      config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT ||
+      config->GetKind_Linear_Solver() == PIPELINED_FGMRES ||
+      config->GetKind_Linear_Solver() == PIPELINED_BCGSTAB) {
+    
+    SetKind_Orthogonalization(config->GetKind_Linear_Solver_Orthogonalization());
+    SetnRecycle(config->GetLinear_Solver_Recycle());
+    
+    /*--- With a matrix-free product the Jacobian only defines the preconditioner ---*/
     
-    mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
+    if (MatrixFree_Product != NULL) mat_vec = MatrixFree_Product;
+    else mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
     CPreconditioner* precond = NULL;
     
+    /*--- The JACOBI and ILU factorizations are stored apart from the Jacobian,
+     they can be reused (lagged) while they still precondition it well. ---*/
+    
+    lagged = ((config->GetKind_Linear_Solver_Prec() == JACOBI) ||
+              (config->GetKind_Linear_Solver_Prec() == ILU));
+    rebuild = RebuildPreconditioner(lagged, config);
+    StartTime = WallTime();
+    
     switch (config->GetKind_Linear_Solver_Prec()) {
       case JACOBI:
-        Jacobian.BuildJacobiPreconditioner();
+        if (rebuild) Jacobian.BuildJacobiPreconditioner();
         precond = new CJacobiPreconditioner(Jacobian, geometry, config);
         break;
       case ILU:
-        Jacobian.BuildILUPreconditioner();
+        if (rebuild) Jacobian.BuildILUPreconditioner();
         precond = new CILUPreconditioner(Jacobian, geometry, config);
         break;
       case LU_SGS:
+        Jacobian.BuildLU_SGSPreconditioner();
         precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
         break;
       case LINELET:
         Jacobian.BuildJacobiPreconditioner();
         precond = new CLineletPreconditioner(Jacobian, geometry, config);
         break;
+      case AMG:
+        Jacobian.BuildAMGPreconditioner();
+        precond = new CAMGPreconditioner(Jacobian, geometry, config);
+        break;
       default:
         Jacobian.BuildJacobiPreconditioner();
         precond = new CJacobiPreconditioner(Jacobian, geometry, config);
         break;
     }
     
+    Prec_BuildTime = (rebuild? WallTime() - StartTime : 0.0);
+    
     switch (config->GetKind_Linear_Solver()) {
       case BCGSTAB:
         IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
         break;
       case FGMRES:
-        IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        if (nRecycle > 0)
+          IterLinSol = FGCRO_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        else
+          IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
         break;
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
         break;
+      case PIPELINED_FGMRES:
+        IterLinSol = PipelinedFGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        break;
+      case PIPELINED_BCGSTAB:
+        IterLinSol = PipelinedBCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+        break;
       case RESTARTED_FGMRES:
         IterLinSol = 0;
         while (IterLinSol < config->GetLinear_Solver_Iter()) {
@@ -664,9 +1326,11 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
         break;
     }
     
+    if (lagged) UpdatePreconditionerAge(norm_b, Residual, IterLinSol, config);
+    
     /*--- Dealocate memory of the Krylov subspace method ---*/
     
-    delete mat_vec;
+    if (MatrixFree_Product == NULL) delete mat_vec;
     delete precond;
     
   }
@@ -674,21 +1338,29 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   /*--- Smooth the linear system. ---*/
   
   else {
+    lagged = ((config->GetKind_Linear_Solver() == SMOOTHER_JACOBI) ||
+              (config->GetKind_Linear_Solver() == SMOOTHER_ILU));
+    rebuild = RebuildPreconditioner(lagged, config);
     switch (config->GetKind_Linear_Solver()) {
       case SMOOTHER_LUSGS:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
+        Jacobian.BuildLU_SGSPreconditioner();
         IterLinSol = Jacobian.LU_SGS_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
       case SMOOTHER_JACOBI:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-        Jacobian.BuildJacobiPreconditioner();
+        StartTime = WallTime();
+        if (rebuild) Jacobian.BuildJacobiPreconditioner();
+        Prec_BuildTime = (rebuild? WallTime() - StartTime : 0.0);
         IterLinSol = Jacobian.Jacobi_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
       case SMOOTHER_ILU:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-        Jacobian.BuildILUPreconditioner();
+        StartTime = WallTime();
+        if (rebuild) Jacobian.BuildILUPreconditioner();
+        Prec_BuildTime = (rebuild? WallTime() - StartTime : 0.0);
         IterLinSol = Jacobian.ILU_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
@@ -698,6 +1370,7 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
         IterLinSol = 1;
         break;
     }
+    if (lagged) UpdatePreconditionerAge(norm_b, Residual, IterLinSol, config);
   }
 
 
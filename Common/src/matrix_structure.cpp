@@ -48,8 +48,20 @@ CSysMatrix::CSysMatrix(void) {
 
   matrix            = NULL;
   ILU_matrix        = NULL;
+  ILU_matrix_float  = NULL;
+  ilu_single        = false;
+  level_scheduling  = false;
+  LowerSchedule     = NULL;
+  UpperSchedule     = NULL;
+  LowerSchedule_ilu = NULL;
+  UpperSchedule_ilu = NULL;
+  sweep_work        = NULL;
   row_ptr           = NULL;
   col_ind           = NULL;
+  dia_ptr           = NULL;
+  dia_ptr_ilu       = NULL;
+  edge_ptr          = NULL;
+  nEdge             = 0;
   row_ptr_ilu       = NULL;
   col_ind_ilu       = NULL;
   block             = NULL;
@@ -76,6 +88,15 @@ CSysMatrix::CSysMatrix(void) {
   FzVector        = NULL;
   max_nElem       = 0;
   
+  /*--- AMG preconditioner ---*/
+  
+  nAMGLevel       = 0;
+  AMGLevel        = NULL;
+  
+  /*--- Generic block kernels until the block size is known ---*/
+  
+  SetBlockKernels_Size<0>();
+  
 }
 
 CSysMatrix::~CSysMatrix(void) {
@@ -86,14 +107,24 @@ CSysMatrix::~CSysMatrix(void) {
   
   if (matrix != NULL)             delete [] matrix;
   if (ILU_matrix != NULL)         delete [] ILU_matrix;
+  if (ILU_matrix_float != NULL)   delete [] ILU_matrix_float;
   if (row_ptr != NULL)            delete [] row_ptr;
   if (col_ind != NULL)            delete [] col_ind;
+  if (dia_ptr != NULL)            delete [] dia_ptr;
+  if (edge_ptr != NULL)           delete [] edge_ptr;
 
   if (ilu_fill_in != 0) {
     if (row_ptr_ilu != NULL) delete [] row_ptr_ilu;
     if (col_ind_ilu != NULL) delete [] col_ind_ilu;
+    if (dia_ptr_ilu != NULL) delete [] dia_ptr_ilu;
   }
   
+  if (LowerSchedule != NULL)      delete LowerSchedule;
+  if (UpperSchedule != NULL)      delete UpperSchedule;
+  if (LowerSchedule_ilu != NULL)  delete LowerSchedule_ilu;
+  if (UpperSchedule_ilu != NULL)  delete UpperSchedule_ilu;
+  if (sweep_work != NULL)         delete [] sweep_work;
+  
   if (block != NULL)              delete [] block;
   if (block_weight != NULL)       delete [] block_weight;
   if (block_inverse != NULL)      delete [] block_inverse;
@@ -125,6 +156,8 @@ CSysMatrix::~CSysMatrix(void) {
   if (LyVector != NULL)   delete [] LyVector;
   if (FzVector != NULL)   delete [] FzVector;
   
+  DeleteAMGHierarchy();
+  
 }
 
 void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
@@ -134,7 +167,7 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   /*--- Don't delete *row_ptr, *col_ind because they are
    asigned to the Jacobian structure. ---*/
 
-  unsigned long iPoint, *row_ptr, *col_ind, index, nnz, Elem, iVar;
+  unsigned long iPoint, *row_ptr, *col_ind, index, nnz, Elem;
   unsigned short iNeigh, iElem, iNode, *nNeigh, *nNeigh_ilu;
   vector<unsigned long>::iterator it;
   vector<unsigned long> vneighs, vneighs_ilu;
@@ -143,6 +176,24 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
    
   ilu_fill_in = config->GetLinear_Solver_ILU_n();
   
+  /*--- Precision of the storage of the ILU factors ---*/
+  
+  ilu_single = config->GetLinear_Solver_Prec_Single();
+  
+  /*--- Level scheduled or sequential (natural order) preconditioner sweeps ---*/
+  
+  level_scheduling = config->GetLinear_Solver_Level_Scheduling();
+  
+  /*--- The levels depend on the sparse pattern, discard those of a
+   previous pattern, they are rebuilt with the preconditioner. ---*/
+  
+  if (LowerSchedule != NULL)      delete LowerSchedule;
+  if (UpperSchedule != NULL)      delete UpperSchedule;
+  if (LowerSchedule_ilu != NULL)  delete LowerSchedule_ilu;
+  if (UpperSchedule_ilu != NULL)  delete UpperSchedule_ilu;
+  LowerSchedule = NULL; UpperSchedule = NULL;
+  LowerSchedule_ilu = NULL; UpperSchedule_ilu = NULL;
+  
   /*--- Compute the number of neighbors ---*/
   
   nNeigh = new unsigned short [nPoint];
@@ -213,6 +264,11 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   
   SetIndexes(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind, nnz, config);
   
+  /*--- Precompute the position of the diagonal blocks and of the blocks
+   coupled by each edge, so that assembly does not search the rows. ---*/
+  
+  SetBlockMaps(geometry, EdgeConnect);
+  
   /*--- Initialization matrix to zero ---*/
   
   SetValZero();
@@ -260,13 +316,27 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
       
     }
     
-    ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
-    for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+    SetILUMatrix();
     
     delete [] nNeigh_ilu;
     
   }
   
+  /*--- Position of the diagonal blocks in the ILU structure, where the
+   factorization stores the inverted diagonal of each row. ---*/
+  
+  if (ilu_fill_in == 0) {
+    dia_ptr_ilu = dia_ptr;
+  }
+  else {
+    dia_ptr_ilu = new unsigned long [nPoint];
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+        if (col_ind_ilu[index] == iPoint) { dia_ptr_ilu[iPoint] = index; break; }
+      }
+    }
+  }
+  
 }
 
 void CSysMatrix::SetNeighbours(CGeometry *geometry, unsigned long iPoint, unsigned short deep_level, unsigned short fill_level,
@@ -337,30 +407,41 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   for (iVar = 0; iVar < nVar; iVar++)          aux_vector[iVar] = 0.0;
   for (iVar = 0; iVar < nVar; iVar++)          sum_vector[iVar] = 0.0;
   
+  /*--- Select the block kernels for this block size ---*/
+  
+  SetBlockKernels();
+  
   if (ilu_fill_in == 0) {
 
-    /*--- Set specific preconditioner matrices (ILU) ---*/
+    /*--- Set specific preconditioner matrices (ILU), SU2_DOT also uses ILU
+     for the transposed system when LU_SGS or AMG are requested ---*/
     
     if ((config->GetKind_Linear_Solver_Prec() == ILU) ||
         ((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == ILU)) ||
-        ((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == ILU)) ||
+        ((config->GetKind_SU2() == SU2_DOT) && ((config->GetKind_Deform_Linear_Solver_Prec() == ILU) ||
+                                                (config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS) ||
+                                                (config->GetKind_Deform_Linear_Solver_Prec() == AMG))) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_ILU) ||
         (config->GetFSI_Simulation() && config->GetKind_Deform_Linear_Solver_Prec() == ILU) ||
         (config->GetDiscrete_Adjoint() && config->GetKind_DiscAdj_Linear_Prec() == ILU)) {
       
       /*--- Reserve memory for the ILU matrix. ---*/
       
-      ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
-      for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+      SetILUMatrix();
       
     }
     
   }
   
-  /*--- Set specific preconditioner matrices (Jacobi and Linelet) ---*/
+  /*--- Set specific preconditioner matrices (Jacobi, LU_SGS and Linelet) ---*/
   
   if ((config->GetKind_Linear_Solver_Prec() == JACOBI) ||
+      (config->GetKind_Linear_Solver_Prec() == LU_SGS) ||
       (config->GetKind_Linear_Solver_Prec() == LINELET) ||
+      ((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS)) ||
+      ((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS)) ||
+      (config->GetKind_Linear_Solver() == SMOOTHER_LUSGS) ||
+      (config->GetFSI_Simulation() && config->GetKind_Deform_Linear_Solver_Prec() == LU_SGS) ||
    		((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI)) ||
     	((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI)) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_JACOBI) ||
@@ -377,153 +458,221 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
 
 }
 
-su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
+void CSysMatrix::SetBlockMaps(CGeometry *geometry, bool EdgeConnect) {
   
-  unsigned long step = 0, index;
+  unsigned long iPoint, jPoint, iEdge;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) { return &(matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
+  /*--- Release the maps of a previous pattern (e.g. after the mesh was
+   repartitioned). dia_ptr is reset first, GetBlockIndex would use it. ---*/
+  
+  if (dia_ptr != NULL)  delete [] dia_ptr;
+  if (edge_ptr != NULL) delete [] edge_ptr;
+  dia_ptr = NULL; edge_ptr = NULL;
+  
+  /*--- Position of the diagonal block of each row, every row has one. ---*/
+  
+  unsigned long *diagonal = new unsigned long [nPoint];
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    diagonal[iPoint] = GetBlockIndex(iPoint, iPoint);
+    if (diagonal[iPoint] == nnz)
+      SU2_MPI::Error("Diagonal block missing from the sparse pattern.", CURRENT_FUNCTION);
+  }
+  dia_ptr = diagonal;
+  
+  /*--- Position of the ij and ji blocks of each edge, only meaningful
+   when the sparse pattern was built from the edge connectivity. ---*/
+  
+  nEdge = 0;
+  if (EdgeConnect && (geometry->edge != NULL)) {
+    
+    nEdge = geometry->GetnEdge();
+    edge_ptr = new unsigned long [2*nEdge];
+    
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      edge_ptr[2*iEdge]   = GetBlockIndex(iPoint, jPoint);
+      edge_ptr[2*iEdge+1] = GetBlockIndex(jPoint, iPoint);
+      if ((edge_ptr[2*iEdge] == nnz) || (edge_ptr[2*iEdge+1] == nnz))
+        SU2_MPI::Error("Edge block missing from the sparse pattern.", CURRENT_FUNCTION);
+    }
+    
   }
-  return NULL;
   
 }
 
-su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, unsigned short iVar, unsigned short jVar) {
+unsigned long CSysMatrix::GetBlockIndex_ILUMatrix(unsigned long block_i, unsigned long block_j) const {
   
-  unsigned long step = 0, index;
+  unsigned long index;
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) { return matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar]; }
+  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++)
+    if (col_ind_ilu[index] == block_j) return index;
+  
+  return nnz_ilu;
+  
+}
+
+void CSysMatrix::SetILUMatrix(void) {
+  
+  unsigned long iVar;
+  
+  if (ilu_single) {
+    ILU_matrix_float = new su2mixedfloat [nnz_ilu*nVar*nEqn];
+    for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix_float[iVar] = 0.0;
+  }
+  else {
+    ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
+    for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
   }
-  return 0;
+  
+}
+
+unsigned long CSysMatrix::GetBlockIndex(unsigned long block_i, unsigned long block_j) const {
+  
+  unsigned long index;
+  
+  if ((block_i == block_j) && (dia_ptr != NULL)) return dia_ptr[block_i];
+  
+  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++)
+    if (col_ind[index] == block_j) return index;
+  
+  return nnz;
+  
+}
+
+su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
+  
+  unsigned long index = GetBlockIndex(block_i, block_j);
+  
+  if (index == nnz) return NULL;
+  return &(matrix[index*nVar*nEqn]);
+  
+}
+
+su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, unsigned short iVar, unsigned short jVar) {
+  
+  unsigned long index = GetBlockIndex(block_i, block_j);
+  
+  if (index == nnz) return 0;
+  return matrix[index*nVar*nEqn+iVar*nEqn+jVar];
   
 }
 
 void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long iVar, jVar, index = GetBlockIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
   
 }
   
 void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double *val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long iVar, jVar, index = GetBlockIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
   
 }
 
 void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long iVar, jVar, index = GetBlockIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] += val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
   
 }
 
 void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long iVar, jVar, index = GetBlockIndex(block_i, block_j);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-//         matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+//      matrix[index*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar][jVar];  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+      matrix[index*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
   
 }
 
-su2double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
+void CSysMatrix::AddBlock2Diag(unsigned long block_i, su2double **val_block) {
   
-  unsigned long step = 0, index;
+  unsigned long iVar, jVar;
+  su2double *Block = &(matrix[dia_ptr[block_i]*nVar*nEqn]);
   
-  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    step++;
-    if (col_ind_ilu[index] == block_j) { return &(ILU_matrix[(row_ptr_ilu[block_i]+step-1)*nVar*nEqn]); }
-  }
-  return NULL;
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+      Block[iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
   
 }
 
-void CSysMatrix::SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+void CSysMatrix::SubtractBlock2Diag(unsigned long block_i, su2double **val_block) {
   
-  unsigned long iVar, jVar, index, step = 0;
+  unsigned long iVar, jVar;
+  su2double *Block = &(matrix[dia_ptr[block_i]*nVar*nEqn]);
   
-  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    step++;
-    if (col_ind_ilu[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr_ilu[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[iVar*nVar+jVar];
-      break;
-    }
-  }
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nEqn; jVar++)
+      Block[iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
   
 }
 
-void CSysMatrix::SetBlockTransposed_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
-
-  unsigned long iVar, jVar, index, step = 0;
-
-  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    step++;
-    if (col_ind_ilu[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr_ilu[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] = val_block[jVar*nVar+iVar];
-      break;
+void CSysMatrix::UpdateBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j) {
+  
+  unsigned long iVar, jVar;
+  su2double val_i, val_j;
+  
+  su2double *Block_ii = &(matrix[dia_ptr[iPoint]*nVar*nEqn]);
+  su2double *Block_ij = &(matrix[edge_ptr[2*iEdge]*nVar*nEqn]);
+  su2double *Block_ji = &(matrix[edge_ptr[2*iEdge+1]*nVar*nEqn]);
+  su2double *Block_jj = &(matrix[dia_ptr[jPoint]*nVar*nEqn]);
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      val_i = SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      val_j = SU2_TYPE::GetValue(block_j[iVar][jVar]);
+      Block_ii[iVar*nEqn+jVar] += val_i;
+      Block_ij[iVar*nEqn+jVar] += val_j;
+      Block_ji[iVar*nEqn+jVar] -= val_i;
+      Block_jj[iVar*nEqn+jVar] -= val_j;
     }
   }
-
+  
 }
 
-void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, su2double *val_block) {
+void CSysMatrix::UpdateBlocksSub(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j) {
+  
+  unsigned long iVar, jVar;
+  su2double val_i, val_j;
   
-  unsigned long iVar, jVar, index, step = 0;
+  su2double *Block_ii = &(matrix[dia_ptr[iPoint]*nVar*nEqn]);
+  su2double *Block_ij = &(matrix[edge_ptr[2*iEdge]*nVar*nEqn]);
+  su2double *Block_ji = &(matrix[edge_ptr[2*iEdge+1]*nVar*nEqn]);
+  su2double *Block_jj = &(matrix[dia_ptr[jPoint]*nVar*nEqn]);
   
-  for (index = row_ptr_ilu[block_i]; index < row_ptr_ilu[block_i+1]; index++) {
-    step++;
-    if (col_ind_ilu[index] == block_j) {
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nEqn; jVar++)
-          ILU_matrix[(row_ptr_ilu[block_i]+step-1)*nVar*nEqn+iVar*nEqn+jVar] -= val_block[iVar*nVar+jVar];
-      break;
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      val_i = SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      val_j = SU2_TYPE::GetValue(block_j[iVar][jVar]);
+      Block_ii[iVar*nEqn+jVar] -= val_i;
+      Block_ij[iVar*nEqn+jVar] -= val_j;
+      Block_ji[iVar*nEqn+jVar] += val_i;
+      Block_jj[iVar*nEqn+jVar] += val_j;
     }
   }
   
@@ -531,67 +680,41 @@ void CSysMatrix::SubtractBlock_ILUMatrix(unsigned long block_i, unsigned long bl
 
 void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2double *product) {
   
-  unsigned short iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    product[iVar] = 0.0;
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
-    }
-  }
+  (*MatVecKernel)(nVar, matrix, vector, product);
   
 }
 
 void CSysMatrix::MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, su2double *product) {
   
-  unsigned short iVar, jVar, kVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++) {
-        product[iVar*nVar+jVar] += matrix_a[iVar*nVar+kVar]*matrix_b[kVar*nVar+jVar];
-      }
-    }
-  }
+  (*MatMatKernel)(nVar, matrix_a, matrix_b, product);
   
 }
 
 void CSysMatrix::AddVal2Diag(unsigned long block_i, su2double val_matrix) {
   
-  unsigned long step = 0, iVar, index;
+  unsigned long iVar, index = GetBlockIndex(block_i, block_i);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_i) {	// Only elements on the diagonal
-      for (iVar = 0; iVar < nVar; iVar++)
-//        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+//    matrix[index*nVar*nVar+iVar*nVar+iVar] += val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+    matrix[index*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
   
 }
 
 void CSysMatrix::SetVal2Diag(unsigned long block_i, su2double val_matrix) {
   
-  unsigned long step = 0, iVar, jVar, index;
+  unsigned long iVar, jVar, index = GetBlockIndex(block_i, block_i);
   
-  for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
-    step++;
-    if (col_ind[index] == block_i) {	// Only elements on the diagonal
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (jVar = 0; jVar < nVar; jVar++)
-          matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+jVar] = 0.0;
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-//        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
-        matrix[(row_ptr[block_i]+step-1)*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix);
-      
-      break;
-    }
-  }
+  if (index == nnz) return;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
+      matrix[index*nVar*nVar+iVar*nVar+jVar] = 0.0;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+//    matrix[index*nVar*nVar+iVar*nVar+iVar] = val_matrix;  // Allow AD in Matrix Structure (disabled temporarily to avoid conflicts)
+    matrix[index*nVar*nVar+iVar*nVar+iVar] = SU2_TYPE::GetValue(val_matrix);
   
 }
 
@@ -708,8 +831,7 @@ void CSysMatrix::MatrixTranspose(su2double **a, unsigned long n) {
 
 void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool transposed) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  unsigned long iVar, jVar;
   
   su2double *Block = GetBlock(block_i, block_i);
   
@@ -717,129 +839,34 @@ void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool t
    is modified by the algorithm---*/
   
   if (!transposed) {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
         block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
   } else {
-    for (iVar = 0; iVar < (short)nVar; iVar++)
-      for (jVar = 0; jVar < (short)nVar; jVar++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
         block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
   }
   /*--- Gauss elimination ---*/
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
-  
-}
-
-void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs) {
-  
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
-  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
-  
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm---*/
-  
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
-      block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
-  
-  /*--- Gauss elimination ---*/
-
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  (*GaussKernel)(nVar, block, rhs);
   
 }
 
 void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  unsigned long iVar, jVar;
   
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm---*/
   
-  for (iVar = 0; iVar < (short)nVar; iVar++)
-    for (jVar = 0; jVar < (short)nVar; jVar++)
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
       block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
   
+  /*--- Gauss elimination ---*/
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  (*GaussKernel)(nVar, block, rhs);
   
 }
 
@@ -1114,8 +1141,6 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod)
 
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
-  
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
     cerr << "CSysMatrix::MatrixVectorProduct(const CSysVector&, CSysVector): "
@@ -1129,18 +1154,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
   }
   
   prod = su2double(0.0); // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(unsigned long)(prod_begin+iVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+jVar)];
-        }
-      }
-    }
-  }
+  (this->*SpMVKernel)(vec, prod);
   
   /*--- MPI Parallelization ---*/
   SendReceive_Solution(prod, geometry, config);
@@ -1180,26 +1194,13 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
 
 void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar, kVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) {
-      c[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++)
-        c[iVar*nVar+jVar] += a[iVar*nVar+kVar] * b[kVar*nVar+jVar];
-    }
+  (*MatMatKernel)(nVar, a, b, c);
   
 }
 
 void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
   
-  unsigned long iVar, jVar;
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    c[iVar] =  0.0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
-  }
+  (*MatVecKernel)(nVar, a, b, c);
   
 }
 
@@ -1291,59 +1292,14 @@ void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock
 }
 
 
-void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double *invBlock) {
-  
-  unsigned long iVar, jVar;
+void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    
-    Gauss_Elimination_ILUMatrix(block_i, aux_vector);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
-  
-  //  su2double Det, **Matrix, **CoFactor;
-  //  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
-  //
-  //  Matrix = new su2double*[nVar];
-  //  CoFactor = new su2double*[nVar];
-  //  for (iVar=0;iVar<nVar;iVar++) {
-  //    Matrix[iVar] = new su2double[nVar];
-  //    CoFactor[iVar] = new su2double[nVar];
-  //  }
-  //
-  //  for (iVar = 0; iVar < nVar; iVar++) {
-  //    for (jVar = 0; jVar < nVar; jVar++)
-  //    Matrix[iVar][jVar] = Block[jVar*nVar+iVar];
-  //  }
-  //
-  //  Det =  MatrixDeterminant(Matrix, nVar);
-  //  MatrixCoFactor(Matrix, nVar, CoFactor);
-  //  MatrixTranspose(CoFactor, nVar);
-  //
-  //
-  //  for (iVar = 0; iVar < nVar; iVar++) {
-  //    for (jVar = 0; jVar < nVar; jVar++)
-  //    invBlock[jVar*nVar+iVar] = CoFactor[iVar][jVar]/Det;
-  //  }
-  //
-  //  for (iVar = 0; iVar < nVar; iVar++) {
-  //    delete [] Matrix[iVar];
-  //    delete [] CoFactor[iVar];
-  //  }
-  //  delete [] Matrix;
-  //  delete [] CoFactor;
-  
-}
+  unsigned long iPoint, iVar, jVar;
 
-void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
+  /*--- The inverse may be requested by a preconditioner that was not
+   known when the sparse structure was allocated (e.g. LU_SGS) ---*/
 
-  unsigned long iPoint, iVar, jVar;
+  if (invM == NULL) invM = new su2double [nPoint*nVar*nEqn];
 
   /*--- Compute Jacobi Preconditioner ---*/
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -1362,16 +1318,7 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
 
 void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, iVar, jVar;
-  
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++)
-        prod[(unsigned long)(iPoint*nVar+iVar)] +=
-        invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
-    }
-  }
+  (this->*JacobiKernel)(vec, prod);
   
   /*--- MPI Parallelization ---*/
   
@@ -1407,6 +1354,7 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
   su2double norm0  = b.norm();
   if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
     if (rank == MASTER_NODE) cout << "CSysMatrix::Jacobi_Smoother(): system solved by initial guess." << endl;
+    (*residual) = norm_r;
     return 0;
   }
   
@@ -1465,150 +1413,111 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
     cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
   }
   
+  (*residual) = norm_r;
+  
   return (unsigned long) i;
   
 }
 
-void CSysMatrix::BuildILUPreconditioner(bool transposed) {
+CLevelSchedule::CLevelSchedule(unsigned long nRow, const unsigned long *row_ptr, const unsigned long *col_ind, bool upper) {
   
-  unsigned long index, index_, iVar;
-  su2double *Block_ij, *Block_jk;
-  long iPoint, jPoint, kPoint;
+  unsigned long iLoop, iRow, jRow, index, iLevel, *level, *count;
+  
+  /*--- Level of each row, one more than the highest level of the rows it
+   depends on (lower columns for the forward sweep, upper ones for the
+   backward sweep). ---*/
+  
+  level = new unsigned long [nRow];
+  nLevel = 0;
+  
+  for (iLoop = 0; iLoop < nRow; iLoop++) {
+    iRow = upper? nRow-1-iLoop : iLoop;
+    level[iRow] = 0;
+    for (index = row_ptr[iRow]; index < row_ptr[iRow+1]; index++) {
+      jRow = col_ind[index];
+      if (jRow >= nRow) continue;
+      if ((upper && (jRow > iRow)) || (!upper && (jRow < iRow)))
+        level[iRow] = max(level[iRow], level[jRow]+1);
+    }
+    nLevel = max(nLevel, level[iRow]+1);
+  }
+  
+  /*--- Group the rows by level (counting sort, stable) ---*/
+  
+  level_ptr = new unsigned long [nLevel+1];
+  point     = new unsigned long [nRow];
+  count     = new unsigned long [nLevel];
+  
+  for (iLevel = 0; iLevel <= nLevel; iLevel++) level_ptr[iLevel] = 0;
+  for (iRow = 0; iRow < nRow; iRow++) level_ptr[level[iRow]+1]++;
+  for (iLevel = 0; iLevel < nLevel; iLevel++) {
+    level_ptr[iLevel+1] += level_ptr[iLevel];
+    count[iLevel] = level_ptr[iLevel];
+  }
+  for (iRow = 0; iRow < nRow; iRow++) {
+    point[count[level[iRow]]] = iRow;
+    count[level[iRow]]++;
+  }
   
+  delete [] level;
+  delete [] count;
+  
+}
 
-  /*--- Copy block matrix, note that the original matrix
-   is modified by the algorithm, so that we have the factorization stored
-   in the ILUMatrix at the end of this preprocessing. ---*/
+CLevelSchedule::~CLevelSchedule(void) {
+  
+  if (level_ptr != NULL) delete [] level_ptr;
+  if (point != NULL)     delete [] point;
+  
+}
 
-  for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
+void CSysMatrix::SetSweepWork(void) {
+  
+  /*--- One pair of nVar arrays per thread, allocated with the schedules
+   so that the sweeps do not allocate memory. ---*/
+  
+  if (sweep_work != NULL) delete [] sweep_work;
+  sweep_work = new su2double [omp_get_max_threads()*2*nVar];
+  
+}
 
-  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
-    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
-      jPoint = col_ind[index];
-      if (transposed) {
-        Block_ij = GetBlock(jPoint, iPoint);
-        SetBlockTransposed_ILUMatrix(iPoint, jPoint, Block_ij);
-      } else {
-        Block_ij = GetBlock(iPoint, jPoint);
-        SetBlock_ILUMatrix(iPoint, jPoint, Block_ij);
-      }
-    }
-  }
+void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   
-  /*--- Transform system in Upper Matrix ---*/
+  /*--- The levels of the sweeps only depend on the sparse structure, they
+   are computed the first time the preconditioner is built. ---*/
   
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-    
-    /*--- For each row (unknown), loop over all entries in A on this row
-     row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
-     row. ---*/
-    
-    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-      
-      /*--- jPoint here is the column for each entry on this row ---*/
-      
-      jPoint = col_ind_ilu[index];
-      
-      /*--- Check that this column is in the lower triangular portion ---*/
-      
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-        
-        /*--- If we're in the lower triangle, get the pointer to this block,
-         invert it, and then right multiply against the original block ---*/
-        
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        InverseDiagonalBlock_ILUMatrix(jPoint, block_inverse);
-        MatrixMatrixProduct(Block_ij, block_inverse, block_weight);
-        
-        /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
-        
-        for (index_ = row_ptr_ilu[jPoint]; index_ < row_ptr_ilu[jPoint+1]; index_++) {
-          
-          /*--- Get the column of the entry ---*/
-          
-          kPoint = col_ind_ilu[index_];
-          
-          /*--- If the column is greater than or equal to jPoint, i.e., the
-           upper triangular part, then multiply and modify the matrix.
-           Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
-          
-          if ((kPoint >= jPoint) && (jPoint < (long)nPointDomain)) {
-            
-            Block_jk = GetBlock_ILUMatrix(jPoint, kPoint);
-            MatrixMatrixProduct(block_weight, Block_jk, block);
-            SubtractBlock_ILUMatrix(iPoint, kPoint, block);
-            
-          }
-        }
-        
-        /*--- Lastly, store block_weight in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
-        
-        SetBlock_ILUMatrix(iPoint, jPoint, block_weight);
-        
-      }
-    }
+  if (level_scheduling && (LowerSchedule_ilu == NULL)) {
+    LowerSchedule_ilu = new CLevelSchedule(nPointDomain, row_ptr_ilu, col_ind_ilu, false);
+    UpperSchedule_ilu = new CLevelSchedule(nPointDomain, row_ptr_ilu, col_ind_ilu, true);
+    SetSweepWork();
   }
   
+  /*--- The factorization is computed directly in the storage used by the
+   forward/backward sweeps, single precision halves the memory traffic of
+   the preconditioner (the arithmetic is still done in su2double). ---*/
+  
+  if (ilu_single) BuildILU_Factorization(ILU_matrix_float, transposed);
+  else BuildILU_Factorization(ILU_matrix, transposed);
+  
 }
 
 void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  unsigned long iPoint, iVar;
   
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm---*/
   
-  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     for (iVar = 0; iVar < nVar; iVar++) {
       prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
     }
   }
   
-  /*--- Forward solve the system using the lower matrix entries that
-   were computed and stored during the ILU preprocessing. Note
-   that we are overwriting the residual vector as we go. ---*/
-  
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-      jPoint = col_ind_ilu[index];
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-        for (iVar = 0; iVar < nVar; iVar++)
-          prod[iPoint*nVar+iVar] -= aux_vector[iVar];
-        
-      }
-    }
-  }
-  
-  /*--- Backwards substitution (starts at the last row) ---*/
-  
-  InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-  MatrixVectorProduct(block_inverse, &prod[(nPointDomain-1)*nVar], aux_vector);
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    prod[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
+  /*--- Forward and backward substitution with the factors computed
+   and stored during the ILU preprocessing ---*/
   
-  for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-      jPoint = col_ind_ilu[index];
-      if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-        for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-      }
-    }
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = (prod[iPoint*nVar+iVar]-sum_vector[iVar]);
-    InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-    MatrixVectorProduct(block_inverse, &prod[iPoint*nVar], aux_vector);
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector[iVar];
-    if (iPoint == 0) break;
-  }
+  (this->*ILUSweepKernel)(prod);
   
   /*--- MPI Parallelization ---*/
   
@@ -1618,10 +1527,7 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
 
 unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij, omega = 1.0;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  su2double omega = 1.0;
   
   /*---  Check the number of iterations requested ---*/
   
@@ -1647,6 +1553,7 @@ unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMa
   su2double norm0  = b.norm();
   if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
     if (rank == MASTER_NODE) cout << "CSysMatrix::ILU_Smoother(): system solved by initial guess." << endl;
+    (*residual) = norm_r;
     return 0;
   }
   
@@ -1668,62 +1575,10 @@ unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMa
   
   for (i = 0; i < (int)m; i++) {
     
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
-    
-    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-      
-      /*--- For each row (unknown), loop over all entries in A on this row
-       row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
-       row. ---*/
-      
-      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-        
-        /*--- jPoint here is the column for each entry on this row ---*/
-        
-        jPoint = col_ind_ilu[index];
-        
-        /*--- Check that this column is in the lower triangular portion ---*/
-        
-        if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-          
-          /*--- Lastly, get Aij*inv(Ajj) from the lower triangular part, which
-           was calculated in the preprocessing, and apply to r. ---*/
-          
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++)
-            r[iPoint*nVar+iVar] -= aux_vector[iVar];
-          
-        }
-      }
-    }
-    
-    /*--- Backwards substitution (starts at the last row) ---*/
-    
-    InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-    MatrixVectorProduct(block_inverse, &r[(nPointDomain-1)*nVar], aux_vector);
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      r[(nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
+    /*--- Apply the ILU factorization computed in the preprocessing to r,
+     overwriting the residual vector with M^-1*r^k. ---*/
     
-    for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-        jPoint = col_ind_ilu[index];
-        if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-        }
-      }
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = (r[iPoint*nVar+iVar]-sum_vector[iVar]);
-      InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-      MatrixVectorProduct(block_inverse, &r[iPoint*nVar], aux_vector);
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = aux_vector[iVar];
-      if (iPoint == 0) break;
-    }
+    ComputeILUPreconditioner(r, r, geometry, config);
     
     /*--- Update solution (x^k+1 = x^k + w*M^-1*r^k) using the residual vector,
      which holds the update after applying the ILU smoother, i.e., M^-1*r^k.
@@ -1756,41 +1611,41 @@ unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMa
     cout << "# Iteration = " << i << ": |res|/|res0| = "  << norm_r/norm0 << ".\n" << endl;
   }
   
+  (*residual) = norm_r;
+  
   return (unsigned int) i;
   
 }
 
+void CSysMatrix::BuildLU_SGSPreconditioner(void) {
+  
+  /*--- Both sweeps of LU_SGS only need the inverse of the diagonal blocks,
+   which are computed once here and stored in the invM structure. ---*/
+  
+  BuildJacobiPreconditioner();
+  
+  if (level_scheduling && (LowerSchedule == NULL)) {
+    LowerSchedule = new CLevelSchedule(nPointDomain, row_ptr, col_ind, false);
+    UpperSchedule = new CLevelSchedule(nPointDomain, row_ptr, col_ind, true);
+    SetSweepWork();
+  }
+  
+}
+
 void CSysMatrix::ComputeLU_SGSPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, iVar;
   
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    LowerProduct(prod, iPoint);                                        // Compute L.x*
-    for (iVar = 0; iVar < nVar; iVar++)
-      aux_vector[iVar] = vec[iPoint*nVar+iVar] - prod_row_vector[iVar]; // Compute aux_vector = b - L.x*
-    Gauss_Elimination(iPoint, aux_vector);                            // Solve D.x* = aux_vector
-    for (iVar = 0; iVar < nVar; iVar++)
-      prod[iPoint*nVar+iVar] = aux_vector[iVar];                       // Assesing x* = solution
-  }
+  (this->*LU_SGSForwardKernel)(vec, prod);
   
   /*--- MPI Parallelization ---*/
   
   SendReceive_Solution(prod, geometry, config);
   
-  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
+  /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x*,
+   i.e. x_(1) = x* - inv(D).U.x_(1) ---*/
   
-  for (iPoint = nPointDomain-1; (int)iPoint >= 0; iPoint--) {
-    DiagonalProduct(prod, iPoint);                 // Compute D.x*
-    for (iVar = 0; iVar < nVar; iVar++)
-      aux_vector[iVar] = prod_row_vector[iVar];   // Compute aux_vector = D.x*
-    UpperProduct(prod, iPoint);                    // Compute U.x_(n+1)
-    for (iVar = 0; iVar < nVar; iVar++)
-      aux_vector[iVar] -= prod_row_vector[iVar];  // Compute aux_vector = D.x*-U.x_(n+1)
-    Gauss_Elimination(iPoint, aux_vector);        // Solve D.x* = aux_vector
-    for (iVar = 0; iVar < nVar; iVar++)
-      prod[iPoint*nVar + iVar] = aux_vector[iVar]; // Assesing x_(1) = solution
-  }
+  (this->*LU_SGSBackwardKernel)(prod);
   
   /*--- MPI Parallelization ---*/
   
@@ -1800,7 +1655,6 @@ void CSysMatrix::ComputeLU_SGSPreconditioner(const CSysVector & vec, CSysVector
 
 unsigned long CSysMatrix::LU_SGS_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, iVar;
   su2double omega = 1.0;
   
   /*---  Check the number of iterations requested ---*/
@@ -1849,34 +1703,10 @@ unsigned long CSysMatrix::LU_SGS_Smoother(const CSysVector & b, CSysVector & x,
   
   for (i = 0; i < (int)m; i++) {
 
-    /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
-    
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      LowerProduct(xStar, iPoint);                                      // Compute L.x*
-      for (iVar = 0; iVar < nVar; iVar++)
-        aux_vector[iVar] = r[iPoint*nVar+iVar] - prod_row_vector[iVar]; // Compute aux_vector = b - L.x*
-      Gauss_Elimination(iPoint, aux_vector);                            // Solve D.x* = aux_vector
-      for (iVar = 0; iVar < nVar; iVar++)
-        xStar[iPoint*nVar+iVar] = aux_vector[iVar];                     // Assesing x* = solution, stored in r
-    }
+    /*--- Apply both sweeps of the symmetric iteration to the residual,
+     using the inverted diagonal blocks built in the preprocessing. ---*/
     
-    /*--- MPI Parallelization ---*/
-    
-    SendReceive_Solution(xStar, geometry, config);
-    
-    /*--- Second part of the symmetric iteration: (D+U).x_(1) = D.x* ---*/
-    
-    for (iPoint = nPointDomain-1; (int)iPoint >= 0; iPoint--) {
-      DiagonalProduct(xStar, iPoint);               // Compute D.x*
-      for (iVar = 0; iVar < nVar; iVar++)
-        aux_vector[iVar] = prod_row_vector[iVar];   // Compute aux_vector = D.x*
-      UpperProduct(xStar, iPoint);                  // Compute U.x_(n+1)
-      for (iVar = 0; iVar < nVar; iVar++)
-        aux_vector[iVar] -= prod_row_vector[iVar];  // Compute aux_vector = D.x*-U.x_(n+1)
-      Gauss_Elimination(iPoint, aux_vector);        // Solve D.x* = aux_vector
-      for (iVar = 0; iVar < nVar; iVar++)
-        xStar[iPoint*nVar+iVar] = aux_vector[iVar]; // Assesing x_(1) = solution
-    }
+    ComputeLU_SGSPreconditioner(r, xStar, geometry, config);
     
     /*--- Update solution (x^k+1 = x^k + w*M^-1*r^k) using the xStar vector,
      which holds the update after applying the LU_SGS smoother, i.e., M^-1*r^k.
@@ -1914,55 +1744,741 @@ unsigned long CSysMatrix::LU_SGS_Smoother(const CSysVector & b, CSysVector & x,
   
 }
 
-unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConfig *config) {
+CAMGLevel::CAMGLevel(void) {
+  
+  nBlk      = 0;
+  nnz       = 0;
+  row_ptr   = NULL;
+  col_ind   = NULL;
+  dia_ptr   = NULL;
+  matrix    = NULL;
+  owner     = true;
+  invD      = NULL;
+  P_row_ptr = NULL;
+  P_col_ind = NULL;
+  P_val     = NULL;
+  R_row_ptr = NULL;
+  R_col_ind = NULL;
+  R_val     = NULL;
+  x         = NULL;
+  b         = NULL;
+  r         = NULL;
+  LU        = NULL;
+  perm      = NULL;
   
-  bool *check_Point, add_point;
-  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
-  unsigned short iMarker, iNode, ExtraLines = 100, MeanPoints;
-  su2double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
-  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
+}
+
+CAMGLevel::~CAMGLevel(void) {
   
-  /*--- Memory allocation --*/
+  if (owner) {
+    if (row_ptr != NULL) delete [] row_ptr;
+    if (col_ind != NULL) delete [] col_ind;
+    if (dia_ptr != NULL) delete [] dia_ptr;
+    if (matrix  != NULL) delete [] matrix;
+  }
   
-  check_Point = new bool [geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-    check_Point[iPoint] = true;
+  if (invD != NULL)      delete [] invD;
+  if (P_row_ptr != NULL) delete [] P_row_ptr;
+  if (P_col_ind != NULL) delete [] P_col_ind;
+  if (P_val != NULL)     delete [] P_val;
+  if (R_row_ptr != NULL) delete [] R_row_ptr;
+  if (R_col_ind != NULL) delete [] R_col_ind;
+  if (R_val != NULL)     delete [] R_val;
+  if (x != NULL)         delete [] x;
+  if (b != NULL)         delete [] b;
+  if (r != NULL)         delete [] r;
+  if (LU != NULL)        delete [] LU;
+  if (perm != NULL)      delete [] perm;
   
-  LineletBool = new bool[geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
-    LineletBool[iPoint] = false;
+}
+
+su2double CSysMatrix::BlockNorm(const su2double *val_block) const {
   
-  nLinelet = 0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
-        (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
-        (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
-      nLinelet += geometry->nVertex[iMarker];
-    }
-  }
+  unsigned long iVar;
+  su2double norm = 0.0;
   
-  /*--- If the domain contains well defined Linelets ---*/
+  for (iVar = 0; iVar < nVar*nVar; iVar++)
+    norm += val_block[iVar]*val_block[iVar];
   
-  if (nLinelet != 0) {
-    
-    /*--- Basic initial allocation ---*/
-    
-    LineletPoint = new vector<unsigned long>[nLinelet + ExtraLines];
-    
-    /*--- Define the basic linelets, starting from each vertex ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
-          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
-          (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
-          (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
-        iLinelet = 0;
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          LineletPoint[iLinelet].push_back(iPoint);
-          check_Point[iPoint] = false;
-          iLinelet++;
+  return sqrt(norm);
+  
+}
+
+void CSysMatrix::DeleteAMGHierarchy(void) {
+  
+  unsigned short iLevel;
+  
+  if (AMGLevel == NULL) return;
+  
+  for (iLevel = 0; iLevel < nAMGLevel; iLevel++)
+    delete AMGLevel[iLevel];
+  delete [] AMGLevel;
+  
+  AMGLevel  = NULL;
+  nAMGLevel = 0;
+  
+}
+
+void CSysMatrix::BuildAMGPreconditioner(void) {
+  
+  unsigned long nAgg, iBlk, index, *AP_row_ptr, *AP_col_ind;
+  su2double *AP_val;
+  long *agg;
+  bool smooth;
+  CAMGLevel *fine, *coarse;
+  
+  if (nVar != nEqn)
+    SU2_MPI::Error("The AMG preconditioner requires square blocks (nVar = nEqn).", CURRENT_FUNCTION);
+  
+  /*--- The prolongation is smoothed for symmetric (elliptic) systems. For
+   non symmetric systems (e.g. flow Jacobians) the smoothed Galerkin operators
+   lose the diagonal dominance that the Gauss-Seidel smoother relies on, and
+   plain aggregation is used instead. ---*/
+  
+  smooth = AMG_Symmetric();
+  
+  /*--- The values of the matrix change between calls, the hierarchy is
+   rebuilt from scratch every time. ---*/
+  
+  DeleteAMGHierarchy();
+  AMGLevel = new CAMGLevel* [AMG_MAX_LEVELS];
+  
+  /*--- The finest level is the domain part of this matrix, the couplings
+   with the halo points are dropped (as for ILU, the preconditioner is local
+   to each rank). ---*/
+  
+  fine = new CAMGLevel();
+  fine->nBlk    = nPointDomain;
+  fine->nnz     = nnz;
+  fine->row_ptr = row_ptr;
+  fine->col_ind = col_ind;
+  fine->dia_ptr = dia_ptr;
+  fine->matrix  = matrix;
+  fine->owner   = false;
+  
+  AMGLevel[0] = fine;
+  nAMGLevel = 1;
+  
+  while (true) {
+    
+    AMG_SetLevel(fine);
+    
+    if ((fine->nBlk <= AMG_COARSE_SIZE) || (nAMGLevel == AMG_MAX_LEVELS)) break;
+    
+    /*--- Aggregation, stop if the level does not coarsen enough anymore ---*/
+    
+    agg = new long [fine->nBlk];
+    AMG_Aggregate(fine, agg, nAgg);
+    
+    if ((nAgg == 0) || (nAgg > 0.9*fine->nBlk)) {
+      delete [] agg;
+      break;
+    }
+    
+    AMG_Prolongation(fine, agg, nAgg, smooth);
+    delete [] agg;
+    
+    /*--- Galerkin operator of the coarse level, Ac = R.A.P ---*/
+    
+    coarse = new CAMGLevel();
+    coarse->nBlk = nAgg;
+    
+    AMG_MatrixProduct(fine->nBlk, fine->nBlk, fine->row_ptr, fine->col_ind, fine->matrix,
+                      fine->P_row_ptr, fine->P_col_ind, fine->P_val, nAgg,
+                      AP_row_ptr, AP_col_ind, AP_val);
+    AMG_MatrixProduct(nAgg, fine->nBlk, fine->R_row_ptr, fine->R_col_ind, fine->R_val,
+                      AP_row_ptr, AP_col_ind, AP_val, nAgg,
+                      coarse->row_ptr, coarse->col_ind, coarse->matrix);
+    
+    delete [] AP_row_ptr;
+    delete [] AP_col_ind;
+    delete [] AP_val;
+    
+    coarse->nnz = coarse->row_ptr[nAgg];
+    coarse->dia_ptr = new unsigned long [nAgg];
+    for (iBlk = 0; iBlk < nAgg; iBlk++) {
+      coarse->dia_ptr[iBlk] = coarse->nnz;
+      for (index = coarse->row_ptr[iBlk]; index < coarse->row_ptr[iBlk+1]; index++)
+        if (coarse->col_ind[index] == iBlk) { coarse->dia_ptr[iBlk] = index; break; }
+      if (coarse->dia_ptr[iBlk] == coarse->nnz)
+        SU2_MPI::Error("Missing diagonal block in a coarse AMG level.", CURRENT_FUNCTION);
+    }
+    
+    AMGLevel[nAMGLevel] = coarse;
+    nAMGLevel++;
+    fine = coarse;
+    
+  }
+  
+  /*--- Direct solve on the coarsest level if it is small enough, otherwise
+   it is only smoothed. ---*/
+  
+  if (fine->nBlk*nVar <= AMG_DIRECT_SIZE) AMG_CoarseFactorization(fine);
+  
+}
+
+void CSysMatrix::AMG_SetLevel(CAMGLevel *level) {
+  
+  unsigned long iBlk, iVar, nb = nVar*nVar, n = level->nBlk*nVar;
+  
+  level->x = new su2double [n];
+  level->b = new su2double [n];
+  level->r = new su2double [n];
+  for (iVar = 0; iVar < n; iVar++) {
+    level->x[iVar] = 0.0; level->b[iVar] = 0.0; level->r[iVar] = 0.0;
+  }
+  
+  level->invD = new su2double [level->nBlk*nb];
+  for (iBlk = 0; iBlk < level->nBlk; iBlk++)
+    InverseBlock(&level->matrix[level->dia_ptr[iBlk]*nb], &level->invD[iBlk*nb]);
+  
+}
+
+void CSysMatrix::AMG_Aggregate(const CAMGLevel *level, long *agg, unsigned long &nAgg) {
+  
+  const unsigned long n = level->nBlk, nb = nVar*nVar;
+  unsigned long iBlk, jBlk, index;
+  long best;
+  bool free_blk;
+  su2double *diag_norm, *strength, max_strength;
+  long *agg_phase1;
+  
+  /*--- Strength of connection of each block, |Aij| > theta*sqrt(|Aii|.|Ajj|)
+   with the Frobenius norm of the blocks, weak connections are set to zero. ---*/
+  
+  diag_norm = new su2double [n];
+  strength  = new su2double [level->row_ptr[n]];
+  
+  for (iBlk = 0; iBlk < n; iBlk++)
+    diag_norm[iBlk] = BlockNorm(&level->matrix[level->dia_ptr[iBlk]*nb]);
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      jBlk = level->col_ind[index];
+      strength[index] = 0.0;
+      if ((jBlk >= n) || (jBlk == iBlk)) continue;
+      strength[index] = BlockNorm(&level->matrix[index*nb]);
+      if (strength[index] <= AMG_STRENGTH*sqrt(diag_norm[iBlk]*diag_norm[jBlk])) strength[index] = 0.0;
+    }
+  }
+  
+  /*--- Points without strong connections (e.g. Dirichlet rows) are solved
+   by the smoother and left out of the coarse space (agg = -2). ---*/
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    agg[iBlk] = -2;
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++)
+      if (strength[index] > 0.0) { agg[iBlk] = -1; break; }
+  }
+  
+  nAgg = 0;
+  
+  /*--- Phase 1: a point and its strong neighbours form a new aggregate if
+   none of the neighbours is aggregated yet. ---*/
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    if (agg[iBlk] != -1) continue;
+    free_blk = true;
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++)
+      if ((strength[index] > 0.0) && (agg[level->col_ind[index]] >= 0)) { free_blk = false; break; }
+    if (!free_blk) continue;
+    agg[iBlk] = nAgg;
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++)
+      if ((strength[index] > 0.0) && (agg[level->col_ind[index]] == -1)) agg[level->col_ind[index]] = nAgg;
+    nAgg++;
+  }
+  
+  /*--- Phase 2: the remaining points join the aggregate (from phase 1) of
+   their strongest neighbour. ---*/
+  
+  agg_phase1 = new long [n];
+  for (iBlk = 0; iBlk < n; iBlk++) agg_phase1[iBlk] = agg[iBlk];
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    if (agg[iBlk] != -1) continue;
+    best = -1; max_strength = 0.0;
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      if (strength[index] <= max_strength) continue;
+      if (agg_phase1[level->col_ind[index]] < 0) continue;
+      best = agg_phase1[level->col_ind[index]];
+      max_strength = strength[index];
+    }
+    if (best >= 0) agg[iBlk] = best;
+  }
+  
+  /*--- Phase 3: the points that are left form aggregates with their
+   strong neighbours that are not aggregated either. ---*/
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    if (agg[iBlk] != -1) continue;
+    agg[iBlk] = nAgg;
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++)
+      if ((strength[index] > 0.0) && (agg[level->col_ind[index]] == -1)) agg[level->col_ind[index]] = nAgg;
+    nAgg++;
+  }
+  
+  delete [] diag_norm;
+  delete [] strength;
+  delete [] agg_phase1;
+  
+}
+
+bool CSysMatrix::AMG_Symmetric(void) {
+  
+  const unsigned long nb = nVar*nVar;
+  unsigned long iPoint, jPoint, index, iVar, jVar;
+  su2double *Block_ji, diff = 0.0, norm = 0.0;
+  
+  /*--- Compare A_ij with A_ji^T, the pairs with a zero block are skipped
+   since the Dirichlet conditions only delete the rows of the matrix. ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      if ((jPoint >= nPointDomain) || (jPoint == iPoint)) continue;
+      Block_ji = GetBlock(jPoint, iPoint);
+      if ((Block_ji == NULL) || (BlockNorm(&matrix[index*nb]) == 0.0) || (BlockNorm(Block_ji) == 0.0)) continue;
+      for (iVar = 0; iVar < nVar; iVar++) {
+        for (jVar = 0; jVar < nVar; jVar++) {
+          diff += fabs(matrix[index*nb+iVar*nVar+jVar]-Block_ji[jVar*nVar+iVar]);
+          norm += fabs(matrix[index*nb+iVar*nVar+jVar]);
+        }
+      }
+    }
+  }
+  
+  return (diff <= 1E-8*norm);
+  
+}
+
+void CSysMatrix::AMG_Prolongation(CAMGLevel *level, const long *agg, unsigned long nAgg, bool smooth) {
+  
+  const unsigned long n = level->nBlk, nb = nVar*nVar;
+  unsigned long iBlk, jBlk, iAgg, index, iVar, jVar, row_begin, pos, P_nnz;
+  long *marker;
+  su2double *weight, rho, row_sum, omega;
+  vector<unsigned long> P_col;
+  vector<su2double> P_blk;
+  
+  /*--- Each aggregate is a column of the tentative prolongation P0, with the
+   (block) constant as near null space, scaled to unit norm. ---*/
+  
+  weight = new su2double [nAgg];
+  for (iAgg = 0; iAgg < nAgg; iAgg++) weight[iAgg] = 0.0;
+  for (iBlk = 0; iBlk < n; iBlk++)
+    if (agg[iBlk] >= 0) weight[agg[iBlk]] += 1.0;
+  for (iAgg = 0; iAgg < nAgg; iAgg++) weight[iAgg] = 1.0/sqrt(weight[iAgg]);
+  
+  /*--- Damping of the Jacobi smoothing of P0, omega = 4/3/rho(inv(D).A),
+   where rho is bounded by the infinity norm of inv(D).A (Gershgorin). ---*/
+  
+  rho = 0.0;
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      if (level->col_ind[index] >= n) continue;
+      (*MatMatKernel)(nVar, &level->invD[iBlk*nb], &level->matrix[index*nb], block);
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          sum_vector[iVar] += fabs(block[iVar*nVar+jVar]);
+    }
+    for (iVar = 0; iVar < nVar; iVar++) {
+      row_sum = sum_vector[iVar];
+      if (row_sum > rho) rho = row_sum;
+    }
+  }
+  omega = 0.0;
+  if (smooth && (rho > 0.0)) omega = FOUR3/rho;
+  
+  /*--- Smoothed prolongation P = (I - omega.inv(D).A).P0, built one block
+   row at a time, marker holds the position of each aggregate in the row. ---*/
+  
+  marker = new long [nAgg];
+  for (iAgg = 0; iAgg < nAgg; iAgg++) marker[iAgg] = -1;
+  
+  level->P_row_ptr = new unsigned long [n+1];
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    
+    row_begin = P_col.size();
+    level->P_row_ptr[iBlk] = row_begin;
+    
+    if (agg[iBlk] >= 0) {
+      iAgg = agg[iBlk];
+      marker[iAgg] = P_col.size();
+      P_col.push_back(iAgg);
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          P_blk.push_back((iVar == jVar)? weight[iAgg] : su2double(0.0));
+    }
+    
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      jBlk = level->col_ind[index];
+      if ((jBlk >= n) || (agg[jBlk] < 0)) continue;
+      iAgg = agg[jBlk];
+      if ((marker[iAgg] < 0) || ((unsigned long)marker[iAgg] < row_begin)) {
+        marker[iAgg] = P_col.size();
+        P_col.push_back(iAgg);
+        for (iVar = 0; iVar < nb; iVar++) P_blk.push_back(0.0);
+      }
+      (*MatMatKernel)(nVar, &level->invD[iBlk*nb], &level->matrix[index*nb], block);
+      pos = marker[iAgg]*nb;
+      for (iVar = 0; iVar < nb; iVar++)
+        P_blk[pos+iVar] -= omega*weight[iAgg]*block[iVar];
+    }
+    
+  }
+  
+  P_nnz = P_col.size();
+  level->P_row_ptr[n] = P_nnz;
+  level->P_col_ind = new unsigned long [P_nnz];
+  level->P_val = new su2double [P_nnz*nb];
+  for (index = 0; index < P_nnz; index++) level->P_col_ind[index] = P_col[index];
+  for (index = 0; index < P_nnz*nb; index++) level->P_val[index] = P_blk[index];
+  
+  /*--- Restriction R = P^T (the blocks are transposed as well) ---*/
+  
+  level->R_row_ptr = new unsigned long [nAgg+1];
+  level->R_col_ind = new unsigned long [P_nnz];
+  level->R_val = new su2double [P_nnz*nb];
+  
+  for (iAgg = 0; iAgg <= nAgg; iAgg++) level->R_row_ptr[iAgg] = 0;
+  for (index = 0; index < P_nnz; index++) level->R_row_ptr[level->P_col_ind[index]+1]++;
+  for (iAgg = 0; iAgg < nAgg; iAgg++) level->R_row_ptr[iAgg+1] += level->R_row_ptr[iAgg];
+  
+  for (iAgg = 0; iAgg < nAgg; iAgg++) marker[iAgg] = level->R_row_ptr[iAgg];
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    for (index = level->P_row_ptr[iBlk]; index < level->P_row_ptr[iBlk+1]; index++) {
+      iAgg = level->P_col_ind[index];
+      pos = marker[iAgg]; marker[iAgg]++;
+      level->R_col_ind[pos] = iBlk;
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          level->R_val[pos*nb+iVar*nVar+jVar] = level->P_val[index*nb+jVar*nVar+iVar];
+    }
+  }
+  
+  delete [] weight;
+  delete [] marker;
+  
+}
+
+void CSysMatrix::AMG_MatrixProduct(unsigned long nRow, unsigned long nColA,
+                                   const unsigned long *a_row_ptr, const unsigned long *a_col_ind, const su2double *a_val,
+                                   const unsigned long *b_row_ptr, const unsigned long *b_col_ind, const su2double *b_val,
+                                   unsigned long nColB, unsigned long *&c_row_ptr, unsigned long *&c_col_ind, su2double *&c_val) {
+  
+  const unsigned long nb = nVar*nVar;
+  unsigned long iRow, kRow, jCol, index_a, index_b, iVar, pos, count;
+  long *marker = new long [nColB];
+  
+  /*--- Symbolic product, number of blocks in each row of C ---*/
+  
+  for (jCol = 0; jCol < nColB; jCol++) marker[jCol] = -1;
+  
+  c_row_ptr = new unsigned long [nRow+1];
+  c_row_ptr[0] = 0;
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    count = 0;
+    for (index_a = a_row_ptr[iRow]; index_a < a_row_ptr[iRow+1]; index_a++) {
+      kRow = a_col_ind[index_a];
+      if (kRow >= nColA) continue;
+      for (index_b = b_row_ptr[kRow]; index_b < b_row_ptr[kRow+1]; index_b++) {
+        jCol = b_col_ind[index_b];
+        if (marker[jCol] != (long)iRow) { marker[jCol] = iRow; count++; }
+      }
+    }
+    c_row_ptr[iRow+1] = c_row_ptr[iRow] + count;
+  }
+  
+  /*--- Numeric product, marker holds the position of each column in the row ---*/
+  
+  c_col_ind = new unsigned long [c_row_ptr[nRow]];
+  c_val = new su2double [c_row_ptr[nRow]*nb];
+  for (pos = 0; pos < c_row_ptr[nRow]*nb; pos++) c_val[pos] = 0.0;
+  
+  for (jCol = 0; jCol < nColB; jCol++) marker[jCol] = -1;
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    pos = c_row_ptr[iRow];
+    for (index_a = a_row_ptr[iRow]; index_a < a_row_ptr[iRow+1]; index_a++) {
+      kRow = a_col_ind[index_a];
+      if (kRow >= nColA) continue;
+      for (index_b = b_row_ptr[kRow]; index_b < b_row_ptr[kRow+1]; index_b++) {
+        jCol = b_col_ind[index_b];
+        if ((marker[jCol] < 0) || ((unsigned long)marker[jCol] < c_row_ptr[iRow])) {
+          marker[jCol] = pos;
+          c_col_ind[pos] = jCol;
+          pos++;
+        }
+        (*MatMatKernel)(nVar, &a_val[index_a*nb], &b_val[index_b*nb], block);
+        for (iVar = 0; iVar < nb; iVar++)
+          c_val[marker[jCol]*nb+iVar] += block[iVar];
+      }
+    }
+  }
+  
+  delete [] marker;
+  
+}
+
+void CSysMatrix::AMG_CoarseFactorization(CAMGLevel *level) {
+  
+  const unsigned long N = level->nBlk*nVar, nb = nVar*nVar;
+  unsigned long iBlk, jBlk, index, iVar, jVar, iRow, jRow, kRow, pivot_row, aux_perm;
+  su2double pivot, aux;
+  su2double *LU;
+  
+  LU = new su2double [N*N];
+  level->LU = LU;
+  level->perm = new unsigned long [N];
+  
+  /*--- Dense copy of the operator ---*/
+  
+  for (index = 0; index < N*N; index++) LU[index] = 0.0;
+  for (iBlk = 0; iBlk < level->nBlk; iBlk++) {
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      jBlk = level->col_ind[index];
+      if (jBlk >= level->nBlk) continue;
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          LU[(iBlk*nVar+iVar)*N+jBlk*nVar+jVar] = level->matrix[index*nb+iVar*nVar+jVar];
+    }
+  }
+  
+  for (iRow = 0; iRow < N; iRow++) level->perm[iRow] = iRow;
+  
+  /*--- LU factorization with partial pivoting, a zero pivot (singular
+   direction) is skipped and solved as zero. ---*/
+  
+  for (kRow = 0; kRow < N; kRow++) {
+    
+    pivot_row = kRow;
+    for (iRow = kRow+1; iRow < N; iRow++)
+      if (fabs(LU[iRow*N+kRow]) > fabs(LU[pivot_row*N+kRow])) pivot_row = iRow;
+    
+    if (pivot_row != kRow) {
+      for (jRow = 0; jRow < N; jRow++) {
+        aux = LU[kRow*N+jRow]; LU[kRow*N+jRow] = LU[pivot_row*N+jRow]; LU[pivot_row*N+jRow] = aux;
+      }
+      aux_perm = level->perm[kRow]; level->perm[kRow] = level->perm[pivot_row]; level->perm[pivot_row] = aux_perm;
+    }
+    
+    pivot = LU[kRow*N+kRow];
+    if (pivot == 0.0) continue;
+    
+    for (iRow = kRow+1; iRow < N; iRow++) {
+      LU[iRow*N+kRow] /= pivot;
+      for (jRow = kRow+1; jRow < N; jRow++)
+        LU[iRow*N+jRow] -= LU[iRow*N+kRow]*LU[kRow*N+jRow];
+    }
+    
+  }
+  
+}
+
+void CSysMatrix::AMG_CoarseSolve(CAMGLevel *level) {
+  
+  const unsigned long N = level->nBlk*nVar;
+  const su2double *LU = level->LU;
+  long iRow, jRow;
+  su2double *x = level->x;
+  
+  /*--- Forward substitution with the unit lower factor ---*/
+  
+  for (iRow = 0; iRow < (long)N; iRow++) {
+    x[iRow] = level->b[level->perm[iRow]];
+    for (jRow = 0; jRow < iRow; jRow++)
+      x[iRow] -= LU[iRow*N+jRow]*x[jRow];
+  }
+  
+  /*--- Backward substitution with the upper factor ---*/
+  
+  for (iRow = (long)N-1; iRow >= 0; iRow--) {
+    for (jRow = iRow+1; jRow < (long)N; jRow++)
+      x[iRow] -= LU[iRow*N+jRow]*x[jRow];
+    if (LU[iRow*N+iRow] != 0.0) x[iRow] /= LU[iRow*N+iRow];
+    else x[iRow] = 0.0;
+  }
+  
+}
+
+void CSysMatrix::AMG_Smooth(CAMGLevel *level, bool forward) {
+  
+  const unsigned long n = level->nBlk, nb = nVar*nVar;
+  unsigned long iLoop, iBlk, jBlk, index, iVar;
+  
+  for (iLoop = 0; iLoop < n; iLoop++) {
+    
+    iBlk = forward? iLoop : n-1-iLoop;
+    
+    /*--- x_i = inv(D_i).(b_i - sum_{j != i} A_ij.x_j), with the latest x_j ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      sum_vector[iVar] = level->b[iBlk*nVar+iVar];
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      jBlk = level->col_ind[index];
+      if ((jBlk >= n) || (jBlk == iBlk)) continue;
+      (*MatVecKernel)(nVar, &level->matrix[index*nb], &level->x[jBlk*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++)
+        sum_vector[iVar] -= aux_vector[iVar];
+    }
+    (*MatVecKernel)(nVar, &level->invD[iBlk*nb], sum_vector, &level->x[iBlk*nVar]);
+    
+  }
+  
+}
+
+void CSysMatrix::AMG_Cycle(unsigned short iLevel) {
+  
+  CAMGLevel *level = AMGLevel[iLevel], *coarse;
+  const unsigned long n = level->nBlk, nb = nVar*nVar;
+  unsigned long iBlk, jBlk, index, iVar;
+  unsigned short iSweep;
+  
+  for (iVar = 0; iVar < n*nVar; iVar++) level->x[iVar] = 0.0;
+  
+  /*--- Coarsest level, direct solve or a few symmetric sweeps ---*/
+  
+  if (iLevel == nAMGLevel-1) {
+    if (level->LU != NULL) {
+      AMG_CoarseSolve(level);
+    }
+    else {
+      for (iSweep = 0; iSweep < AMG_COARSE_SWEEPS; iSweep++) {
+        AMG_Smooth(level, true);
+        AMG_Smooth(level, false);
+      }
+    }
+    return;
+  }
+  
+  coarse = AMGLevel[iLevel+1];
+  
+  /*--- Pre-smoothing (forward sweep) ---*/
+  
+  AMG_Smooth(level, true);
+  
+  /*--- Residual, r = b - A.x ---*/
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      level->r[iBlk*nVar+iVar] = level->b[iBlk*nVar+iVar];
+    for (index = level->row_ptr[iBlk]; index < level->row_ptr[iBlk+1]; index++) {
+      jBlk = level->col_ind[index];
+      if (jBlk >= n) continue;
+      (*MatVecKernel)(nVar, &level->matrix[index*nb], &level->x[jBlk*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++)
+        level->r[iBlk*nVar+iVar] -= aux_vector[iVar];
+    }
+  }
+  
+  /*--- Restriction of the residual, bc = R.r ---*/
+  
+  for (iBlk = 0; iBlk < coarse->nBlk; iBlk++) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      coarse->b[iBlk*nVar+iVar] = 0.0;
+    for (index = level->R_row_ptr[iBlk]; index < level->R_row_ptr[iBlk+1]; index++) {
+      jBlk = level->R_col_ind[index];
+      (*MatVecKernel)(nVar, &level->R_val[index*nb], &level->r[jBlk*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++)
+        coarse->b[iBlk*nVar+iVar] += aux_vector[iVar];
+    }
+  }
+  
+  /*--- Coarse grid correction, x = x + P.xc ---*/
+  
+  AMG_Cycle(iLevel+1);
+  
+  for (iBlk = 0; iBlk < n; iBlk++) {
+    for (index = level->P_row_ptr[iBlk]; index < level->P_row_ptr[iBlk+1]; index++) {
+      jBlk = level->P_col_ind[index];
+      (*MatVecKernel)(nVar, &level->P_val[index*nb], &coarse->x[jBlk*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++)
+        level->x[iBlk*nVar+iVar] += aux_vector[iVar];
+    }
+  }
+  
+  /*--- Post-smoothing (backward sweep, the cycle is symmetric) ---*/
+  
+  AMG_Smooth(level, false);
+  
+}
+
+void CSysMatrix::ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iVar;
+  CAMGLevel *fine;
+  
+  if (AMGLevel == NULL)
+    SU2_MPI::Error("The AMG preconditioner has not been built.", CURRENT_FUNCTION);
+  
+  fine = AMGLevel[0];
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++)
+    fine->b[iVar] = vec[iVar];
+  
+  AMG_Cycle(0);
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++)
+    prod[iVar] = fine->x[iVar];
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConfig *config) {
+  
+  bool *check_Point, add_point;
+  unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
+  unsigned short iMarker, iNode, ExtraLines = 100, MeanPoints;
+  su2double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
+  unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
+  
+  /*--- Memory allocation --*/
+  
+  check_Point = new bool [geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    check_Point[iPoint] = true;
+  
+  LineletBool = new bool[geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
+    LineletBool[iPoint] = false;
+  
+  nLinelet = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
+        (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
+        (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
+      nLinelet += geometry->nVertex[iMarker];
+    }
+  }
+  
+  /*--- If the domain contains well defined Linelets ---*/
+  
+  if (nLinelet != 0) {
+    
+    /*--- Basic initial allocation ---*/
+    
+    LineletPoint = new vector<unsigned long>[nLinelet + ExtraLines];
+    
+    /*--- Define the basic linelets, starting from each vertex ---*/
+    
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
+          (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
+          (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
+          (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
+        iLinelet = 0;
+        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          LineletPoint[iLinelet].push_back(iPoint);
+          check_Point[iPoint] = false;
+          iLinelet++;
         }
       }
     }
@@ -2221,3 +2737,476 @@ void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, C
   }
   
 }
+
+void CSysMatrix::SetBlockKernels(void) {
+  
+  /*--- Square blocks of the usual sizes (scalar, turbulence, flow and
+   structural systems) use kernels where the block size is a compile time
+   constant, so that the small dense loops can be fully unrolled. Any other
+   block falls back to the generic kernels. ---*/
+  
+  unsigned long nBlk = (nVar == nEqn)? nVar : 0;
+  
+  switch (nBlk) {
+    case 1:  SetBlockKernels_Size<1>(); break;
+    case 2:  SetBlockKernels_Size<2>(); break;
+    case 3:  SetBlockKernels_Size<3>(); break;
+    case 4:  SetBlockKernels_Size<4>(); break;
+    case 5:  SetBlockKernels_Size<5>(); break;
+    case 6:  SetBlockKernels_Size<6>(); break;
+    case 7:  SetBlockKernels_Size<7>(); break;
+    default: SetBlockKernels_Size<0>(); break;
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::SetBlockKernels_Size(void) {
+  
+  MatVecKernel         = &CSysMatrix::BlockVectorProduct<nBlk, su2double>;
+  MatMatKernel         = &CSysMatrix::BlockBlockProduct<nBlk>;
+  GaussKernel          = &CSysMatrix::BlockGaussElimination<nBlk>;
+  SpMVKernel           = &CSysMatrix::MatrixVectorProduct_Sweep<nBlk>;
+  JacobiKernel         = &CSysMatrix::Jacobi_Sweep<nBlk>;
+  ILUSweepKernel       = &CSysMatrix::ILU_Sweep<nBlk>;
+  LU_SGSForwardKernel  = &CSysMatrix::LU_SGS_ForwardSweep<nBlk>;
+  LU_SGSBackwardKernel = &CSysMatrix::LU_SGS_BackwardSweep<nBlk>;
+  
+}
+
+template<unsigned short nBlk, class MatrixType>
+void CSysMatrix::BlockVectorProduct(unsigned long n, const MatrixType *matrix, const su2double *vector, su2double *product) {
+  
+  const unsigned long nv = (nBlk == 0)? n : nBlk;
+  unsigned long iVar, jVar;
+  
+  for (iVar = 0; iVar < nv; iVar++) {
+    product[iVar] = 0.0;
+    for (jVar = 0; jVar < nv; jVar++) {
+      product[iVar] += matrix[iVar*nv+jVar] * vector[jVar];
+    }
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::BlockBlockProduct(unsigned long n, const su2double *matrix_a, const su2double *matrix_b, su2double *product) {
+  
+  const unsigned long nv = (nBlk == 0)? n : nBlk;
+  unsigned long iVar, jVar, kVar;
+  
+  for (iVar = 0; iVar < nv; iVar++) {
+    for (jVar = 0; jVar < nv; jVar++) {
+      product[iVar*nv+jVar] = 0.0;
+      for (kVar = 0; kVar < nv; kVar++) {
+        product[iVar*nv+jVar] += matrix_a[iVar*nv+kVar]*matrix_b[kVar*nv+jVar];
+      }
+    }
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::BlockGaussElimination(unsigned long n, su2double *Block, su2double *rhs) {
+  
+  const short nv = (nBlk == 0)? (short)n : (short)nBlk;
+  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
+  su2double weight, aux;
+  
+  if (nv == 1) {
+    rhs[0] /= Block[0];
+  }
+  else {
+    
+    /*--- Transform system in Upper Matrix ---*/
+    
+    for (iVar = 1; iVar < nv; iVar++) {
+      for (jVar = 0; jVar < iVar; jVar++) {
+        weight = Block[iVar*nv+jVar] / Block[jVar*nv+jVar];
+        for (kVar = jVar; kVar < nv; kVar++)
+          Block[iVar*nv+kVar] -= weight*Block[jVar*nv+kVar];
+        rhs[iVar] -= weight*rhs[jVar];
+      }
+    }
+    
+    /*--- Backwards substitution ---*/
+    
+    rhs[nv-1] = rhs[nv-1] / Block[nv*nv-1];
+    for (iVar = nv-2; iVar >= 0; iVar--) {
+      aux = 0.0;
+      for (jVar = iVar+1; jVar < nv; jVar++)
+        aux += Block[iVar*nv+jVar]*rhs[jVar];
+      rhs[iVar] = (rhs[iVar]-aux) / Block[iVar*nv+iVar];
+      if (iVar == 0) break;
+    }
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::MatrixVectorProduct_Sweep(const CSysVector & vec, CSysVector & prod) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  unsigned long row_i, index, iVar, jVar;
+  const su2double *mat_ij, *vec_j;
+  su2double *prod_i;
+  
+  for (row_i = 0; row_i < nPointDomain; row_i++) {
+    prod_i = &prod[row_i*nv]; // beginning of block row_i
+    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      vec_j  = &vec[col_ind[index]*nv]; // beginning of block col_ind[index]
+      mat_ij = &matrix[index*nv*nv];    // beginning of matrix block[row_i][col_ind[indx]]
+      for (iVar = 0; iVar < nv; iVar++) {
+        for (jVar = 0; jVar < nv; jVar++) {
+          prod_i[iVar] += mat_ij[iVar*nv+jVar]*vec_j[jVar];
+        }
+      }
+    }
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::Jacobi_Sweep(const CSysVector & vec, CSysVector & prod) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  unsigned long iPoint, iVar, jVar;
+  const su2double *invBlock_ii, *vec_i;
+  su2double *prod_i;
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    invBlock_ii = &invM[iPoint*nv*nv];
+    vec_i  = &vec[iPoint*nv];
+    prod_i = &prod[iPoint*nv];
+    for (iVar = 0; iVar < nv; iVar++) {
+      prod_i[iVar] = 0.0;
+      for (jVar = 0; jVar < nv; jVar++)
+        prod_i[iVar] += invBlock_ii[iVar*nv+jVar]*vec_i[jVar];
+    }
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::ILU_Sweep(CSysVector & prod) {
+  
+  if (ilu_single) ILU_SweepFactors<nBlk>(ILU_matrix_float, prod);
+  else ILU_SweepFactors<nBlk>(ILU_matrix, prod);
+  
+}
+
+template<unsigned short nBlk, class ScalarType>
+void CSysMatrix::ILU_SweepFactors(const ScalarType *ilu, CSysVector & prod) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  unsigned long iPoint;
+  
+  /*--- Sequential sweeps, in the natural order of the rows. ---*/
+  
+  if (LowerSchedule_ilu == NULL) {
+    
+    /*--- Forward solve the system using the lower matrix entries that
+     were computed and stored during the ILU preprocessing. Note
+     that we are overwriting the residual vector as we go. ---*/
+    
+    for (iPoint = 1; iPoint < nPointDomain; iPoint++)
+      ILU_ForwardRow<nBlk, ScalarType>(ilu, iPoint, prod, aux_vector);
+    
+    /*--- Backwards substitution (starts at the last row), the diagonal
+     blocks of the factorization are stored already inverted. ---*/
+    
+    for (iPoint = nPointDomain; iPoint > 0; iPoint--)
+      ILU_BackwardRow<nBlk, ScalarType>(ilu, iPoint-1, prod, aux_vector, sum_vector);
+    
+    return;
+  }
+  
+  /*--- Level scheduled sweeps, the rows of one level are independent and
+   each row does the same operations as in the sequential sweep, hence the
+   result is identical. The levels are separated by the implicit barrier
+   at the end of the worksharing loop. ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel
+#endif
+  {
+    unsigned long iLevel, iLoop;
+    su2double *work = &sweep_work[omp_get_thread_num()*2*nv];
+    
+    for (iLevel = 0; iLevel < LowerSchedule_ilu->nLevel; iLevel++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iLoop = LowerSchedule_ilu->level_ptr[iLevel]; iLoop < LowerSchedule_ilu->level_ptr[iLevel+1]; iLoop++)
+        ILU_ForwardRow<nBlk, ScalarType>(ilu, LowerSchedule_ilu->point[iLoop], prod, work);
+    }
+    
+    for (iLevel = 0; iLevel < UpperSchedule_ilu->nLevel; iLevel++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iLoop = UpperSchedule_ilu->level_ptr[iLevel]; iLoop < UpperSchedule_ilu->level_ptr[iLevel+1]; iLoop++)
+        ILU_BackwardRow<nBlk, ScalarType>(ilu, UpperSchedule_ilu->point[iLoop], prod, work, &work[nv]);
+    }
+
+  }
+  
+}
+
+template<unsigned short nBlk, class ScalarType>
+void CSysMatrix::ILU_ForwardRow(const ScalarType *ilu, unsigned long iPoint, CSysVector & prod, su2double *aux) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  const unsigned long nb = (nBlk == 0)? nVar*nEqn : nBlk*nBlk;
+  unsigned long index, iVar, jPoint;
+  su2double *prod_i = &prod[iPoint*nv];
+  
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    jPoint = col_ind_ilu[index];
+    if ((jPoint < iPoint) && (jPoint < nPointDomain)) {
+      BlockVectorProduct<nBlk, ScalarType>(nv, &ilu[index*nb], &prod[jPoint*nv], aux);
+      for (iVar = 0; iVar < nv; iVar++)
+        prod_i[iVar] -= aux[iVar];
+    }
+  }
+  
+}
+
+template<unsigned short nBlk, class ScalarType>
+void CSysMatrix::ILU_BackwardRow(const ScalarType *ilu, unsigned long iPoint, CSysVector & prod, su2double *aux, su2double *sum) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  const unsigned long nb = (nBlk == 0)? nVar*nEqn : nBlk*nBlk;
+  unsigned long index, iVar, jPoint;
+  su2double *prod_i = &prod[iPoint*nv];
+  
+  for (iVar = 0; iVar < nv; iVar++) sum[iVar] = 0.0;
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    jPoint = col_ind_ilu[index];
+    if ((jPoint >= iPoint+1) && (jPoint < nPointDomain)) {
+      BlockVectorProduct<nBlk, ScalarType>(nv, &ilu[index*nb], &prod[jPoint*nv], aux);
+      for (iVar = 0; iVar < nv; iVar++) sum[iVar] += aux[iVar];
+    }
+  }
+  for (iVar = 0; iVar < nv; iVar++) prod_i[iVar] = (prod_i[iVar]-sum[iVar]);
+  BlockVectorProduct<nBlk, ScalarType>(nv, &ilu[dia_ptr_ilu[iPoint]*nb], prod_i, aux);
+  for (iVar = 0; iVar < nv; iVar++) prod_i[iVar] = aux[iVar];
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::LU_SGS_ForwardSweep(const CSysVector & vec, CSysVector & prod) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  unsigned long iPoint;
+  
+  if (LowerSchedule == NULL) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      LU_SGS_ForwardRow<nBlk>(vec, iPoint, prod, aux_vector, sum_vector);
+    return;
+  }
+  
+  /*--- Level scheduled sweep (see ILU_SweepFactors) ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel
+#endif
+  {
+    unsigned long iLevel, iLoop;
+    su2double *work = &sweep_work[omp_get_thread_num()*2*nv];
+    
+    for (iLevel = 0; iLevel < LowerSchedule->nLevel; iLevel++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iLoop = LowerSchedule->level_ptr[iLevel]; iLoop < LowerSchedule->level_ptr[iLevel+1]; iLoop++)
+        LU_SGS_ForwardRow<nBlk>(vec, LowerSchedule->point[iLoop], prod, work, &work[nv]);
+    }
+
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::LU_SGS_BackwardSweep(CSysVector & prod) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  unsigned long iPoint;
+  
+  if (UpperSchedule == NULL) {
+    for (iPoint = nPointDomain; iPoint > 0; iPoint--)
+      LU_SGS_BackwardRow<nBlk>(iPoint-1, prod, aux_vector, sum_vector);
+    return;
+  }
+  
+  /*--- Level scheduled sweep (see ILU_SweepFactors) ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel
+#endif
+  {
+    unsigned long iLevel, iLoop;
+    su2double *work = &sweep_work[omp_get_thread_num()*2*nv];
+    
+    for (iLevel = 0; iLevel < UpperSchedule->nLevel; iLevel++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iLoop = UpperSchedule->level_ptr[iLevel]; iLoop < UpperSchedule->level_ptr[iLevel+1]; iLoop++)
+        LU_SGS_BackwardRow<nBlk>(UpperSchedule->point[iLoop], prod, work, &work[nv]);
+    }
+
+  }
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::LU_SGS_ForwardRow(const CSysVector & vec, unsigned long iPoint, CSysVector & prod, su2double *aux, su2double *sum) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  const unsigned long nb = (nBlk == 0)? nVar*nEqn : nBlk*nBlk;
+  unsigned long jPoint, iVar, index;
+  
+  for (iVar = 0; iVar < nv; iVar++)
+    sum[iVar] = vec[iPoint*nv+iVar];                                   // Initialize sum = b
+  for (index = row_ptr[iPoint]; index < dia_ptr[iPoint]; index++) {
+    jPoint = col_ind[index];
+    BlockVectorProduct<nBlk, su2double>(nv, &matrix[index*nb], &prod[jPoint*nv], aux);
+    for (iVar = 0; iVar < nv; iVar++)
+      sum[iVar] -= aux[iVar];                                           // Compute sum = b - L.x*
+  }
+  BlockVectorProduct<nBlk, su2double>(nv, &invM[iPoint*nv*nv], sum, &prod[iPoint*nv]);  // Assesing x* = inv(D).sum
+  
+}
+
+template<unsigned short nBlk>
+void CSysMatrix::LU_SGS_BackwardRow(unsigned long iPoint, CSysVector & prod, su2double *aux, su2double *sum) {
+  
+  const unsigned long nv = (nBlk == 0)? nVar : nBlk;
+  const unsigned long nb = (nBlk == 0)? nVar*nEqn : nBlk*nBlk;
+  unsigned long jPoint, iVar, index;
+  
+  for (iVar = 0; iVar < nv; iVar++)
+    sum[iVar] = 0.0;
+  for (index = dia_ptr[iPoint]+1; index < row_ptr[iPoint+1]; index++) {
+    jPoint = col_ind[index];
+    BlockVectorProduct<nBlk, su2double>(nv, &matrix[index*nb], &prod[jPoint*nv], aux);
+    for (iVar = 0; iVar < nv; iVar++)
+      sum[iVar] += aux[iVar];                                           // Compute sum = U.x_(1)
+  }
+  BlockVectorProduct<nBlk, su2double>(nv, &invM[iPoint*nv*nv], sum, aux);
+  for (iVar = 0; iVar < nv; iVar++)
+    prod[iPoint*nv + iVar] -= aux[iVar];                                // Assesing x_(1) = x* - inv(D).U.x_(1)
+  
+}
+
+template<class ScalarType>
+void CSysMatrix::BuildILU_Factorization(ScalarType *ilu, bool transposed) {
+  
+  const unsigned long nb = nVar*nEqn;
+  unsigned long index, index_, index_ik, iVar, jVar;
+  su2double *Block_ij;
+  long iPoint, jPoint, kPoint;
+  
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm, so that we have the factorization stored
+   in the ILU storage at the end of this preprocessing. ---*/
+  
+  for (iVar = 0; iVar < nnz_ilu*nb; iVar++) ilu[iVar] = 0.0;
+  
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jPoint = col_ind[index];
+      index_ = (ilu_fill_in == 0)? index : GetBlockIndex_ILUMatrix(iPoint, jPoint);
+      if (transposed) {
+        Block_ij = GetBlock(jPoint, iPoint);
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (jVar = 0; jVar < nEqn; jVar++)
+            ilu[index_*nb+iVar*nEqn+jVar] = Block_ij[jVar*nVar+iVar];
+      } else {
+        Block_ij = &(matrix[index*nb]);
+        for (iVar = 0; iVar < nb; iVar++)
+          ilu[index_*nb+iVar] = Block_ij[iVar];
+      }
+    }
+  }
+  
+  /*--- Transform system in Upper Matrix. The diagonal block of each row is
+   inverted as soon as the row is final and stored in place of the original
+   block, the rows below and the forward/backward sweeps of the preconditioner
+   then only need small matrix products. The blocks are loaded in su2double
+   work arrays (block, block_weight and block_inverse) for the products. ---*/
+  
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    
+    /*--- For each row (unknown), loop over all entries in A on this row
+     row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
+     row. ---*/
+    
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      
+      /*--- jPoint here is the column for each entry on this row ---*/
+      
+      jPoint = col_ind_ilu[index];
+      
+      /*--- Check that this column is in the lower triangular portion ---*/
+      
+      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
+        
+        /*--- If we're in the lower triangle, get this block, and right
+         multiply it by the (already inverted) diagonal of jPoint ---*/
+        
+        for (iVar = 0; iVar < nb; iVar++) {
+          block[iVar] = ilu[index*nb+iVar];
+          block_inverse[iVar] = ilu[dia_ptr_ilu[jPoint]*nb+iVar];
+        }
+        MatrixMatrixProduct(block, block_inverse, block_weight);
+        
+        /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
+        
+        for (index_ = row_ptr_ilu[jPoint]; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+          
+          /*--- Get the column of the entry ---*/
+          
+          kPoint = col_ind_ilu[index_];
+          
+          /*--- If the column is greater than jPoint, i.e., the upper
+           triangular part, then multiply and modify the matrix.
+           Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. The kPoint = jPoint term is
+           skipped as Aij is replaced by block_weight below. Blocks outside
+           of the sparse pattern of the factors are dropped. ---*/
+          
+          if (kPoint > jPoint) {
+            
+            index_ik = GetBlockIndex_ILUMatrix(iPoint, kPoint);
+            if (index_ik == nnz_ilu) continue;
+            
+            for (iVar = 0; iVar < nb; iVar++)
+              block_inverse[iVar] = ilu[index_*nb+iVar];
+            MatrixMatrixProduct(block_weight, block_inverse, block);
+            for (iVar = 0; iVar < nb; iVar++)
+              ilu[index_ik*nb+iVar] -= block[iVar];
+            
+          }
+        }
+        
+        /*--- Lastly, store block_weight in the lower triangular part, which
+         will be reused during the forward solve in the precon/smoother. ---*/
+        
+        for (iVar = 0; iVar < nb; iVar++)
+          ilu[index*nb+iVar] = block_weight[iVar];
+        
+      }
+    }
+    
+    /*--- The row is final, replace its diagonal block by the inverse ---*/
+    
+    for (iVar = 0; iVar < nb; iVar++)
+      block_weight[iVar] = ilu[dia_ptr_ilu[iPoint]*nb+iVar];
+    InverseBlock(block_weight, block_inverse);
+    for (iVar = 0; iVar < nb; iVar++)
+      ilu[dia_ptr_ilu[iPoint]*nb+iVar] = block_inverse[iVar];
+    
+  }
+  
+}
@@ -358,6 +358,24 @@ void CSysVector::SubtractBlock(unsigned long val_ipoint, su2double *val_residual
     vec_val[val_ipoint*nVar+iVar] -= val_residual[iVar];
 }
 
+void CSysVector::UpdateBlocks(unsigned long val_ipoint, unsigned long val_jpoint, su2double *val_residual) {
+  unsigned short iVar;
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    vec_val[val_ipoint*nVar+iVar] += val_residual[iVar];
+    vec_val[val_jpoint*nVar+iVar] -= val_residual[iVar];
+  }
+}
+
+void CSysVector::UpdateBlocksSub(unsigned long val_ipoint, unsigned long val_jpoint, su2double *val_residual) {
+  unsigned short iVar;
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    vec_val[val_ipoint*nVar+iVar] -= val_residual[iVar];
+    vec_val[val_jpoint*nVar+iVar] += val_residual[iVar];
+  }
+}
+
 void CSysVector::SetBlock(unsigned long val_ipoint, su2double *val_residual) {
   unsigned short iVar;
   
@@ -411,3 +429,17 @@ su2double dotProd(const CSysVector & u, const CSysVector & v) {
   
   return prod;
 }
+
+su2double dotProdLocal(const CSysVector & u, const CSysVector & v) {
+  
+  /*--- check for consistent sizes ---*/
+  if (u.nElm != v.nElm) {
+    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+  }
+  
+  su2double loc_prod = 0.0;
+  for (unsigned long i = 0; i < u.nElmDomain; i++)
+    loc_prod += u.vec_val[i]*v.vec_val[i];
+  
+  return loc_prod;
+}
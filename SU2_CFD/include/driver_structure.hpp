@@ -85,13 +85,19 @@ protected:
                 **transfer_types;               /*!< \brief Type of coupling between the distinct (physical) zones.*/
   bool StopCalc,                                /*!< \brief Stop computation flag.*/
        mixingplane,                             /*!< \brief mixing-plane simulation flag.*/
-       fsi;                                     /*!< \brief FSI simulation flag.*/
+       fsi,                                     /*!< \brief FSI simulation flag.*/
+       periodic,                                /*!< \brief Periodic BCs, partitioned with the old routines.*/
+       Rebalancing;                             /*!< \brief The containers are built again by the dynamic load balancing.*/
+  su2double *Interface_Time,                    /*!< \brief Time spent by this rank in the interface interpolation of each (target) zone.*/
+            *Rebalance_Cost;                    /*!< \brief Time spent by this rank in each zone at the last check of the load balance.*/
   CIteration **iteration_container;             /*!< \brief Container vector with all the iteration methods. */
   COutput *output;                              /*!< \brief Pointer to the COutput class. */
   CIntegration ***integration_container;        /*!< \brief Container vector with all the integration methods. */
   CGeometry ***geometry_container;              /*!< \brief Geometrical definition of the problem. */
   CSolver ****solver_container;                 /*!< \brief Container vector with all the solutions. */
   CNumerics *****numerics_container;            /*!< \brief Description of the numerical method (the way in which the equations are solved). */
+  CNumerics ******numerics_thread;              /*!< \brief Copies of numerics_container for the threads other than the master, [iZone][iThread]. */
+  unsigned short nThread;                       /*!< \brief Number of threads of each MPI rank. */
   CConfig **config_container;                   /*!< \brief Definition of the particular problem. */
   CSurfaceMovement **surface_movement;          /*!< \brief Surface movement classes of the problem. */
   CVolumetricMovement **grid_movement;          /*!< \brief Volume grid movement classes of the problem. */
@@ -134,6 +140,12 @@ public:
    */
   void Geometrical_Preprocessing();
 
+  /*!
+   * \brief Read the grid of a zone, partition it with ParMETIS and build its finest geometry.
+   * \param[in] val_iZone - Index of the zone.
+   */
+  void Partition_Preprocessing(unsigned short val_iZone);
+
   /*!
    * \brief Definition of the physics iteration class or within a single zone.
    * \param[in] iteration_container - Pointer to the iteration container to be instantiated.
@@ -205,6 +217,16 @@ public:
    */
   void Numerics_Postprocessing(CNumerics ****numerics_container, CSolver ***solver_container, CGeometry **geometry, CConfig *config);
 
+  /*!
+   * \brief Give the solvers of a zone the numerics of each thread for their edge loops.
+   * \param[in] numerics_container - Numerics of the master thread.
+   * \param[in] numerics_thread - Numerics of the other threads.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Numerics_Thread_Preprocessing(CNumerics ****numerics_container, CNumerics *****numerics_thread,
+                                     CSolver ***solver_container, CConfig *config);
+
   /*!
    * \brief Initialize Python interface functionalities
    */
@@ -279,6 +301,13 @@ public:
    */
   void StartSolver();
 
+  /*!
+   * \brief Partition the grids again with the measured cost if the load of the ranks is unbalanced,
+   *        and move the solution to the new partitions.
+   * \param[in] ExtIter - External iteration that has just been completed.
+   */
+  void Rebalance(unsigned long ExtIter);
+
   /*!
    * \brief A virtual member.
    */
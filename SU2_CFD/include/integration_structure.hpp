@@ -71,6 +71,7 @@ protected:
   Convergence_FSI,    /*!< \brief To indicate if the FSI problem has converged or not. */
   Convergence_FullMG;    /*!< \brief To indicate if the Full Multigrid has converged and it is necessary to add a new level. */
   su2double InitResidual;  /*!< \brief Initial value of the residual to evaluate the convergence level. */
+  su2double Cost_Time;  /*!< \brief Time spent by this rank in the space integration, for the partition weights. */
 
 public:
   
@@ -210,6 +211,12 @@ public:
    */
   bool GetConvergence(void);
   
+  /*!
+   * \brief Get the time spent by this rank in the space integration.
+   * \return Accumulated wall time of Space_Integration.
+   */
+  su2double GetCost_Time(void);
+  
   /*! 
    * \brief Get the indicator of the convergence for the Fluid-Structure Interaction problem.
    * \return <code>TRUE</code> means that the convergence criteria is satisfied;
@@ -707,4 +714,66 @@ public:
 
 };
 
+/*!
+ * \class CMatrixFreeVectorProduct
+ * \brief Jacobian-free product of the implicit flow system, (V/dt + dR/dU) u, where the
+ *        directional derivative of the residual is a forward finite difference of the
+ *        complete residual evaluation (primitives, gradients, limiters, fluxes and BCs).
+ *        The approximate (assembled) Jacobian is then only used to build the preconditioner.
+ */
+class CMatrixFreeVectorProduct : public CMatrixVectorProduct {
+private:
+  CIntegration *integration;   /*!< \brief Integration that evaluates the residual. */
+  CGeometry *geometry;         /*!< \brief Geometrical definition of the problem. */
+  CSolver **solver_container;  /*!< \brief Container vector with all the solutions. */
+  CNumerics **numerics;        /*!< \brief Numerics of the main solver. */
+  CConfig *config;             /*!< \brief Definition of the particular problem. */
+  CSolver *solver;             /*!< \brief Main solver of the system. */
+  unsigned short iMesh,        /*!< \brief Grid level. */
+  iRKStep,                     /*!< \brief Runge-Kutta step of the residual evaluation. */
+  RunTime_EqSystem;            /*!< \brief System of equations. */
+  unsigned long nPoint,        /*!< \brief Number of points (with halos). */
+  nPointDomain;                /*!< \brief Number of points of the domain. */
+  unsigned short nVar;         /*!< \brief Number of variables. */
+  CSysVector *Solution_Base,   /*!< \brief Solution about which the residual is linearized. */
+  *Residual_Base,              /*!< \brief Residual at the base solution. */
+  *Residual_Save;              /*!< \brief Copy of the right hand side of the system, overwritten by the evaluations. */
+  su2double Norm_Solution;     /*!< \brief Norm of the base solution, scales the finite difference step. */
+  
+  /*!
+   * \brief Evaluate the residual at the current solution without touching the Jacobian.
+   * \param[out] val_res - Residual.
+   */
+  void ComputeResidual(CSysVector & val_res) const;
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class, stores the base solution and evaluates the base residual.
+   * \param[in] integration_ref - Integration that evaluates the residual.
+   * \param[in] geometry_ref - Geometrical definition of the problem.
+   * \param[in] solver_container_ref - Container vector with all the solutions.
+   * \param[in] numerics_ref - Numerics of the main solver.
+   * \param[in] config_ref - Definition of the particular problem.
+   * \param[in] val_iMesh - Grid level.
+   * \param[in] val_iRKStep - Runge-Kutta step.
+   * \param[in] val_RunTime_EqSystem - System of equations.
+   */
+  CMatrixFreeVectorProduct(CIntegration *integration_ref, CGeometry *geometry_ref, CSolver **solver_container_ref,
+                           CNumerics **numerics_ref, CConfig *config_ref, unsigned short val_iMesh,
+                           unsigned short val_iRKStep, unsigned short val_RunTime_EqSystem);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CMatrixFreeVectorProduct(void);
+  
+  /*!
+   * \brief Jacobian-vector product by a forward finite difference of the residual.
+   * \param[in] u - CSysVector that is being multiplied by the Jacobian.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 #include "integration_structure.inl"
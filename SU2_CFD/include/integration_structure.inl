@@ -41,6 +41,8 @@ inline su2double CIntegration::GetCauchy_Value(void) { return Cauchy_Value; }
 
 inline bool CIntegration::GetConvergence(void) { return Convergence; }
 
+inline su2double CIntegration::GetCost_Time(void) { return Cost_Time; }
+
 inline bool CIntegration::GetConvergence_FSI(void) { return Convergence_FSI; }
 
 inline bool CIntegration::GetConvergence_FullMG(void) { return Convergence_FullMG; }
@@ -54,6 +54,45 @@
 
 using namespace std;
 
+/*--- Number of edges evaluated together by the batched convective fluxes,
+ one SIMD lane per edge (4 for AVX2, 8 for AVX-512 in double precision). ---*/
+
+#ifndef SU2_FLUX_BATCH
+#define SU2_FLUX_BATCH 4
+#endif
+
+/*!
+ * \class CFluxBatch
+ * \brief Inputs and outputs of the convective flux of a batch of edges, stored
+ *        per variable with one lane per edge so the flux routines vectorize across the edges.
+ * \note The edges of a batch share no point, so their residuals and Jacobians can be
+ *       added to the points without conflicts.
+ */
+class CFluxBatch {
+public:
+  unsigned short nEdge;		/*!< \brief Number of lanes in use. */
+  unsigned long Edge[SU2_FLUX_BATCH],	/*!< \brief Index of the edge of each lane. */
+  Point_i[SU2_FLUX_BATCH],		/*!< \brief First point of the edge of each lane. */
+  Point_j[SU2_FLUX_BATCH];		/*!< \brief Second point of the edge of each lane. */
+  su2double Normal[3][SU2_FLUX_BATCH];	/*!< \brief Normal vectors. */
+  su2double V_i[8][SU2_FLUX_BATCH],	/*!< \brief Primitive variables (T, v, p, rho, h, c) at point i. */
+  V_j[8][SU2_FLUX_BATCH];		/*!< \brief Primitive variables (T, v, p, rho, h, c) at point j. */
+  su2double Lambda_i[SU2_FLUX_BATCH], Lambda_j[SU2_FLUX_BATCH],	/*!< \brief Spectral radius at points i and j. */
+  Sensor_i[SU2_FLUX_BATCH], Sensor_j[SU2_FLUX_BATCH],	/*!< \brief Pressure sensor at points i and j. */
+  Neighbor_i[SU2_FLUX_BATCH], Neighbor_j[SU2_FLUX_BATCH];	/*!< \brief Number of neighbors of points i and j. */
+  su2double Und_Lapl_i[5][SU2_FLUX_BATCH],	/*!< \brief Undivided laplacians at point i. */
+  Und_Lapl_j[5][SU2_FLUX_BATCH];		/*!< \brief Undivided laplacians at point j. */
+  su2double Residual[5][SU2_FLUX_BATCH];	/*!< \brief Convective residual. */
+  su2double Jacobian_i[5][5][SU2_FLUX_BATCH],	/*!< \brief Jacobian of the residual with respect to point i. */
+  Jacobian_j[5][5][SU2_FLUX_BATCH];		/*!< \brief Jacobian of the residual with respect to point j. */
+  
+  /*!
+   * \brief Copy the first lane into the lanes that are not in use, so that all the
+   *        lanes of the flux routines work on valid states.
+   */
+  void SetPadding(void);
+};
+
 /*!
  * \class CNumerics
  * \brief Class for defining the numerical methods.
@@ -1152,6 +1191,55 @@ public:
                       su2double *val_soundspeed, su2double *val_normal,
                       su2double **val_invp_tensor);
   
+  /*!
+   * \brief Compute the projected inviscid flux of the lanes of a batch of edges.
+   * \param[in] val_density - Density of each lane.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_pressure - Pressure of each lane.
+   * \param[in] val_enthalpy - Enthalpy of each lane.
+   * \param[in] val_normal - Normal vector of each lane, the norm of the vector is the area of the face.
+   * \param[out] val_Proj_Flux - Projected flux of each lane.
+   */
+  void GetInviscidProjFlux_Batch(su2double *val_density, su2double (*val_velocity)[SU2_FLUX_BATCH],
+                                 su2double *val_pressure, su2double *val_enthalpy,
+                                 su2double (*val_normal)[SU2_FLUX_BATCH], su2double (*val_Proj_Flux)[SU2_FLUX_BATCH]);
+  
+  /*!
+   * \brief Compute the Jacobian of the projected inviscid flux of the lanes of a batch of edges.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_energy - Energy of each lane.
+   * \param[in] val_normal - Normal vector of each lane, the norm of the vector is the area of the face.
+   * \param[in] val_scale - Scale of the Jacobian.
+   * \param[out] val_Proj_Jac_Tensor - Jacobian of each lane.
+   */
+  void GetInviscidProjJac_Batch(su2double (*val_velocity)[SU2_FLUX_BATCH], su2double *val_energy,
+                                su2double (*val_normal)[SU2_FLUX_BATCH], su2double val_scale,
+                                su2double (*val_Proj_Jac_Tensor)[5][SU2_FLUX_BATCH]);
+  
+  /*!
+   * \brief Compute the matrix P of the lanes of a batch of edges.
+   * \param[in] val_density - Density of each lane.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_soundspeed - Sound speed of each lane.
+   * \param[in] val_normal - Unit normal vector of each lane.
+   * \param[out] val_p_tensor - P matrix of each lane.
+   */
+  void GetPMatrix_Batch(su2double *val_density, su2double (*val_velocity)[SU2_FLUX_BATCH],
+                        su2double *val_soundspeed, su2double (*val_normal)[SU2_FLUX_BATCH],
+                        su2double (*val_p_tensor)[5][SU2_FLUX_BATCH]);
+  
+  /*!
+   * \brief Compute the matrix P^{-1} of the lanes of a batch of edges.
+   * \param[in] val_density - Density of each lane.
+   * \param[in] val_velocity - Velocity of each lane.
+   * \param[in] val_soundspeed - Sound speed of each lane.
+   * \param[in] val_normal - Unit normal vector of each lane.
+   * \param[out] val_invp_tensor - Inverse of the P matrix of each lane.
+   */
+  void GetPMatrix_inv_Batch(su2double *val_density, su2double (*val_velocity)[SU2_FLUX_BATCH],
+                            su2double *val_soundspeed, su2double (*val_normal)[SU2_FLUX_BATCH],
+                            su2double (*val_invp_tensor)[5][SU2_FLUX_BATCH]);
+  
   /*!
    * \brief Compute viscous residual and jacobian.
    */
@@ -1212,6 +1300,26 @@ public:
   virtual void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i,
                                su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Whether the convective residual can be computed for a batch of edges.
+   * \return <code>TRUE</code> if ComputeResidual_Batch is implemented for the current options.
+   */
+  virtual bool GetBatch_Support(void);
+  
+  /*!
+   * \brief Copy the values set for the current edge (primitive variables, normal, ...) into a lane of a batch.
+   * \param[in] batch - Batch of edges.
+   * \param[in] val_lane - Lane of the edge.
+   */
+  virtual void SetBatch_Lane(CFluxBatch *batch, unsigned short val_lane);
+  
+  /*!
+   * \brief Compute the convective residual and Jacobians of a batch of edges.
+   * \param[in,out] batch - Batch of edges, with the residual and Jacobians of each lane on exit.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidual_Batch(CFluxBatch *batch, CConfig *config);
+  
   /*!
    * \overload
    * \param[out] val_residual - Pointer to the total residual.
@@ -1644,6 +1752,19 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief The batched Roe's flux is implemented for fixed grids without low dissipation.
+   * \return <code>TRUE</code> if ComputeResidual_Batch can be used.
+   */
+  bool GetBatch_Support(void);
+  
+  /*!
+   * \brief Compute the Roe's flux of a batch of edges, one lane per edge.
+   * \param[in,out] batch - Batch of edges, with the residual and Jacobians of each lane on exit.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CFluxBatch *batch, CConfig *config);
+  
 };
 
 
@@ -2687,6 +2808,27 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                        CConfig *config);
+  
+  /*!
+   * \brief The batched JST flux is implemented for fixed grids.
+   * \return <code>TRUE</code> if ComputeResidual_Batch can be used.
+   */
+  bool GetBatch_Support(void);
+  
+  /*!
+   * \brief Copy the values set for the current edge, including the spectral radius,
+   *        sensor, undivided laplacians and neighbors, into a lane of a batch.
+   * \param[in] batch - Batch of edges.
+   * \param[in] val_lane - Lane of the edge.
+   */
+  void SetBatch_Lane(CFluxBatch *batch, unsigned short val_lane);
+  
+  /*!
+   * \brief Compute the JST flux of a batch of edges, one lane per edge.
+   * \param[in,out] batch - Batch of edges, with the residual and Jacobians of each lane on exit.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(CFluxBatch *batch, CConfig *config);
 };
 
 /*!
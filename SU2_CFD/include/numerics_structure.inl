@@ -163,6 +163,14 @@ inline void CNumerics::ComputeResidual(su2double **val_Jacobian_i, su2double **v
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, 
                                    CConfig *config) { }
 
+inline bool CNumerics::GetBatch_Support(void) { return false; }
+
+inline void CNumerics::ComputeResidual_Batch(CFluxBatch *batch, CConfig *config) { }
+
+inline bool CUpwRoe_Flow::GetBatch_Support(void) { return (!grid_movement && !roe_low_dissipation); }
+
+inline bool CCentJST_Flow::GetBatch_Support(void) { return !grid_movement; }
+
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                                    su2double **val_JacobianMeanFlow_i, su2double **val_JacobianMeanFlow_j, CConfig *config) { }
 
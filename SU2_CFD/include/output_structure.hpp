@@ -534,12 +534,12 @@ public:
   void SetSU2_MeshASCII(CConfig *config, CGeometry *geometry, unsigned short val_iZone, ofstream &output_file);
   
   /*!
-   * \brief Write the nodal coordinates and connectivity to a Tecplot binary mesh file.
+   * \brief Write the nodal coordinates, connectivity and markers to a binary SU2 mesh file.
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] val_iZone - iZone index.
    */
-  void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry);
+  void SetSU2_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone);
   
   /*!
    * \brief Write the nodal coordinates to a binary file.
@@ -635,6 +635,13 @@ public:
    */
   void DeallocateSolution(CConfig *config, CGeometry *geometry);
   
+  /*!
+   * \brief Whether the history file has the columns of the lagged preconditioner (rebuilds and build time).
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> if the columns are written, in the header and in each line.
+   */
+  bool PrecLag_History(CConfig *config);
+  
   /*! 
    * \brief Write the header of the history file.
    * \param[in] ConvHist_file - Pointer to the convergence history file (which is defined in the main subroutine).
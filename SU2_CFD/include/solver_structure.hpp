@@ -65,6 +65,112 @@
 
 using namespace std;
 
+/*!
+ * \class CEdgeWork
+ * \brief Numerics and work arrays of one thread in the edge loops of the residuals.
+ * \note The master thread works with the members of the solver and the numerics
+ *       passed by the integration, the other threads with their own CEdgeWork.
+ */
+class CEdgeWork {
+public:
+  CNumerics **Numerics;	/*!< \brief Numerics of the thread for each term (not owned). */
+  su2double *Vector_i, *Vector_j;	/*!< \brief Reconstruction vectors (nDim). */
+  su2double *Primitive_i, *Primitive_j;	/*!< \brief Reconstructed primitive variables. */
+  su2double *Secondary_i, *Secondary_j;	/*!< \brief Reconstructed secondary variables. */
+  su2double *Solution_i, *Solution_j;	/*!< \brief Reconstructed solution (nVar). */
+  su2double *Residual;	/*!< \brief Flux of the edge (nVar). */
+  su2double **Jacobian_i, **Jacobian_j;	/*!< \brief Jacobians of the flux (nVar x nVar). */
+  unsigned short nVar;	/*!< \brief Number of variables of the solver. */
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_numerics - Numerics of the thread for each term.
+   * \param[in] val_nDim - Number of dimensions.
+   * \param[in] val_nVar - Number of variables of the solver.
+   * \param[in] val_nPrimVar - Number of primitive variables to reconstruct.
+   * \param[in] val_nSecondaryVar - Number of secondary variables to reconstruct.
+   */
+  CEdgeWork(CNumerics **val_numerics, unsigned short val_nDim, unsigned short val_nVar,
+            unsigned short val_nPrimVar, unsigned short val_nSecondaryVar);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CEdgeWork(void);
+};
+
+/*!
+ * \class CScratchPool
+ * \brief Scratch memory for the work arrays of the residual and boundary routines of a solver.
+ * \note The memory is handed out in stack order: a routine calls Push(), takes its arrays
+ *       with GetVector/GetMatrix and gives them back with Pop(). The blocks are never released,
+ *       so once every routine has run the iterations do not allocate.
+ */
+class CScratchPool {
+  vector<su2double*> Block;	/*!< \brief Blocks of values. */
+  vector<unsigned long> Block_Size;	/*!< \brief Number of values of each block. */
+  vector<su2double**> Row_Block;	/*!< \brief Blocks of row pointers of the matrices. */
+  vector<unsigned long> Row_Block_Size;	/*!< \brief Number of row pointers of each block. */
+  unsigned long iBlock, Top;	/*!< \brief Current block of values and first free value in it. */
+  unsigned long iRow_Block, Row_Top;	/*!< \brief Current block of row pointers and first free pointer in it. */
+  vector<unsigned long> Mark;	/*!< \brief Positions saved by Push (4 per level). */
+  unsigned long nAllocation;	/*!< \brief Number of heap allocations made by the pool. */
+  bool Locked;	/*!< \brief Allocating after Lock() is an error. */
+  
+  /*!
+   * \brief Count a heap allocation of the pool, and stop if the pool is locked.
+   */
+  void NewAllocation(void);
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   */
+  CScratchPool(void);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CScratchPool(void);
+  
+  /*!
+   * \brief Save the current position of the pool.
+   */
+  void Push(void);
+  
+  /*!
+   * \brief Give back all the arrays taken since the matching Push().
+   */
+  void Pop(void);
+  
+  /*!
+   * \brief Take a vector from the pool.
+   * \param[in] val_size - Number of values.
+   * \return Pointer to the vector, the values are not initialized.
+   */
+  su2double *GetVector(unsigned long val_size);
+  
+  /*!
+   * \brief Take a matrix from the pool.
+   * \param[in] val_nRow - Number of rows.
+   * \param[in] val_nCol - Number of columns.
+   * \return Pointer to the rows of the matrix, the values are not initialized.
+   */
+  su2double **GetMatrix(unsigned long val_nRow, unsigned long val_nCol);
+  
+  /*!
+   * \brief Forbid any further allocation of the pool (CHECK_SCRATCH_MEMORY option).
+   */
+  void Lock(void);
+  
+  /*!
+   * \brief Get the number of heap allocations made by the pool.
+   * \return Number of allocations.
+   */
+  unsigned long GetnAllocation(void);
+};
+
 /*!
  * \class CSolver
  * \brief Main class for defining the PDE solution, it requires
@@ -120,6 +226,14 @@ protected:
   
   su2double **Smatrix,  /*!< \brief Auxiliary structure for computing gradients by least-squares */
   **Cvector;       /*!< \brief Auxiliary structure for computing gradients by least-squares */
+  
+  CScratchPool *Scratch;  /*!< \brief Scratch memory of the residual and boundary routines. */
+  
+  map<unsigned short, CHaloExchange*> Halo;  /*!< \brief Halo exchange engines of the solver, by number of values per point. */
+  bool Halo_Overlap;  /*!< \brief True if the preprocessing may leave its last halo exchanges in flight for the residual. */
+  
+  unsigned short nThread_Edge;  /*!< \brief Number of threads of the edge loops of the residuals. */
+  CEdgeWork **EdgeWork;         /*!< \brief Numerics and work arrays of each thread, [0] is the solver itself. */
 
   int *Restart_Vars;       /*!< \brief Auxiliary structure for holding the number of variables and points in a restart. */
   int Restart_ExtIter;     /*!< \brief Auxiliary structure for holding the external iteration offset from a restart. */
@@ -140,6 +254,8 @@ public:
   CSysVector LinSysRes;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysVector LinSysAux;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysMatrix Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
+  CMatrixVectorProduct *MatrixFree_Product; /*!< \brief Matrix-free Jacobian-vector product of the implicit system, not owned (NULL to use the Jacobian). */
+  CSysSolve System; /*!< \brief Linear solver of the implicit system, kept between iterations (recycled Krylov directions, lagged preconditioner). */
   
   CSysMatrix StiffMatrix; /*!< \brief Sparse structure for storing the stiffness matrix in Galerkin computations, and grid movement. */
   
@@ -147,6 +263,7 @@ public:
   string* OutputHeadingNames; /*< \brief vector of strings to store the headings for the exra variables */
   
   CVariable** node;  /*!< \brief Vector which the define the variables for each problem. */
+  CVariableStorage *node_storage;  /*!< \brief Contiguous storage of the fields of node (NULL if each point allocates its own). */
   CVariable* node_infty; /*!< \brief CVariable storing the free stream conditions. */
   
   /*!
@@ -159,6 +276,44 @@ public:
    */
   virtual ~CSolver(void);
   
+  /*!
+   * \brief Give the threads of the edge loops their own numerics and work arrays.
+   * \param[in] val_nThread - Number of threads.
+   * \param[in] val_numerics - Numerics of each thread for each term, the ones of
+   *            the master thread ([0]) are the ones passed by the integration.
+   */
+  void SetEdgeWork(unsigned short val_nThread, CNumerics ***val_numerics);
+  
+  /*!
+   * \brief Get the scratch memory of the residual and boundary routines.
+   * \return Pointer to the scratch pool of the solver.
+   */
+  CScratchPool *GetScratch(void);
+  
+  /*!
+   * \brief Get the halo exchange engine for a given number of values per point, it is
+   *        created (with its buffers and requests) the first time it is requested.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nCount - Number of values exchanged per halo point.
+   * \return Pointer to the halo exchange engine.
+   */
+  CHaloExchange *GetHalo(CGeometry *geometry, CConfig *config, unsigned short val_nCount);
+  
+  /*!
+   * \brief Allow the next preprocessing to leave its last halo exchanges in flight, they are
+   *        completed by the residual once the edges without received points are computed.
+   * \param[in] val_overlap - <code>TRUE</code> if the residual follows the preprocessing.
+   */
+  void SetHalo_Overlap(bool val_overlap);
+  
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void Complete_MPI_Pending(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Set number of linear solver iterations.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -299,6 +454,18 @@ public:
    */
   unsigned short GetIterLinSolver(void);
   
+  /*!
+   * \brief Get whether the preconditioner of the linear solver was rebuilt in the last iteration.
+   * \return <code>TRUE</code> if it was rebuilt; <code>FALSE</code> if a lagged preconditioner was reused.
+   */
+  bool GetPrec_Rebuilt(void);
+  
+  /*!
+   * \brief Get the wall time spent building the preconditioner of the linear solver in the last iteration.
+   * \return Time in seconds.
+   */
+  su2double GetPrec_BuildTime(void);
+  
   /*!
    * \brief Get the value of the maximum delta time.
    * \return Value of the maximum delta time.
@@ -4552,6 +4719,14 @@ protected:
   unsigned short nMarkerTurboPerf;  /*!< \brief Number of turbo performance. */
 
   CFluidModel  *FluidModel;  /*!< \brief fluid model used in the solver */
+  CFluidModel **FluidModel_Thread;  /*!< \brief Copies of the fluid model for each thread (the first one is FluidModel). */
+  int nThread;  /*!< \brief Number of copies of the fluid model. */
+  
+  CFluxBatch *FluxBatch;  /*!< \brief Batch of edges for the vectorized convective fluxes (NULL if not used). */
+  
+  bool Pending_Primitive_Gradient,  /*!< \brief True if the exchange of the gradients is in flight. */
+  Pending_Primitive_Limiter,        /*!< \brief True if the exchange of the limiters is in flight. */
+  Pending_Primitive_Gradient_Limiter;  /*!< \brief True if the exchange of the gradients and limiters is in flight. */
 
   /*--- Turbomachinery Solver Variables ---*/
   su2double *** AverageFlux,
@@ -4653,6 +4828,42 @@ public:
    */
   void Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Impose the send-receive boundary condition for the gradient and the limiter
+   *        of the primitive variables in a single exchange.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Wait for the exchange of the gradients of the primitive variables and store them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Wait for the exchange of the limiters of the primitive variables and store them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Wait for the exchange of the gradients and limiters of the primitive variables and store them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Complete the halo exchanges left in flight by the preprocessing.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Pending(CGeometry *geometry, CConfig *config);
+  
   //  /*!
   //   * \brief Impose the send-receive boundary condition.
   //   * \param[in] geometry - Geometrical definition of the problem.
@@ -4751,12 +4962,25 @@ public:
   void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                        CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief Compute the convective fluxes of the edges stored in the batch and add them to the residual (and Jacobian).
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Convective_Residual_Batch(CNumerics *numerics, CConfig *config);
+  
   /*!
    * \brief Compute the extrapolated quantities, for MUSCL upwind 2nd reconstruction,
    * in a more thermodynamic consistent way
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_fluidmodel - Fluid model of the calling thread.
+   * \param[in,out] Prim_i - Reconstructed primitive variables at point i.
+   * \param[in,out] Prim_j - Reconstructed primitive variables at point j.
+   * \param[out] Sec_i - Reconstructed secondary variables at point i.
+   * \param[out] Sec_j - Reconstructed secondary variables at point j.
    */
-  void ComputeConsExtrapolation(CConfig *config);
+  void ComputeConsExtrapolation(CConfig *config, CFluidModel *val_fluidmodel,
+                                su2double *Prim_i, su2double *Prim_j, su2double *Sec_i, su2double *Sec_j);
 
   /*!
    * \brief Source term integration.
@@ -4865,6 +5089,14 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the Green-Gauss gradient and the limiter of the primitive variables in one
+   *        edge sweep and one point sweep (Barth-Jespersen and Venkatakrishnan limiters).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPrimitive_Gradient_GG_Limiter(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the preconditioner for convergence acceleration by Roe-Turkel method.
    * \param[in] iPoint - Index of the grid point
@@ -8436,6 +8668,14 @@ public:
    */
   unsigned long SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output);
   
+  /*!
+   * \brief Complete the halo exchanges left in flight by the preprocessing, and the vorticity
+   *        and strain rate magnitude of the received points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Complete_MPI_Pending(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Impose a constant heat-flux condition at the wall.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -37,6 +37,10 @@
 
 #pragma once
 
+inline void CScratchPool::Lock(void) { Locked = true; }
+
+inline unsigned long CScratchPool::GetnAllocation(void) { return nAllocation; }
+
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
 inline void CSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) { }
@@ -73,6 +77,10 @@ inline void CSolver::SetNondimensionalization(CGeometry *geometry, CConfig *conf
 
 inline unsigned short CSolver::GetIterLinSolver(void) { return IterLinSolver; }
 
+inline bool CSolver::GetPrec_Rebuilt(void) { return System.GetPrec_Rebuilt(); }
+
+inline su2double CSolver::GetPrec_BuildTime(void) { return System.GetPrec_BuildTime(); }
+
 inline su2double CSolver::GetCSensitivity(unsigned short val_marker, unsigned long val_vertex) { return 0; }
 
 inline void CSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep, 
@@ -942,6 +950,12 @@ inline void CSolver::Set_OldSolution(CGeometry *geometry) {
 
 inline void CSolver::Set_NewSolution(CGeometry *geometry) { }
 
+inline CScratchPool *CSolver::GetScratch(void) { return Scratch; }
+
+inline void CSolver::SetHalo_Overlap(bool val_overlap) { Halo_Overlap = val_overlap; }
+
+inline void CSolver::Complete_MPI_Pending(CGeometry *geometry, CConfig *config) { }
+
 inline unsigned short CSolver::GetnVar(void) { return nVar; }
 
 inline unsigned short CSolver::GetnOutputVariables(void) { return nOutputVariables; }
@@ -44,6 +44,7 @@
 #include <cmath>
 #include <iostream>
 #include <cstdlib>
+#include <vector>
 
 #include "../../Common/include/config_structure.hpp"
 #include "fluid_model.hpp"
@@ -51,6 +52,69 @@
 
 using namespace std;
 
+/*!
+ * \class CVariableStorage
+ * \brief Contiguous storage of the per-point fields of a solver.
+ *
+ * Each field (solution, gradient, primitive variables, ...) is a single block
+ * with one slot per point (nPoint x nVar, or nPoint x nRow x nCol for the
+ * gradients), instead of one small allocation per point and field. The
+ * constructors of the variables request their fields in the same order for
+ * every point, the n-th request of the i-th point gets slot i of block n.
+ */
+class CVariableStorage {
+private:
+  
+  unsigned long nPoint,    /*!< \brief Number of slots of each field. */
+  nPoint_Started;          /*!< \brief Number of points that requested their fields so far. */
+  unsigned short iField;   /*!< \brief Next field requested by the point under construction. */
+  vector<unsigned short> nRow, nCol;  /*!< \brief Shape of each field (nRow is 0 for vectors). */
+  vector<su2double*> Data;            /*!< \brief Values of each field. */
+  vector<su2double**> Rows;           /*!< \brief Row pointers of the matrix fields (NULL for vectors). */
+  
+  /*!
+   * \brief Get the block of the next field of the point under construction, allocated on first use.
+   * \param[in] val_nRow - Number of rows of the field (0 for a vector).
+   * \param[in] val_nCol - Number of columns of the field (size of a vector).
+   * \return Index of the field.
+   */
+  unsigned short NextField(unsigned short val_nRow, unsigned short val_nCol);
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nPoint - Number of points of the solver.
+   */
+  CVariableStorage(unsigned long val_nPoint);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CVariableStorage(void);
+  
+  /*!
+   * \brief Start the construction of the variables of the next point.
+   */
+  void NewPoint(void);
+  
+  /*!
+   * \brief Get the slot of the point under construction in the next vector field.
+   * \param[in] val_size - Size of the vector.
+   * \return Pointer to the first value of the slot.
+   */
+  su2double *GetVector(unsigned short val_size);
+  
+  /*!
+   * \brief Get the slot of the point under construction in the next matrix field.
+   * \param[in] val_nRow - Number of rows of the matrix.
+   * \param[in] val_nCol - Number of columns of the matrix.
+   * \return Row pointers of the slot.
+   */
+  su2double **GetMatrix(unsigned short val_nRow, unsigned short val_nCol);
+  
+};
+
 /*!
  * \class CVariable
  * \brief Main class for defining the variables.
@@ -91,6 +155,36 @@ protected:
                                                        note that this variable cannnot be static, it is possible to
                                                        have different number of nVar in the same problem. */
   su2double *Solution_Adj_Old;    /*!< \brief Solution of the problem in the previous AD-BGS iteration. */
+  static CVariableStorage *Storage;  /*!< \brief Contiguous storage used by the constructors, NULL for individual allocations. */
+  bool Contiguous;                   /*!< \brief The fields of this point live in a CVariableStorage (they are not deleted with it). */
+  
+  /*!
+   * \brief Allocate a per-point vector field, in the contiguous storage if there is one.
+   * \param[in] val_size - Size of the vector.
+   * \return Pointer to the vector.
+   */
+  su2double *NewVector(unsigned short val_size);
+  
+  /*!
+   * \brief Allocate a per-point matrix field (e.g. a gradient), in the contiguous storage if there is one.
+   * \param[in] val_nRow - Number of rows of the matrix.
+   * \param[in] val_nCol - Number of columns of the matrix.
+   * \return Row pointers of the matrix.
+   */
+  su2double **NewMatrix(unsigned short val_nRow, unsigned short val_nCol);
+  
+  /*!
+   * \brief Free a vector field allocated with NewVector.
+   * \param[in] val_vector - Pointer to the vector.
+   */
+  void DeleteVector(su2double *val_vector);
+  
+  /*!
+   * \brief Free a matrix field allocated with NewMatrix.
+   * \param[in] val_matrix - Row pointers of the matrix.
+   * \param[in] val_nRow - Number of rows of the matrix.
+   */
+  void DeleteMatrix(su2double **val_matrix, unsigned short val_nRow);
   
 public:
   
@@ -119,6 +213,12 @@ public:
    */
   virtual ~CVariable(void);
   
+  /*!
+   * \brief Set the contiguous storage used by the variables constructed next.
+   * \param[in] val_storage - Storage of the solver, NULL to go back to individual allocations.
+   */
+  static void SetStorage(CVariableStorage *val_storage);
+  
   /*!
    * \brief Set the value of the solution.
    * \param[in] val_solution - Solution of the problem.
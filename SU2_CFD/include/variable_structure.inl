@@ -37,6 +37,32 @@
 
 #pragma once
 
+inline void CVariable::SetStorage(CVariableStorage *val_storage) { Storage = val_storage; }
+
+inline su2double *CVariable::NewVector(unsigned short val_size) {
+  if (Contiguous) return Storage->GetVector(val_size);
+  return new su2double [val_size];
+}
+
+inline su2double **CVariable::NewMatrix(unsigned short val_nRow, unsigned short val_nCol) {
+  if (Contiguous) return Storage->GetMatrix(val_nRow, val_nCol);
+  su2double **matrix = new su2double* [val_nRow];
+  for (unsigned short iRow = 0; iRow < val_nRow; iRow++)
+    matrix[iRow] = new su2double [val_nCol];
+  return matrix;
+}
+
+inline void CVariable::DeleteVector(su2double *val_vector) {
+  if (!Contiguous) delete [] val_vector;
+}
+
+inline void CVariable::DeleteMatrix(su2double **val_matrix, unsigned short val_nRow) {
+  if (Contiguous) return;
+  for (unsigned short iRow = 0; iRow < val_nRow; iRow++)
+    delete [] val_matrix[iRow];
+  delete [] val_matrix;
+}
+
 inline bool CVariable::SetDensity(void) { return 0; }
 
 inline bool CVariable::SetDensity(su2double val_density){ return 0; }
@@ -42,10 +42,10 @@ CDriver::CDriver(char* confFile,
                  unsigned short val_nZone,
                  unsigned short val_nDim,
                  bool val_periodic,
-                 SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), nDim(val_nDim), StopCalc(false), fsi(false) {
+                 SU2_Comm MPICommunicator):config_file_name(confFile), StartTime(0.0), StopTime(0.0), UsedTime(0.0), ExtIter(0), nZone(val_nZone), nDim(val_nDim), StopCalc(false), fsi(false), periodic(val_periodic), Rebalancing(false) {
 
 
-  unsigned short jZone, iSol;
+  unsigned short jZone, iSol, iThread;
   unsigned short Kind_Grid_Movement;
   bool initStaticMovement;
 
@@ -73,6 +73,7 @@ CDriver::CDriver(char* confFile,
   geometry_container             = NULL;
   solver_container               = NULL;
   numerics_container             = NULL;
+  numerics_thread                = NULL;
   config_container               = NULL;
   surface_movement               = NULL;
   grid_movement                  = NULL;
@@ -88,6 +89,7 @@ CDriver::CDriver(char* confFile,
   solver_container               = new CSolver***[nZone];
   integration_container          = new CIntegration**[nZone];
   numerics_container             = new CNumerics****[nZone];
+  numerics_thread                = new CNumerics*****[nZone];
   config_container               = new CConfig*[nZone];
   geometry_container             = new CGeometry**[nZone];
   surface_movement               = new CSurfaceMovement*[nZone];
@@ -96,11 +98,14 @@ CDriver::CDriver(char* confFile,
   interpolator_container         = new CInterpolator**[nZone];
   transfer_container             = new CTransfer**[nZone];
   transfer_types                 = new unsigned short*[nZone];
+  Interface_Time                 = new su2double[nZone];
+  Rebalance_Cost                 = new su2double[nZone];
 
   for (iZone = 0; iZone < nZone; iZone++) {
     solver_container[iZone]               = NULL;
     integration_container[iZone]          = NULL;
     numerics_container[iZone]             = NULL;
+    numerics_thread[iZone]                = NULL;
     config_container[iZone]               = NULL;
     geometry_container[iZone]             = NULL;
     surface_movement[iZone]               = NULL;
@@ -109,6 +114,8 @@ CDriver::CDriver(char* confFile,
     interpolator_container[iZone]         = NULL;
     transfer_container[iZone]             = NULL;
     transfer_types[iZone]                 = new unsigned short[nZone];
+    Interface_Time[iZone]                 = 0.0;
+    Rebalance_Cost[iZone]                 = 0.0;
   }
 
   /*--- Loop over all zones to initialize the various classes. In most
@@ -127,45 +134,9 @@ CDriver::CDriver(char* confFile,
 
     config_container[iZone]->SetMPICommunicator(MPICommunicator);
 
-    /*--- Definition of the geometry class to store the primal grid in the
-     partitioning process. ---*/
+    /*--- Read, partition and distribute the grid of the zone. ---*/
 
-    CGeometry *geometry_aux = NULL;
-
-    /*--- All ranks process the grid and call ParMETIS for partitioning ---*/
-
-    geometry_aux = new CPhysicalGeometry(config_container[iZone], iZone, nZone);
-
-    /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
-
-    geometry_aux->SetColorGrid_Parallel(config_container[iZone]);
-
-    /*--- Allocate the memory of the current domain, and divide the grid
-     between the ranks. ---*/
-
-    geometry_container[iZone] = new CGeometry *[config_container[iZone]->GetnMGLevels()+1];
-
-    /*--- Until we finish the new periodic BC implementation, use the old
-     partitioning routines for cases with periodic BCs. The old routines 
-     will be entirely removed eventually in favor of the new methods. ---*/
-
-    if (val_periodic) {
-      geometry_container[iZone][MESH_0] = new CPhysicalGeometry(geometry_aux, config_container[iZone]);
-    } else {
-      geometry_container[iZone][MESH_0] = new CPhysicalGeometry(geometry_aux, config_container[iZone], val_periodic);
-    }
-
-    /*--- Deallocate the memory of geometry_aux ---*/
-
-    delete geometry_aux;
-
-    /*--- Add the Send/Receive boundaries ---*/
-
-    geometry_container[iZone][MESH_0]->SetSendReceive(config_container[iZone]);
-
-    /*--- Add the Send/Receive boundaries ---*/
-
-    geometry_container[iZone][MESH_0]->SetBoundaries(config_container[iZone]);
+    Partition_Preprocessing(iZone);
 
   }
 
@@ -321,6 +292,8 @@ CDriver::CDriver(char* confFile,
      steady state or time-accurately. ---*/
 
     integration_container[iZone] = new CIntegration*[MAX_SOLS];
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      integration_container[iZone][iSol] = NULL;
     Integration_Preprocessing(integration_container[iZone], geometry_container[iZone],
                               config_container[iZone]);
 
@@ -338,6 +311,21 @@ CDriver::CDriver(char* confFile,
     Numerics_Preprocessing(numerics_container[iZone], solver_container[iZone],
         geometry_container[iZone], config_container[iZone]);
 
+    /*--- Each thread of the edge loops works with its own copy of the numerics,
+     which keep the state of the edge being evaluated. ---*/
+
+    nThread = omp_get_max_threads();
+    numerics_thread[iZone] = new CNumerics****[nThread];
+    numerics_thread[iZone][0] = NULL;
+    for (iThread = 1; iThread < nThread; iThread++) {
+      numerics_thread[iZone][iThread] = new CNumerics***[config_container[iZone]->GetnMGLevels()+1];
+      Numerics_Preprocessing(numerics_thread[iZone][iThread], solver_container[iZone],
+          geometry_container[iZone], config_container[iZone]);
+    }
+    if (nThread > 1)
+      Numerics_Thread_Preprocessing(numerics_container[iZone], numerics_thread[iZone],
+          solver_container[iZone], config_container[iZone]);
+
     if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
 
   }
@@ -516,6 +504,7 @@ CDriver::CDriver(char* confFile,
 
 void CDriver::Postprocessing() {
 
+  unsigned short iThread;
   bool isBinary = config_container[ZONE_0]->GetWrt_Binary_Restart();
   bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
   
@@ -545,10 +534,29 @@ void CDriver::Postprocessing() {
      Numerics_Postprocessing(numerics_container[iZone], solver_container[iZone],
      geometry_container[iZone], config_container[iZone]);
     delete [] numerics_container[iZone];
+    for (iThread = 1; iThread < nThread; iThread++) {
+      Numerics_Postprocessing(numerics_thread[iZone][iThread], solver_container[iZone],
+      geometry_container[iZone], config_container[iZone]);
+      delete [] numerics_thread[iZone][iThread];
+    }
+    delete [] numerics_thread[iZone];
   }
   delete [] numerics_container;
+  delete [] numerics_thread;
   if (rank == MASTER_NODE) cout << "Deleted CNumerics container." << endl;
   
+  /*--- Measured cost of the partitions, read by the next weighted partitioning ---*/
+  
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (config_container[iZone]->GetPartition_Weights()) {
+      su2double Cost_Time = 0.0;
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++)
+        if (integration_container[iZone][iSol] != NULL)
+          Cost_Time += integration_container[iZone][iSol]->GetCost_Time();
+      geometry_container[iZone][MESH_0]->Write_Partition_Cost(config_container[iZone], Cost_Time);
+    }
+  }
+  
   for (iZone = 0; iZone < nZone; iZone++) {
     Integration_Postprocessing(integration_container[iZone],
                                geometry_container[iZone],
@@ -604,6 +612,9 @@ void CDriver::Postprocessing() {
     delete [] transfer_types;
   }
   
+  delete [] Interface_Time;
+  delete [] Rebalance_Cost;
+  
   for (iZone = 0; iZone < nZone; iZone++) {
     if (geometry_container[iZone] != NULL) {
       for (unsigned short iMGlevel = 0; iMGlevel < config_container[iZone]->GetnMGLevels()+1; iMGlevel++) {
@@ -708,27 +719,85 @@ void CDriver::Postprocessing() {
 
 }
 
+void CDriver::Partition_Preprocessing(unsigned short val_iZone) {
+
+  /*--- Definition of the geometry class to store the primal grid in the
+   partitioning process. ---*/
+
+  CGeometry *geometry_aux = NULL;
+
+  /*--- All ranks process the grid and call ParMETIS for partitioning ---*/
+
+  geometry_aux = new CPhysicalGeometry(config_container[val_iZone], val_iZone, nZone);
+
+  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+
+  geometry_aux->SetColorGrid_Parallel(config_container[val_iZone]);
+
+  /*--- Allocate the memory of the current domain, and divide the grid
+   between the ranks. ---*/
+
+  geometry_container[val_iZone] = new CGeometry *[config_container[val_iZone]->GetnMGLevels()+1];
+
+  /*--- Until we finish the new periodic BC implementation, use the old
+   partitioning routines for cases with periodic BCs. The old routines 
+   will be entirely removed eventually in favor of the new methods. ---*/
+
+  if (periodic) {
+    geometry_container[val_iZone][MESH_0] = new CPhysicalGeometry(geometry_aux, config_container[val_iZone]);
+  } else {
+    geometry_container[val_iZone][MESH_0] = new CPhysicalGeometry(geometry_aux, config_container[val_iZone], periodic);
+  }
+
+  /*--- Deallocate the memory of geometry_aux ---*/
+
+  delete geometry_aux;
+
+  /*--- Add the Send/Receive boundaries ---*/
+
+  geometry_container[val_iZone][MESH_0]->SetSendReceive(config_container[val_iZone]);
+
+  /*--- Add the Send/Receive boundaries ---*/
+
+  geometry_container[val_iZone][MESH_0]->SetBoundaries(config_container[val_iZone]);
+
+}
+
 void CDriver::Geometrical_Preprocessing() {
 
   unsigned short iMGlevel;
   unsigned short requestedMGlevels = config_container[ZONE_0]->GetnMGLevels();
   unsigned long iPoint;
-  bool fea = false;
+  bool fea = false, edge_coloring = false, threads = false;
+
+  /*--- The threaded edge loops need the coloring, with a single thread the edges
+   are kept in their natural order (one color) so that the cache locality is not lost ---*/
+
+#ifdef HAVE_OMP
+  threads = (omp_get_max_threads() > 1);
+  if (rank == MASTER_NODE) cout << "Threads per MPI rank: " << omp_get_max_threads() << "." << endl;
+#endif
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
     fea = ((config_container[iZone]->GetKind_Solver() == FEM_ELASTICITY) ||
            (config_container[iZone]->GetKind_Solver() == DISC_ADJ_FEM));
+    edge_coloring = (threads || config_container[iZone]->GetFlux_Batch_Flow());
 
     /*--- Compute elements surrounding points, points surrounding points ---*/
 
     if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
     geometry_container[iZone][MESH_0]->SetPoint_Connectivity();
 
-    /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+    /*--- Renumbering points using Reverse Cuthill McKee or Hilbert curve ordering ---*/
 
-    if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-    geometry_container[iZone][MESH_0]->SetRCM_Ordering(config_container[iZone]);
+    if (rank == MASTER_NODE) {
+      switch (config_container[iZone]->GetKind_Point_Ordering()) {
+        case RCM_ORDERING: cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl; break;
+        case HILBERT_ORDERING: cout << "Renumbering points (Hilbert Curve Ordering)." << endl; break;
+      }
+    }
+    geometry_container[iZone][MESH_0]->SetPoint_Ordering(config_container[iZone]);
 
     /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -755,6 +824,16 @@ void CDriver::Geometrical_Preprocessing() {
     geometry_container[iZone][MESH_0]->SetEdges();
     geometry_container[iZone][MESH_0]->SetVertex(config_container[iZone]);
 
+    /*--- Packed edge and point arrays, and colors of the edges for the
+     batched fluxes and the threaded edge loops of the solvers ---*/
+
+    geometry_container[iZone][MESH_0]->SetPackedStorage(config_container[iZone]);
+    geometry_container[iZone][MESH_0]->SetEdge_Coloring(edge_coloring);
+
+    /*--- Send and receive lists of the halo exchanges ---*/
+
+    geometry_container[iZone][MESH_0]->SetHalo_Pattern(config_container[iZone]);
+
     /*--- Compute cell center of gravity ---*/
 
     if ((rank == MASTER_NODE) && (!fea)) cout << "Computing centers of gravity." << endl;
@@ -766,6 +845,11 @@ void CDriver::Geometrical_Preprocessing() {
     geometry_container[iZone][MESH_0]->SetControlVolume(config_container[iZone], ALLOCATE);
     geometry_container[iZone][MESH_0]->SetBoundControlVolume(config_container[iZone], ALLOCATE);
 
+    /*--- Least-squares gradient weights, reused by the solvers until the grid moves ---*/
+
+    if ((config_container[iZone]->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) && !config_container[iZone]->GetDiscrete_Adjoint())
+      geometry_container[iZone][MESH_0]->SetLSGradient_Weights();
+
     /*--- Visualize a dual control volume if requested ---*/
 
     if ((config_container[iZone]->GetVisualize_CV() >= 0) &&
@@ -817,12 +901,17 @@ void CDriver::Geometrical_Preprocessing() {
 
       geometry_container[iZone][iMGlevel]->SetEdges();
       geometry_container[iZone][iMGlevel]->SetVertex(geometry_container[iZone][iMGlevel-1], config_container[iZone]);
+      geometry_container[iZone][iMGlevel]->SetPackedStorage(config_container[iZone]);
+      geometry_container[iZone][iMGlevel]->SetEdge_Coloring(edge_coloring);
+      geometry_container[iZone][iMGlevel]->SetHalo_Pattern(config_container[iZone]);
 
       /*--- Create the control volume structures ---*/
 
       geometry_container[iZone][iMGlevel]->SetControlVolume(config_container[iZone], geometry_container[iZone][iMGlevel-1], ALLOCATE);
       geometry_container[iZone][iMGlevel]->SetBoundControlVolume(config_container[iZone], geometry_container[iZone][iMGlevel-1], ALLOCATE);
       geometry_container[iZone][iMGlevel]->SetCoord(geometry_container[iZone][iMGlevel-1]);
+      if ((config_container[iZone]->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) && !config_container[iZone]->GetDiscrete_Adjoint())
+        geometry_container[iZone][iMGlevel]->SetLSGradient_Weights();
 
       /*--- Find closest neighbor to a surface point ---*/
 
@@ -1051,7 +1140,7 @@ void CDriver::Solver_Preprocessing(CSolver ***solver_container, CGeometry **geom
   bool update_geo = true;
   if (config->GetFSI_Simulation()) update_geo = false;
 
-  Solver_Restart(solver_container, geometry, config, update_geo);
+  if (!Rebalancing) Solver_Restart(solver_container, geometry, config, update_geo);
 
   /*--- Set up any necessary inlet profiles ---*/
 
@@ -2345,6 +2434,26 @@ void CDriver::Numerics_Preprocessing(CNumerics ****numerics_container,
 
 }
 
+void CDriver::Numerics_Thread_Preprocessing(CNumerics ****numerics_container, CNumerics *****numerics_thread,
+                                            CSolver ***solver_container, CConfig *config) {
+  
+  unsigned short iMGlevel, iSol, iThread;
+  CNumerics ***numerics = new CNumerics** [nThread];
+  
+  for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
+    for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+      if (solver_container[iMGlevel][iSol] == NULL) continue;
+      numerics[0] = numerics_container[iMGlevel][iSol];
+      for (iThread = 1; iThread < nThread; iThread++)
+        numerics[iThread] = numerics_thread[iThread][iMGlevel][iSol];
+      solver_container[iMGlevel][iSol]->SetEdgeWork(nThread, numerics);
+    }
+  }
+  
+  delete [] numerics;
+  
+}
+
 void CDriver::Numerics_Postprocessing(CNumerics ****numerics_container,
                                       CSolver ***solver_container, CGeometry **geometry,
                                       CConfig *config) {
@@ -3317,7 +3426,7 @@ void CDriver::TurbomachineryPreprocessing(){
     }
   }
 
-  if(!restart && !discrete_adjoint){
+  if(!restart && !discrete_adjoint && !Rebalancing){
     if (rank == MASTER_NODE) cout<<"Initialize turbomachinery solution quantities." << endl;
     for(iZone = 0; iZone < nZone; iZone++) {
       solver_container[iZone][MESH_0][FLOW_SOL]->SetFreeStream_TurboSolution(config_container[iZone]);
@@ -3397,12 +3506,384 @@ void CDriver::StartSolver() {
 
     if (StopCalc) break;
 
+    /*--- Partition the grids again if the load of the ranks is unbalanced. ---*/
+
+    Rebalance(ExtIter);
+
     ExtIter++;
 
   }
 
 }
 
+void CDriver::Rebalance(unsigned long ExtIter) {
+
+  unsigned short iSol, iVar, iDim, iThread, jZone, nVar, nState, iChildren;
+  unsigned long iPoint, Point_Fine, offset;
+  unsigned short Kind_Grid_Movement;
+  su2double Area_Parent, Area_Children, Volume_n, Volume_nM1;
+  su2double *State = NULL, *Solution = NULL, *Solution_n = NULL, *Solution_n1 = NULL, *Solution_Fine = NULL;
+  bool moving, dual_time, Unbalanced = false;
+
+  unsigned long Rebalance_Freq = config_container[ZONE_0]->GetRebalance_Freq();
+
+  /*--- The load is only checked every Rebalance_Freq physical time steps ---*/
+
+  if ((Rebalance_Freq == 0) || (size == SINGLE_NODE) || ((ExtIter+1) % Rebalance_Freq != 0)) return;
+
+  /*--- Time spent by this rank in each zone since the last check: the space
+   integration of the solvers plus the interpolation of the zone interfaces. ---*/
+
+  passivedouble *MyCost = new passivedouble[nZone];
+  passivedouble *MaxCost = new passivedouble[nZone];
+  passivedouble *SumCost = new passivedouble[nZone];
+  su2double *Cost_Time = new su2double[nZone];
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    Cost_Time[iZone] = 0.0;
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (integration_container[iZone][iSol] != NULL)
+        Cost_Time[iZone] += integration_container[iZone][iSol]->GetCost_Time();
+    MyCost[iZone] = SU2_TYPE::GetValue(Cost_Time[iZone] - Rebalance_Cost[iZone] + Interface_Time[iZone]);
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(MyCost, MaxCost, nZone, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(MyCost, SumCost, nZone, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  for (iZone = 0; iZone < nZone; iZone++) { MaxCost[iZone] = MyCost[iZone]; SumCost[iZone] = MyCost[iZone]; }
+#endif
+
+  /*--- Imbalance of each zone: slowest rank relative to the average ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    passivedouble Imbalance = 1.0;
+    if (SumCost[iZone] > 0.0) Imbalance = MaxCost[iZone]*passivedouble(size)/SumCost[iZone];
+    if (rank == MASTER_NODE)
+      cout << "Load imbalance of zone " << iZone << " (max/average time per rank): " << Imbalance << "." << endl;
+    if (Imbalance > SU2_TYPE::GetValue(config_container[iZone]->GetRebalance_Threshold())) Unbalanced = true;
+  }
+
+  /*--- Balanced enough, start a new measurement interval ---*/
+
+  if (!Unbalanced) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      Rebalance_Cost[iZone] = Cost_Time[iZone];
+      Interface_Time[iZone] = 0.0;
+    }
+    delete [] MyCost; delete [] MaxCost; delete [] SumCost; delete [] Cost_Time;
+    return;
+  }
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"--------------------------- Load Rebalancing ----------------------------" << endl;
+
+  vector<vector<su2double> > Linear_State(nZone);
+  vector<unsigned long> nPoint_Global(nZone);
+  vector<unsigned short> nState_Zone(nZone);
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    moving = config_container[iZone]->GetGrid_Movement();
+    dual_time = ((config_container[iZone]->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                 (config_container[iZone]->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+
+    /*--- The measured cost of the points of this rank feeds the weights of the
+     new partitioning through the partition cost file. ---*/
+
+    geometry_container[iZone][MESH_0]->Write_Partition_Cost(config_container[iZone], MyCost[iZone]);
+
+    /*--- Pack the state of the points of the finest grid: the coordinates,
+     grid velocities and previous volumes of a moving grid, followed by
+     the current and previous solutions of each solver. ---*/
+
+    nState = 0;
+    if (moving) nState += 4*nDim+2;
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      if (solver_container[iZone][MESH_0][iSol] != NULL)
+        nState += (dual_time? 3 : 1)*solver_container[iZone][MESH_0][iSol]->GetnVar();
+    nState_Zone[iZone] = nState;
+
+    CGeometry *geometry = geometry_container[iZone][MESH_0];
+    State = new su2double[geometry->GetnPoint()*nState];
+
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      offset = iPoint*nState;
+      if (moving) {
+        for (iDim = 0; iDim < nDim; iDim++) {
+          State[offset+iDim]        = geometry->node[iPoint]->GetCoord(iDim);
+          State[offset+nDim+iDim]   = geometry->node[iPoint]->GetCoord_n()[iDim];
+          State[offset+2*nDim+iDim] = geometry->node[iPoint]->GetCoord_n1()[iDim];
+          State[offset+3*nDim+iDim] = geometry->node[iPoint]->GetGridVel()[iDim];
+        }
+        State[offset+4*nDim]   = geometry->node[iPoint]->GetVolume_n();
+        State[offset+4*nDim+1] = geometry->node[iPoint]->GetVolume_nM1();
+        offset += 4*nDim+2;
+      }
+      for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+        if (solver_container[iZone][MESH_0][iSol] == NULL) continue;
+        CVariable *node = solver_container[iZone][MESH_0][iSol]->node[iPoint];
+        nVar = solver_container[iZone][MESH_0][iSol]->GetnVar();
+        for (iVar = 0; iVar < nVar; iVar++) {
+          State[offset+iVar] = node->GetSolution(iVar);
+          if (dual_time) {
+            State[offset+nVar+iVar]   = node->GetSolution_time_n()[iVar];
+            State[offset+2*nVar+iVar] = node->GetSolution_time_n1()[iVar];
+          }
+        }
+        offset += (dual_time? 3 : 1)*nVar;
+      }
+    }
+
+    /*--- Move the state to the linear partitioning, which does not depend on
+     the partitions that are about to be deleted. ---*/
+
+    geometry->CollectLinear_State(config_container[iZone], State, nState, nPoint_Global[iZone], Linear_State[iZone]);
+    delete [] State;
+
+  }
+
+  /*--- Delete everything that depends on the current partitions. The
+   configuration, iteration, output and surface movement classes are kept. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    Numerics_Postprocessing(numerics_container[iZone], solver_container[iZone],
+                            geometry_container[iZone], config_container[iZone]);
+    delete [] numerics_container[iZone];
+    for (iThread = 1; iThread < nThread; iThread++) {
+      Numerics_Postprocessing(numerics_thread[iZone][iThread], solver_container[iZone],
+                              geometry_container[iZone], config_container[iZone]);
+      delete [] numerics_thread[iZone][iThread];
+    }
+    delete [] numerics_thread[iZone];
+
+    Integration_Postprocessing(integration_container[iZone], geometry_container[iZone], config_container[iZone]);
+    delete [] integration_container[iZone];
+
+    Solver_Postprocessing(solver_container[iZone], geometry_container[iZone], config_container[iZone]);
+    delete [] solver_container[iZone];
+
+    if ((transfer_container[iZone] != NULL) && (interpolator_container[iZone] != NULL)) {
+      for (jZone = 0; jZone < nZone; jZone++) {
+        if (transfer_container[iZone][jZone] != NULL) delete transfer_container[iZone][jZone];
+        if (interpolator_container[iZone][jZone] != NULL) delete interpolator_container[iZone][jZone];
+        transfer_container[iZone][jZone] = NULL;
+        interpolator_container[iZone][jZone] = NULL;
+      }
+    }
+
+    if (grid_movement[iZone] != NULL) {
+      delete grid_movement[iZone];
+      grid_movement[iZone] = NULL;
+    }
+
+    for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+      delete geometry_container[iZone][iMesh];
+    delete [] geometry_container[iZone];
+
+  }
+
+  Rebalancing = true;
+
+  /*--- Partition the grids again, the cost file written above sets the weights ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++)
+    Partition_Preprocessing(iZone);
+
+  Geometrical_Preprocessing();
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+
+    moving = config_container[iZone]->GetGrid_Movement();
+    dual_time = ((config_container[iZone]->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                 (config_container[iZone]->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+    nState = nState_Zone[iZone];
+
+    CGeometry **geometry = geometry_container[iZone];
+    CConfig *config = config_container[iZone];
+
+    /*--- Retrieve the state of the points of the new partition ---*/
+
+    State = new su2double[geometry[MESH_0]->GetnPoint()*nState];
+    geometry[MESH_0]->DistributeLinear_State(config, Linear_State[iZone], nState, nPoint_Global[iZone], State);
+    vector<su2double>().swap(Linear_State[iZone]);
+
+    /*--- The grid is read again in its initial position, move it to
+     the current one and update the dual grid and the coarse levels. ---*/
+
+    if (moving) {
+      for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++) {
+        offset = iPoint*nState;
+        geometry[MESH_0]->node[iPoint]->SetCoord(&State[offset]);
+        geometry[MESH_0]->node[iPoint]->SetCoord_n(&State[offset+nDim]);
+        geometry[MESH_0]->node[iPoint]->SetCoord_n1(&State[offset+2*nDim]);
+        geometry[MESH_0]->node[iPoint]->SetGridVel(&State[offset+3*nDim]);
+        geometry[MESH_0]->node[iPoint]->SetVolume_n(State[offset+4*nDim]);
+        geometry[MESH_0]->node[iPoint]->SetVolume_nM1(State[offset+4*nDim+1]);
+      }
+
+      geometry[MESH_0]->SetCoord_CG();
+      geometry[MESH_0]->SetControlVolume(config, UPDATE);
+      geometry[MESH_0]->SetBoundControlVolume(config, UPDATE);
+
+      for (iMesh = 1; iMesh <= config->GetnMGLevels(); iMesh++) {
+        geometry[iMesh]->SetControlVolume(config, geometry[iMesh-1], UPDATE);
+        geometry[iMesh]->SetBoundControlVolume(config, geometry[iMesh-1], UPDATE);
+        geometry[iMesh]->SetCoord(geometry[iMesh-1]);
+        geometry[iMesh]->SetRestricted_GridVelocity(geometry[iMesh-1], config);
+        for (iPoint = 0; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+          Volume_n = 0.0; Volume_nM1 = 0.0;
+          for (iChildren = 0; iChildren < geometry[iMesh]->node[iPoint]->GetnChildren_CV(); iChildren++) {
+            Point_Fine = geometry[iMesh]->node[iPoint]->GetChildren_CV(iChildren);
+            Volume_n   += geometry[iMesh-1]->node[Point_Fine]->GetVolume_n();
+            Volume_nM1 += geometry[iMesh-1]->node[Point_Fine]->GetVolume_nM1();
+          }
+          geometry[iMesh]->node[iPoint]->SetVolume_n(Volume_n);
+          geometry[iMesh]->node[iPoint]->SetVolume_nM1(Volume_nM1);
+        }
+      }
+    }
+
+    /*--- Computation of wall distances for turbulence modeling ---*/
+
+    if (config->GetKind_Solver() == RANS)
+      geometry[MESH_0]->ComputeWall_Distance(config);
+
+    geometry[MESH_0]->SetPositive_ZArea(config);
+
+    for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      geometry[iMesh]->MatchNearField(config);
+      geometry[iMesh]->MatchInterface(config);
+      geometry[iMesh]->MatchActuator_Disk(config);
+    }
+
+    /*--- Solver, integration and numerics containers, as in the constructor ---*/
+
+    solver_container[iZone] = new CSolver** [config->GetnMGLevels()+1];
+    for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      solver_container[iZone][iMesh] = new CSolver* [MAX_SOLS];
+      for (iSol = 0; iSol < MAX_SOLS; iSol++)
+        solver_container[iZone][iMesh][iSol] = NULL;
+    }
+    Solver_Preprocessing(solver_container[iZone], geometry, config);
+
+    integration_container[iZone] = new CIntegration*[MAX_SOLS];
+    for (iSol = 0; iSol < MAX_SOLS; iSol++)
+      integration_container[iZone][iSol] = NULL;
+    Integration_Preprocessing(integration_container[iZone], geometry, config);
+
+    numerics_container[iZone] = new CNumerics***[config->GetnMGLevels()+1];
+    Numerics_Preprocessing(numerics_container[iZone], solver_container[iZone], geometry, config);
+
+    numerics_thread[iZone] = new CNumerics****[nThread];
+    numerics_thread[iZone][0] = NULL;
+    for (iThread = 1; iThread < nThread; iThread++) {
+      numerics_thread[iZone][iThread] = new CNumerics***[config->GetnMGLevels()+1];
+      Numerics_Preprocessing(numerics_thread[iZone][iThread], solver_container[iZone], geometry, config);
+    }
+    if (nThread > 1)
+      Numerics_Thread_Preprocessing(numerics_container[iZone], numerics_thread[iZone],
+                                    solver_container[iZone], config);
+
+    /*--- Unpack the solutions on the finest grid and restrict them to the
+     coarse levels, as it is done when a restart file is loaded. ---*/
+
+    CSolver ***solver = solver_container[iZone];
+
+    for (iPoint = 0; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++) {
+      offset = iPoint*nState;
+      if (moving) offset += 4*nDim+2;
+      for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+        if (solver[MESH_0][iSol] == NULL) continue;
+        nVar = solver[MESH_0][iSol]->GetnVar();
+        solver[MESH_0][iSol]->node[iPoint]->SetSolution(&State[offset]);
+        if (dual_time) {
+          solver[MESH_0][iSol]->node[iPoint]->Set_Solution_time_n(&State[offset+nVar]);
+          solver[MESH_0][iSol]->node[iPoint]->Set_Solution_time_n1(&State[offset+2*nVar]);
+        }
+        offset += (dual_time? 3 : 1)*nVar;
+      }
+    }
+    delete [] State;
+
+    for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+        if (solver[iMesh][iSol] == NULL) continue;
+        if (iMesh > 0) {
+          nVar = solver[iMesh][iSol]->GetnVar();
+          Solution = new su2double[nVar];
+          Solution_n = new su2double[nVar];
+          Solution_n1 = new su2double[nVar];
+          for (iPoint = 0; iPoint < geometry[iMesh]->GetnPoint(); iPoint++) {
+            Area_Parent = geometry[iMesh]->node[iPoint]->GetVolume();
+            for (iVar = 0; iVar < nVar; iVar++) { Solution[iVar] = 0.0; Solution_n[iVar] = 0.0; Solution_n1[iVar] = 0.0; }
+            for (iChildren = 0; iChildren < geometry[iMesh]->node[iPoint]->GetnChildren_CV(); iChildren++) {
+              Point_Fine = geometry[iMesh]->node[iPoint]->GetChildren_CV(iChildren);
+              Area_Children = geometry[iMesh-1]->node[Point_Fine]->GetVolume();
+              Solution_Fine = solver[iMesh-1][iSol]->node[Point_Fine]->GetSolution();
+              for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+              if (dual_time) {
+                Solution_Fine = solver[iMesh-1][iSol]->node[Point_Fine]->GetSolution_time_n();
+                for (iVar = 0; iVar < nVar; iVar++) Solution_n[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+                Solution_Fine = solver[iMesh-1][iSol]->node[Point_Fine]->GetSolution_time_n1();
+                for (iVar = 0; iVar < nVar; iVar++) Solution_n1[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+              }
+            }
+            solver[iMesh][iSol]->node[iPoint]->SetSolution(Solution);
+            if (dual_time) {
+              solver[iMesh][iSol]->node[iPoint]->Set_Solution_time_n(Solution_n);
+              solver[iMesh][iSol]->node[iPoint]->Set_Solution_time_n1(Solution_n1);
+            }
+          }
+          delete [] Solution; delete [] Solution_n; delete [] Solution_n1;
+        }
+        solver[iMesh][iSol]->Set_MPI_Solution(geometry[iMesh], config);
+      }
+
+      /*--- Primitive variables and eddy viscosity of the migrated solution ---*/
+
+      solver[iMesh][FLOW_SOL]->Preprocessing(geometry[iMesh], solver[iMesh], config, iMesh, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+      if (solver[iMesh][TURB_SOL] != NULL)
+        solver[iMesh][TURB_SOL]->Postprocessing(geometry[iMesh], solver[iMesh], config, iMesh);
+    }
+
+  }
+
+  /*--- Interfaces between the zones and grid movement of the new partitions ---*/
+
+  if (nZone > 1) Interface_Preprocessing();
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (config_container[iZone]->GetGrid_Movement()) {
+      grid_movement[iZone] = new CVolumetricMovement(geometry_container[iZone][MESH_0], config_container[iZone]);
+      surface_movement[iZone]->CopyBoundary(geometry_container[iZone][MESH_0], config_container[iZone]);
+    }
+  }
+
+  Kind_Grid_Movement = config_container[ZONE_0]->GetKind_GridMovement(ZONE_0);
+  if (config_container[ZONE_0]->GetGrid_Movement() && (Kind_Grid_Movement == MOVING_WALL ||
+      Kind_Grid_Movement == ROTATING_FRAME || Kind_Grid_Movement == STEADY_TRANSLATION))
+    InitStaticMeshMovement();
+
+  if (config_container[ZONE_0]->GetBoolTurbomachinery())
+    TurbomachineryPreprocessing();
+
+  PythonInterface_Preprocessing();
+
+  Rebalancing = false;
+
+  /*--- The new containers start measuring from zero ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    Rebalance_Cost[iZone] = 0.0;
+    Interface_Time[iZone] = 0.0;
+  }
+
+  delete [] MyCost; delete [] MaxCost; delete [] SumCost; delete [] Cost_Time;
+
+}
+
 void CDriver::PreprocessExtIter(unsigned long ExtIter) {
 
   /*--- Set the value of the external iteration. ---*/
@@ -3681,6 +4162,7 @@ void CFluidDriver::Run() {
 
   unsigned short iZone, jZone, checkConvergence;
   unsigned long IntIter, nIntIter;
+  su2double StartTime, StopTime;
   bool unsteady;
 
   /*--- Run a single iteration of a multi-zone problem by looping over all
@@ -3702,8 +4184,24 @@ void CFluidDriver::Run() {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {   
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && interpolator_container[iZone][jZone] != NULL)
-        interpolator_container[iZone][jZone]->Set_TransferCoeff(config_container);
+        if(jZone != iZone && interpolator_container[iZone][jZone] != NULL) {
+#ifndef HAVE_MPI
+          StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+          StartTime = MPI_Wtime();
+#endif
+          interpolator_container[iZone][jZone]->Set_TransferCoeff(config_container);
+#ifndef HAVE_MPI
+          StopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+          StopTime = MPI_Wtime();
+#endif
+
+          /*--- The search cost is charged to the target zone, whose
+           vertices are the ones being matched against the donor. ---*/
+
+          Interface_Time[jZone] += StopTime - StartTime;
+        }
     }
   }
 
@@ -3719,8 +4217,20 @@ void CFluidDriver::Run() {
     /*--- At each pseudo time-step updates transfer data ---*/
     for (iZone = 0; iZone < nZone; iZone++)   
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && transfer_container[iZone][jZone] != NULL)
+        if(jZone != iZone && transfer_container[iZone][jZone] != NULL) {
+#ifndef HAVE_MPI
+          StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+          StartTime = MPI_Wtime();
+#endif
           Transfer_Data(iZone, jZone);
+#ifndef HAVE_MPI
+          StopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+          StopTime = MPI_Wtime();
+#endif
+          Interface_Time[jZone] += StopTime - StartTime;
+        }
 
     /*--- For each zone runs one single iteration ---*/
 
@@ -50,6 +50,7 @@ CIntegration::CIntegration(CConfig *config) {
   Convergence_FullMG = false;
   Cauchy_Serie = new su2double [config->GetCauchy_Elems()+1];
   InitResidual = 0.0;
+  Cost_Time = 0.0;
 }
 
 CIntegration::~CIntegration(void) {
@@ -63,10 +64,20 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
   unsigned short iMarker, KindBC;
+  su2double StartTime, StopTime;
   
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  
+  /*--- Time of the residual evaluation, measured per rank for the
+   partition weights (see CGeometry::Write_Partition_Cost) ---*/
+  
+#ifndef HAVE_MPI
+  StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StartTime = MPI_Wtime();
+#endif
 
   /*--- Compute inviscid residuals ---*/
   
@@ -207,6 +218,14 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         }
         break;
     } 
+  
+#ifndef HAVE_MPI
+  StopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StopTime = MPI_Wtime();
+#endif
+  Cost_Time += StopTime - StartTime;
+  
 }
 
 void CIntegration::Space_Integration_FEM(CGeometry *geometry,
@@ -1003,3 +1022,128 @@ void CIntegration::Convergence_Monitoring_FSI(CGeometry *fea_geometry, CConfig *
   }
   
 }
+
+CMatrixFreeVectorProduct::CMatrixFreeVectorProduct(CIntegration *integration_ref, CGeometry *geometry_ref, CSolver **solver_container_ref,
+                                                   CNumerics **numerics_ref, CConfig *config_ref, unsigned short val_iMesh,
+                                                   unsigned short val_iRKStep, unsigned short val_RunTime_EqSystem) {
+  
+  unsigned long iPoint;
+  unsigned short iVar;
+  
+  integration      = integration_ref;
+  geometry         = geometry_ref;
+  solver_container = solver_container_ref;
+  numerics         = numerics_ref;
+  config           = config_ref;
+  iMesh            = val_iMesh;
+  iRKStep          = val_iRKStep;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  
+  solver       = solver_container[config->GetContainerPosition(RunTime_EqSystem)];
+  nPoint       = geometry->GetnPoint();
+  nPointDomain = geometry->GetnPointDomain();
+  nVar         = solver->GetnVar();
+  
+  Solution_Base = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+  Residual_Base = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+  Residual_Save = new CSysVector(nPoint, nPointDomain, nVar, 0.0);
+  
+  /*--- Store the solution about which the residual is linearized ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      (*Solution_Base)[iPoint*nVar+iVar] = solver->node[iPoint]->GetSolution(iVar);
+  
+  Norm_Solution = Solution_Base->norm();
+  
+  /*--- The base residual is evaluated with the same path as the perturbed
+   ones (and not taken from the right hand side) so that the differences
+   only contain the effect of the perturbation ---*/
+  
+  ComputeResidual(*Residual_Base);
+  
+}
+
+CMatrixFreeVectorProduct::~CMatrixFreeVectorProduct(void) {
+  
+  delete Solution_Base;
+  delete Residual_Base;
+  delete Residual_Save;
+  
+}
+
+void CMatrixFreeVectorProduct::ComputeResidual(CSysVector & val_res) const {
+  
+  /*--- The residual routines accumulate into the right hand side of the system
+   (which the Krylov solver is using) and into the Jacobian (which defines the
+   preconditioner), the former is saved and the latter is skipped by evaluating
+   the residual as for an explicit scheme ---*/
+  
+  unsigned short Kind_TimeIntScheme = config->GetKind_TimeIntScheme_Flow();
+  config->SetKind_TimeIntScheme_Flow(EULER_EXPLICIT);
+  
+  *Residual_Save = solver->LinSysRes;
+  
+  solver->Preprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, false);
+  integration->Space_Integration(geometry, solver_container, numerics, config, iMesh, iRKStep, RunTime_EqSystem);
+  
+  val_res = solver->LinSysRes;
+  solver->LinSysRes = *Residual_Save;
+  
+  config->SetKind_TimeIntScheme_Flow(Kind_TimeIntScheme);
+  
+}
+
+void CMatrixFreeVectorProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  
+  unsigned long iPoint, total_index;
+  unsigned short iVar;
+  su2double Delta, Vol, Delta_Time;
+  
+  su2double norm_u = u.norm();
+  if (norm_u == 0.0) { v = 0.0; return; }
+  
+  /*--- Step of the finite difference, relative to the size of the solution ---*/
+  
+  su2double eps = config->GetMatrixFree_Step()*(1.0 + Norm_Solution)/norm_u;
+  
+  /*--- Perturb the solution in the direction u and evaluate the residual ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar+iVar;
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[total_index] + eps*u[total_index]);
+    }
+  solver->Set_MPI_Solution(geometry, config);
+  
+  ComputeResidual(v);
+  
+  /*--- Restore the base solution (including the halos) ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->node[iPoint]->SetSolution(iVar, (*Solution_Base)[iPoint*nVar+iVar]);
+  
+  /*--- Directional derivative plus the pseudo time term, the rows of points
+   without time step are the identity as in ImplicitEuler_Iteration ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Vol = geometry->node[iPoint]->GetVolume();
+    Delta_Time = solver->node[iPoint]->GetDelta_Time();
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar+iVar;
+      if (Delta_Time != 0.0) {
+        Delta = Vol / Delta_Time;
+        v[total_index] = (v[total_index] - (*Residual_Base)[total_index])/eps + Delta*u[total_index];
+      }
+      else {
+        v[total_index] = u[total_index];
+      }
+    }
+  }
+  
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      v[iPoint*nVar+iVar] = 0.0;
+  
+}
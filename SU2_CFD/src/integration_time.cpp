@@ -140,6 +140,8 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
   
   bool startup_multigrid = (config[iZone]->GetRestart_Flow() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (Iteration == 0));
   unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
+  bool matrix_free = (config[iZone]->GetMatrixFree_Jacobian() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (iMesh == MESH_0));
+  CMatrixFreeVectorProduct *mat_vec = NULL;
   
   /*--- Do a presmoothing on the grid iMesh to be restricted to the grid iMesh+1 ---*/
   
@@ -154,8 +156,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
     
     for (iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
       
-      /*--- Send-Receive boundary conditions, and preprocessing ---*/
+      /*--- Send-Receive boundary conditions, and preprocessing. The space integration
+       follows, so the last halo exchanges may overlap with its interior edges ---*/
       
+      solver_container[iZone][iMesh][SolContainer_Position]->SetHalo_Overlap(RunTime_EqSystem == RUNTIME_FLOW_SYS);
       solver_container[iZone][iMesh][SolContainer_Position]->Preprocessing(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iMesh, iRKStep, RunTime_EqSystem, false);
       
       if (iRKStep == 0) {
@@ -181,10 +185,23 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
       
       Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
       
+      /*--- Jacobian-free products about the current solution, the Jacobian
+       computed by the space integration is then only the preconditioner ---*/
+      
+      if (matrix_free) {
+        mat_vec = new CMatrixFreeVectorProduct(this, geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
+        solver_container[iZone][iMesh][SolContainer_Position]->MatrixFree_Product = mat_vec;
+      }
+      
       /*--- Time integration, update solution using the old solution plus the solution increment ---*/
       
       Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
       
+      if (matrix_free) {
+        solver_container[iZone][iMesh][SolContainer_Position]->MatrixFree_Product = NULL;
+        delete mat_vec;
+      }
+      
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
       
       solver_container[iZone][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iMesh);
@@ -198,6 +215,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
   if ( (iMesh < config[iZone]->GetnMGLevels() && ((Iteration >= config[iZone]->GetnStartUpIter()) || startup_multigrid)) ) {
     /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
     
+    solver_container[iZone][iMesh][SolContainer_Position]->SetHalo_Overlap(RunTime_EqSystem == RUNTIME_FLOW_SYS);
     solver_container[iZone][iMesh][SolContainer_Position]->Preprocessing(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iMesh, NO_RK_ITER, RunTime_EqSystem, false);
     Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, NO_RK_ITER, RunTime_EqSystem);
     SetResidual_Term(geometry[iZone][iMesh], solver_container[iZone][iMesh][SolContainer_Position]);
@@ -248,8 +266,19 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ***geometry,
         }
         
         Space_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
+        
+        if (matrix_free) {
+          mat_vec = new CMatrixFreeVectorProduct(this, geometry[iZone][iMesh], solver_container[iZone][iMesh], numerics_container[iZone][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
+          solver_container[iZone][iMesh][SolContainer_Position]->MatrixFree_Product = mat_vec;
+        }
+        
         Time_Integration(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
         
+        if (matrix_free) {
+          solver_container[iZone][iMesh][SolContainer_Position]->MatrixFree_Product = NULL;
+          delete mat_vec;
+        }
+        
         solver_container[iZone][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iMesh], solver_container[iZone][iMesh], config[iZone], iMesh);
         
       }
@@ -514,6 +514,16 @@ void CFluidIteration::Iterate(COutput *output,
                                                                      config_container, RUNTIME_HEAT_SYS, IntIter, val_iZone);
   }
   
+  /*--- Every residual routine has run once, the next iterations must reuse
+   the scratch memory of the solvers without allocating ---*/
+  
+  if (config_container[val_iZone]->GetCheck_Scratch_Memory()) {
+    for (unsigned short iMesh = 0; iMesh <= config_container[val_iZone]->GetnMGLevels(); iMesh++)
+      for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++)
+        if (solver_container[val_iZone][iMesh][iSol] != NULL)
+          solver_container[val_iZone][iMesh][iSol]->GetScratch()->Lock();
+  }
+  
   /*--- Call Dynamic mesh update if AEROELASTIC motion was specified ---*/
   
   if ((config_container[val_iZone]->GetGrid_Movement()) && (config_container[val_iZone]->GetAeroelastic_Simulation()) && unsteady) {
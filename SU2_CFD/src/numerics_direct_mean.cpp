@@ -232,6 +232,163 @@ void CCentJST_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   AD::EndPreacc();
 }
 
+void CCentJST_Flow::SetBatch_Lane(CFluxBatch *batch, unsigned short val_lane) {
+  
+  CNumerics::SetBatch_Lane(batch, val_lane);
+  
+  batch->Lambda_i[val_lane] = Lambda_i;   batch->Lambda_j[val_lane] = Lambda_j;
+  batch->Sensor_i[val_lane] = Sensor_i;   batch->Sensor_j[val_lane] = Sensor_j;
+  batch->Neighbor_i[val_lane] = su2double(Neighbor_i);
+  batch->Neighbor_j[val_lane] = su2double(Neighbor_j);
+  for (iVar = 0; iVar < nVar; iVar++) {
+    batch->Und_Lapl_i[iVar][val_lane] = Und_Lapl_i[iVar];
+    batch->Und_Lapl_j[iVar][val_lane] = Und_Lapl_j[iVar];
+  }
+  
+}
+
+void CCentJST_Flow::ComputeResidual_Batch(CFluxBatch *batch, CConfig *config) {
+  
+  unsigned short iLane;
+  su2double (*V_i)[SU2_FLUX_BATCH] = batch->V_i, (*V_j)[SU2_FLUX_BATCH] = batch->V_j;
+  su2double (*Normal)[SU2_FLUX_BATCH] = batch->Normal, (*Residual)[SU2_FLUX_BATCH] = batch->Residual;
+  su2double (*Jacobian_i)[5][SU2_FLUX_BATCH] = batch->Jacobian_i, (*Jacobian_j)[5][SU2_FLUX_BATCH] = batch->Jacobian_j;
+  
+  su2double Density_i[SU2_FLUX_BATCH], Density_j[SU2_FLUX_BATCH], Enthalpy_i[SU2_FLUX_BATCH], Enthalpy_j[SU2_FLUX_BATCH],
+  Energy_i[SU2_FLUX_BATCH], Energy_j[SU2_FLUX_BATCH], sq_vel_i[SU2_FLUX_BATCH], sq_vel_j[SU2_FLUX_BATCH],
+  U_i[5][SU2_FLUX_BATCH], U_j[5][SU2_FLUX_BATCH], MeanDensity[SU2_FLUX_BATCH], MeanPressure[SU2_FLUX_BATCH],
+  MeanEnthalpy[SU2_FLUX_BATCH], MeanEnergy[SU2_FLUX_BATCH], MeanVelocity[3][SU2_FLUX_BATCH],
+  ProjVelocity_i[SU2_FLUX_BATCH], ProjVelocity_j[SU2_FLUX_BATCH], Area[SU2_FLUX_BATCH], MeanLambda[SU2_FLUX_BATCH],
+  Epsilon_2[SU2_FLUX_BATCH], Epsilon_4[SU2_FLUX_BATCH], Dissipation[SU2_FLUX_BATCH], Phi_i, Phi_j, sc2, sc4;
+  
+  /*--- Same operations as ComputeResidual, each loop runs over the lanes
+   (edges) of the batch so that it can be vectorized. ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    Density_i[iLane] = V_i[nDim+2][iLane];     Density_j[iLane] = V_j[nDim+2][iLane];
+    Enthalpy_i[iLane] = V_i[nDim+3][iLane];    Enthalpy_j[iLane] = V_j[nDim+3][iLane];
+    Energy_i[iLane] = Enthalpy_i[iLane] - V_i[nDim+1][iLane]/Density_i[iLane];
+    Energy_j[iLane] = Enthalpy_j[iLane] - V_j[nDim+1][iLane]/Density_j[iLane];
+    sq_vel_i[iLane] = 0.0; sq_vel_j[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      sq_vel_i[iLane] += 0.5*V_i[iDim+1][iLane]*V_i[iDim+1][iLane];
+      sq_vel_j[iLane] += 0.5*V_j[iDim+1][iLane]*V_j[iDim+1][iLane];
+    }
+  
+  /*--- Recompute conservative variables ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    U_i[0][iLane] = Density_i[iLane]; U_j[0][iLane] = Density_j[iLane];
+    U_i[nDim+1][iLane] = Density_i[iLane]*Energy_i[iLane]; U_j[nDim+1][iLane] = Density_j[iLane]*Energy_j[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      U_i[iDim+1][iLane] = Density_i[iLane]*V_i[iDim+1][iLane];
+      U_j[iDim+1][iLane] = Density_j[iLane]*V_j[iDim+1][iLane];
+    }
+  
+  /*--- Compute mean values of the variables ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    MeanDensity[iLane] = 0.5*(Density_i[iLane]+Density_j[iLane]);
+    MeanPressure[iLane] = 0.5*(V_i[nDim+1][iLane]+V_j[nDim+1][iLane]);
+    MeanEnthalpy[iLane] = 0.5*(Enthalpy_i[iLane]+Enthalpy_j[iLane]);
+    MeanEnergy[iLane] = 0.5*(Energy_i[iLane]+Energy_j[iLane]);
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      MeanVelocity[iDim][iLane] = 0.5*(V_i[iDim+1][iLane]+V_j[iDim+1][iLane]);
+  
+  /*--- Residual of the inviscid flux ---*/
+  
+  GetInviscidProjFlux_Batch(MeanDensity, MeanVelocity, MeanPressure, MeanEnthalpy, Normal, Residual);
+  
+  /*--- Jacobians of the inviscid flux, scale = 0.5 because val_residual ~ 0.5*(fc_i+fc_j)*Normal ---*/
+  
+  if (implicit) {
+    GetInviscidProjJac_Batch(MeanVelocity, MeanEnergy, Normal, 0.5, Jacobian_i);
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+          Jacobian_j[iVar][jVar][iLane] = Jacobian_i[iVar][jVar][iLane];
+  }
+  
+  /*--- Compute the local spectral radius and the stretching factor ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    ProjVelocity_i[iLane] = 0.0; ProjVelocity_j[iLane] = 0.0; Area[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      ProjVelocity_i[iLane] += V_i[iDim+1][iLane]*Normal[iDim][iLane];
+      ProjVelocity_j[iLane] += V_j[iDim+1][iLane]*Normal[iDim][iLane];
+      Area[iLane] += Normal[iDim][iLane]*Normal[iDim][iLane];
+    }
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    
+    Area[iLane] = sqrt(Area[iLane]);
+    MeanLambda[iLane] = 0.5*((fabs(ProjVelocity_i[iLane])+V_i[nDim+4][iLane]*Area[iLane]) +
+                             (fabs(ProjVelocity_j[iLane])+V_j[nDim+4][iLane]*Area[iLane]));
+    
+    Phi_i = pow(batch->Lambda_i[iLane]/(4.0*MeanLambda[iLane]), Param_p);
+    Phi_j = pow(batch->Lambda_j[iLane]/(4.0*MeanLambda[iLane]), Param_p);
+    
+    sc2 = 3.0*(batch->Neighbor_i[iLane]+batch->Neighbor_j[iLane])/(batch->Neighbor_i[iLane]*batch->Neighbor_j[iLane]);
+    sc4 = sc2*sc2/4.0;
+    
+    Epsilon_2[iLane] = Param_Kappa_2*0.5*(batch->Sensor_i[iLane]+batch->Sensor_j[iLane])*sc2;
+    Epsilon_4[iLane] = max(0.0, Param_Kappa_4-Epsilon_2[iLane])*sc4;
+    
+    /*--- Stretching factor times the mean spectral radius ---*/
+    
+    Dissipation[iLane] = 4.0*Phi_i*Phi_j/(Phi_i+Phi_j);
+    
+  }
+  
+  /*--- Compute viscous part of the residual, with a correction for the enthalpy ---*/
+  
+  for (iVar = 0; iVar < nVar-1; iVar++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      Residual[iVar][iLane] += (Epsilon_2[iLane]*(U_i[iVar][iLane]-U_j[iVar][iLane]) -
+                                Epsilon_4[iLane]*(batch->Und_Lapl_i[iVar][iLane]-batch->Und_Lapl_j[iVar][iLane]))*Dissipation[iLane]*MeanLambda[iLane];
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+    Residual[nVar-1][iLane] += (Epsilon_2[iLane]*(Density_i[iLane]*Enthalpy_i[iLane]-Density_j[iLane]*Enthalpy_j[iLane]) -
+                                Epsilon_4[iLane]*(batch->Und_Lapl_i[nVar-1][iLane]-batch->Und_Lapl_j[nVar-1][iLane]))*Dissipation[iLane]*MeanLambda[iLane];
+  
+  /*--- Jacobian computation ---*/
+  
+  if (implicit) {
+    
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      
+      cte_0 = (Epsilon_2[iLane] + Epsilon_4[iLane]*(batch->Neighbor_i[iLane]+1.0))*Dissipation[iLane]*MeanLambda[iLane];
+      cte_1 = (Epsilon_2[iLane] + Epsilon_4[iLane]*(batch->Neighbor_j[iLane]+1.0))*Dissipation[iLane]*MeanLambda[iLane];
+      
+      for (iVar = 0; iVar < (nVar-1); iVar++) {
+        Jacobian_i[iVar][iVar][iLane] += cte_0;
+        Jacobian_j[iVar][iVar][iLane] -= cte_1;
+      }
+      
+      /*--- Last row of Jacobian_i and Jacobian_j ---*/
+      
+      Jacobian_i[nVar-1][0][iLane] += cte_0*Gamma_Minus_One*sq_vel_i[iLane];
+      Jacobian_j[nVar-1][0][iLane] -= cte_1*Gamma_Minus_One*sq_vel_j[iLane];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Jacobian_i[nVar-1][iDim+1][iLane] -= cte_0*Gamma_Minus_One*V_i[iDim+1][iLane];
+        Jacobian_j[nVar-1][iDim+1][iLane] += cte_1*Gamma_Minus_One*V_j[iDim+1][iLane];
+      }
+      Jacobian_i[nVar-1][nVar-1][iLane] += cte_0*Gamma;
+      Jacobian_j[nVar-1][nVar-1][iLane] -= cte_1*Gamma;
+      
+    }
+    
+  }
+  
+}
+
 CCentJST_KE_Flow::CCentJST_KE_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -2986,6 +3143,162 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
 }
 
+void CUpwRoe_Flow::ComputeResidual_Batch(CFluxBatch *batch, CConfig *config) {
+  
+  unsigned short iLane;
+  su2double (*V_i)[SU2_FLUX_BATCH] = batch->V_i, (*V_j)[SU2_FLUX_BATCH] = batch->V_j;
+  su2double (*Normal)[SU2_FLUX_BATCH] = batch->Normal, (*Residual)[SU2_FLUX_BATCH] = batch->Residual;
+  su2double (*Jacobian_i)[5][SU2_FLUX_BATCH] = batch->Jacobian_i, (*Jacobian_j)[5][SU2_FLUX_BATCH] = batch->Jacobian_j;
+  
+  su2double Area[SU2_FLUX_BATCH], UnitNormal[3][SU2_FLUX_BATCH], Density_i[SU2_FLUX_BATCH], Density_j[SU2_FLUX_BATCH],
+  Energy_i[SU2_FLUX_BATCH], Energy_j[SU2_FLUX_BATCH], U_i[5][SU2_FLUX_BATCH], U_j[5][SU2_FLUX_BATCH], Diff_U[5][SU2_FLUX_BATCH],
+  R[SU2_FLUX_BATCH], RoeDensity[SU2_FLUX_BATCH], RoeVelocity[3][SU2_FLUX_BATCH], RoeEnthalpy[SU2_FLUX_BATCH],
+  RoeSoundSpeed[SU2_FLUX_BATCH], sq_vel[SU2_FLUX_BATCH], ProjVelocity[SU2_FLUX_BATCH], MaxLambda[SU2_FLUX_BATCH],
+  Lambda[5][SU2_FLUX_BATCH], ProjFlux_i[5][SU2_FLUX_BATCH], ProjFlux_j[5][SU2_FLUX_BATCH],
+  P_Tensor[5][5][SU2_FLUX_BATCH], invP_Tensor[5][5][SU2_FLUX_BATCH], Proj_ModJac_Tensor_ij[SU2_FLUX_BATCH], RoeSoundSpeed2;
+  bool Valid[SU2_FLUX_BATCH];
+  
+  Delta = config->GetEntropyFix_Coeff();
+  
+  /*--- Same operations as ComputeResidual, each loop runs over the lanes
+   (edges) of the batch so that it can be vectorized. ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) Area[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      Area[iLane] += Normal[iDim][iLane]*Normal[iDim][iLane];
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) Area[iLane] = sqrt(Area[iLane]);
+  
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      UnitNormal[iDim][iLane] = Normal[iDim][iLane]/Area[iLane];
+  
+  /*--- Primitive and conservative variables at points i and j ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    Density_i[iLane] = V_i[nDim+2][iLane];  Density_j[iLane] = V_j[nDim+2][iLane];
+    Energy_i[iLane] = V_i[nDim+3][iLane] - V_i[nDim+1][iLane]/Density_i[iLane];
+    Energy_j[iLane] = V_j[nDim+3][iLane] - V_j[nDim+1][iLane]/Density_j[iLane];
+    U_i[0][iLane] = Density_i[iLane]; U_j[0][iLane] = Density_j[iLane];
+    U_i[nDim+1][iLane] = Density_i[iLane]*Energy_i[iLane]; U_j[nDim+1][iLane] = Density_j[iLane]*Energy_j[iLane];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      U_i[iDim+1][iLane] = Density_i[iLane]*V_i[iDim+1][iLane];
+      U_j[iDim+1][iLane] = Density_j[iLane]*V_j[iDim+1][iLane];
+    }
+  
+  /*--- Roe-averaged variables at interface between i & j ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    R[iLane] = sqrt(fabs(Density_j[iLane]/Density_i[iLane]));
+    RoeDensity[iLane] = R[iLane]*Density_i[iLane];
+    sq_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      RoeVelocity[iDim][iLane] = (R[iLane]*V_j[iDim+1][iLane]+V_i[iDim+1][iLane])/(R[iLane]+1);
+      sq_vel[iLane] += RoeVelocity[iDim][iLane]*RoeVelocity[iDim][iLane];
+    }
+  
+  /*--- A negative RoeSoundSpeed2 only disables its own lane (zero flux and
+   Jacobians), a dummy speed of sound keeps the other operations finite ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    RoeEnthalpy[iLane] = (R[iLane]*V_j[nDim+3][iLane]+V_i[nDim+3][iLane])/(R[iLane]+1);
+    RoeSoundSpeed2 = (Gamma-1)*(RoeEnthalpy[iLane]-0.5*sq_vel[iLane]);
+    Valid[iLane] = (RoeSoundSpeed2 > 0.0);
+    RoeSoundSpeed[iLane] = sqrt(Valid[iLane]? RoeSoundSpeed2 : 1.0);
+  }
+  
+  /*--- Compute ProjFlux_i and ProjFlux_j ---*/
+  
+  GetInviscidProjFlux_Batch(Density_i, &V_i[1], V_i[nDim+1], V_i[nDim+3], Normal, ProjFlux_i);
+  GetInviscidProjFlux_Batch(Density_j, &V_j[1], V_j[nDim+1], V_j[nDim+3], Normal, ProjFlux_j);
+  
+  /*--- Compute P and Lambda (do it with the Normal) ---*/
+  
+  GetPMatrix_Batch(RoeDensity, RoeVelocity, RoeSoundSpeed, UnitNormal, P_Tensor);
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) ProjVelocity[iLane] = 0.0;
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      ProjVelocity[iLane] += RoeVelocity[iDim][iLane]*UnitNormal[iDim][iLane];
+  
+  /*--- Flow eigenvalues with Mavriplis' entropy correction ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    for (iDim = 0; iDim < nDim; iDim++)
+      Lambda[iDim][iLane] = ProjVelocity[iLane];
+    Lambda[nVar-2][iLane] = ProjVelocity[iLane] + RoeSoundSpeed[iLane];
+    Lambda[nVar-1][iLane] = ProjVelocity[iLane] - RoeSoundSpeed[iLane];
+    MaxLambda[iLane] = fabs(ProjVelocity[iLane]) + RoeSoundSpeed[iLane];
+  }
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      Lambda[iVar][iLane] = max(fabs(Lambda[iVar][iLane]), Delta*MaxLambda[iLane]);
+  
+  /*--- Compute inverse P ---*/
+  
+  GetPMatrix_inv_Batch(RoeDensity, RoeVelocity, RoeSoundSpeed, UnitNormal, invP_Tensor);
+  
+  /*--- Jacobians of the inviscid flux, scaled by
+   kappa because val_resconv ~ kappa*(fc_i+fc_j)*Normal ---*/
+  
+  if (implicit) {
+    GetInviscidProjJac_Batch(&V_i[1], Energy_i, Normal, kappa, Jacobian_i);
+    GetInviscidProjJac_Batch(&V_j[1], Energy_j, Normal, kappa, Jacobian_j);
+  }
+  
+  /*--- Diference variables iPoint and jPoint ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      Diff_U[iVar][iLane] = U_j[iVar][iLane]-U_i[iVar][iLane];
+  
+  /*--- Roe's Flux approximation ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      Residual[iVar][iLane] = kappa*(ProjFlux_i[iVar][iLane]+ProjFlux_j[iVar][iLane]);
+    
+    for (jVar = 0; jVar < nVar; jVar++) {
+      
+      /*--- Compute |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
+      
+      for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) Proj_ModJac_Tensor_ij[iLane] = 0.0;
+      for (kVar = 0; kVar < nVar; kVar++)
+        for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+          Proj_ModJac_Tensor_ij[iLane] += P_Tensor[iVar][kVar][iLane]*Lambda[kVar][iLane]*invP_Tensor[kVar][jVar][iLane];
+      
+      for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+        Residual[iVar][iLane] -= (1.0-kappa)*Proj_ModJac_Tensor_ij[iLane]*Diff_U[jVar][iLane]*Area[iLane];
+      
+      if (implicit) {
+        for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+          Jacobian_i[iVar][jVar][iLane] += (1.0-kappa)*Proj_ModJac_Tensor_ij[iLane]*Area[iLane];
+          Jacobian_j[iVar][jVar][iLane] -= (1.0-kappa)*Proj_ModJac_Tensor_ij[iLane]*Area[iLane];
+        }
+      }
+    }
+  }
+  
+  /*--- Lanes with a negative RoeSoundSpeed2 do not contribute ---*/
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    if (Valid[iLane]) continue;
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Residual[iVar][iLane] = 0.0;
+      for (jVar = 0; jVar < nVar; jVar++) {
+        Jacobian_i[iVar][jVar][iLane] = 0.0;
+        Jacobian_j[iVar][jVar][iLane] = 0.0;
+      }
+    }
+  }
+  
+}
+
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -742,6 +742,306 @@ void CNumerics::GetPMatrix_inv(su2double *val_density, su2double *val_velocity,
   }
 }
 
+void CFluxBatch::SetPadding(void) {
+  
+  unsigned short iLane, iVar, jVar;
+  
+  for (iLane = nEdge; iLane < SU2_FLUX_BATCH; iLane++) {
+    for (iVar = 0; iVar < 3; iVar++)
+      Normal[iVar][iLane] = Normal[iVar][0];
+    for (iVar = 0; iVar < 8; iVar++) {
+      V_i[iVar][iLane] = V_i[iVar][0];
+      V_j[iVar][iLane] = V_j[iVar][0];
+    }
+    Lambda_i[iLane] = Lambda_i[0];     Lambda_j[iLane] = Lambda_j[0];
+    Sensor_i[iLane] = Sensor_i[0];     Sensor_j[iLane] = Sensor_j[0];
+    Neighbor_i[iLane] = Neighbor_i[0]; Neighbor_j[iLane] = Neighbor_j[0];
+    for (iVar = 0; iVar < 5; iVar++) {
+      Und_Lapl_i[iVar][iLane] = Und_Lapl_i[iVar][0];
+      Und_Lapl_j[iVar][iLane] = Und_Lapl_j[iVar][0];
+    }
+  }
+  
+  /*--- The lanes that are not in use are never added to the residual,
+   the Jacobians are only cleared so that they hold defined values. ---*/
+  
+  for (iVar = 0; iVar < 5; iVar++)
+    for (jVar = 0; jVar < 5; jVar++)
+      for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+        Jacobian_i[iVar][jVar][iLane] = 0.0;
+        Jacobian_j[iVar][jVar][iLane] = 0.0;
+      }
+  
+}
+
+void CNumerics::SetBatch_Lane(CFluxBatch *batch, unsigned short val_lane) {
+  
+  unsigned short iVar, iDim;
+  
+  /*--- Temperature, velocity, pressure, density, enthalpy and sound speed ---*/
+  
+  for (iVar = 0; iVar < nDim+5; iVar++) {
+    batch->V_i[iVar][val_lane] = V_i[iVar];
+    batch->V_j[iVar][val_lane] = V_j[iVar];
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    batch->Normal[iDim][val_lane] = Normal[iDim];
+  
+}
+
+void CNumerics::GetInviscidProjFlux_Batch(su2double *val_density, su2double (*val_velocity)[SU2_FLUX_BATCH],
+                                          su2double *val_pressure, su2double *val_enthalpy,
+                                          su2double (*val_normal)[SU2_FLUX_BATCH], su2double (*val_Proj_Flux)[SU2_FLUX_BATCH]) {
+  
+  unsigned short iLane, iDim, jDim, iVar;
+  su2double rhou[SU2_FLUX_BATCH];
+  
+  /*--- Same operations as GetInviscidProjFlux, each loop runs over the lanes ---*/
+  
+  for (iVar = 0; iVar < nDim+2; iVar++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      val_Proj_Flux[iVar][iLane] = 0.0;
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      rhou[iLane] = val_density[iLane]*val_velocity[iDim][iLane];
+      val_Proj_Flux[0][iLane] += rhou[iLane]*val_normal[iDim][iLane];
+    }
+    
+    for (jDim = 0; jDim < nDim; jDim++) {
+      if (jDim == iDim) {
+        for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+          val_Proj_Flux[jDim+1][iLane] += (rhou[iLane]*val_velocity[jDim][iLane]+val_pressure[iLane])*val_normal[iDim][iLane];
+      }
+      else {
+        for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+          val_Proj_Flux[jDim+1][iLane] += rhou[iLane]*val_velocity[jDim][iLane]*val_normal[iDim][iLane];
+      }
+    }
+    
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      val_Proj_Flux[nDim+1][iLane] += rhou[iLane]*val_enthalpy[iLane]*val_normal[iDim][iLane];
+    
+  }
+  
+}
+
+void CNumerics::GetInviscidProjJac_Batch(su2double (*val_velocity)[SU2_FLUX_BATCH], su2double *val_energy,
+                                         su2double (*val_normal)[SU2_FLUX_BATCH], su2double val_scale,
+                                         su2double (*val_Proj_Jac_Tensor)[5][SU2_FLUX_BATCH]) {
+  
+  unsigned short iLane, iDim, jDim;
+  su2double sqvel[SU2_FLUX_BATCH], proj_vel[SU2_FLUX_BATCH], phi[SU2_FLUX_BATCH], a1[SU2_FLUX_BATCH], a2 = Gamma-1.0;
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    sqvel[iLane] = 0.0; proj_vel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      sqvel[iLane]    += val_velocity[iDim][iLane]*val_velocity[iDim][iLane];
+      proj_vel[iLane] += val_velocity[iDim][iLane]*val_normal[iDim][iLane];
+    }
+  
+  for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+    phi[iLane] = 0.5*Gamma_Minus_One*sqvel[iLane];
+    a1[iLane] = Gamma*val_energy[iLane]-phi[iLane];
+    val_Proj_Jac_Tensor[0][0][iLane] = 0.0;
+    val_Proj_Jac_Tensor[0][nDim+1][iLane] = 0.0;
+    val_Proj_Jac_Tensor[nDim+1][0][iLane] = val_scale*proj_vel[iLane]*(phi[iLane]-a1[iLane]);
+    val_Proj_Jac_Tensor[nDim+1][nDim+1][iLane] = val_scale*Gamma*proj_vel[iLane];
+  }
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      val_Proj_Jac_Tensor[0][iDim+1][iLane] = val_scale*val_normal[iDim][iLane];
+      val_Proj_Jac_Tensor[iDim+1][0][iLane] = val_scale*(val_normal[iDim][iLane]*phi[iLane] - val_velocity[iDim][iLane]*proj_vel[iLane]);
+      val_Proj_Jac_Tensor[iDim+1][nDim+1][iLane] = val_scale*a2*val_normal[iDim][iLane];
+      val_Proj_Jac_Tensor[nDim+1][iDim+1][iLane] = val_scale*(val_normal[iDim][iLane]*a1[iLane]-a2*val_velocity[iDim][iLane]*proj_vel[iLane]);
+    }
+    for (jDim = 0; jDim < nDim; jDim++)
+      for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+        val_Proj_Jac_Tensor[iDim+1][jDim+1][iLane] = val_scale*(val_normal[jDim][iLane]*val_velocity[iDim][iLane]-a2*val_normal[iDim][iLane]*val_velocity[jDim][iLane]);
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++)
+      val_Proj_Jac_Tensor[iDim+1][iDim+1][iLane] += val_scale*proj_vel[iLane];
+  }
+  
+}
+
+void CNumerics::GetPMatrix_Batch(su2double *val_density, su2double (*val_velocity)[SU2_FLUX_BATCH],
+                                 su2double *val_soundspeed, su2double (*val_normal)[SU2_FLUX_BATCH],
+                                 su2double (*val_p_tensor)[5][SU2_FLUX_BATCH]) {
+  
+  unsigned short iLane;
+  su2double rho, c, sqvel, rhooc, rhoxc;
+  
+  /*--- Same expressions as GetPMatrix, evaluated for all the lanes ---*/
+  
+  if (nDim == 2) {
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      
+      rho = val_density[iLane]; c = val_soundspeed[iLane];
+      rhooc = rho / c;
+      rhoxc = rho * c;
+      
+      sqvel = val_velocity[0][iLane]*val_velocity[0][iLane]+val_velocity[1][iLane]*val_velocity[1][iLane];
+
+      val_p_tensor[0][0][iLane] = 1.0;
+      val_p_tensor[0][1][iLane]=0.0;
+      val_p_tensor[0][2][iLane]=0.5*rhooc;
+      val_p_tensor[0][3][iLane]=0.5*rhooc;
+
+      val_p_tensor[1][0][iLane]=val_velocity[0][iLane];
+      val_p_tensor[1][1][iLane]=rho*val_normal[1][iLane];
+      val_p_tensor[1][2][iLane]=0.5*(val_velocity[0][iLane]*rhooc+val_normal[0][iLane]*rho);
+      val_p_tensor[1][3][iLane]=0.5*(val_velocity[0][iLane]*rhooc-val_normal[0][iLane]*rho);
+
+      val_p_tensor[2][0][iLane]=val_velocity[1][iLane];
+      val_p_tensor[2][1][iLane]=-rho*val_normal[0][iLane];
+      val_p_tensor[2][2][iLane]=0.5*(val_velocity[1][iLane]*rhooc+val_normal[1][iLane]*rho);
+      val_p_tensor[2][3][iLane]=0.5*(val_velocity[1][iLane]*rhooc-val_normal[1][iLane]*rho);
+
+      val_p_tensor[3][0][iLane]=0.5*sqvel;
+      val_p_tensor[3][1][iLane]=rho*val_velocity[0][iLane]*val_normal[1][iLane]-rho*val_velocity[1][iLane]*val_normal[0][iLane];
+      val_p_tensor[3][2][iLane]=0.5*(0.5*sqvel*rhooc+rho*val_velocity[0][iLane]*val_normal[0][iLane]+rho*val_velocity[1][iLane]*val_normal[1][iLane]+rhoxc/Gamma_Minus_One);
+      val_p_tensor[3][3][iLane]=0.5*(0.5*sqvel*rhooc-rho*val_velocity[0][iLane]*val_normal[0][iLane]-rho*val_velocity[1][iLane]*val_normal[1][iLane]+rhoxc/Gamma_Minus_One);
+      
+    }
+  }
+  else {
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      
+      rho = val_density[iLane]; c = val_soundspeed[iLane];
+      rhooc = rho / c;
+      rhoxc = rho * c;
+      
+      sqvel = val_velocity[0][iLane]*val_velocity[0][iLane]+val_velocity[1][iLane]*val_velocity[1][iLane]+val_velocity[2][iLane]*val_velocity[2][iLane];
+
+      val_p_tensor[0][0][iLane]=val_normal[0][iLane];
+      val_p_tensor[0][1][iLane]=val_normal[1][iLane];
+      val_p_tensor[0][2][iLane]=val_normal[2][iLane];
+      val_p_tensor[0][3][iLane]=0.5*rhooc;
+      val_p_tensor[0][4][iLane]=0.5*rhooc;
+
+      val_p_tensor[1][0][iLane]=val_velocity[0][iLane]*val_normal[0][iLane];
+      val_p_tensor[1][1][iLane]=val_velocity[0][iLane]*val_normal[1][iLane]-rho*val_normal[2][iLane];
+      val_p_tensor[1][2][iLane]=val_velocity[0][iLane]*val_normal[2][iLane]+rho*val_normal[1][iLane];
+      val_p_tensor[1][3][iLane]=0.5*(val_velocity[0][iLane]*rhooc+rho*val_normal[0][iLane]);
+      val_p_tensor[1][4][iLane]=0.5*(val_velocity[0][iLane]*rhooc-rho*val_normal[0][iLane]);
+
+      val_p_tensor[2][0][iLane]=val_velocity[1][iLane]*val_normal[0][iLane]+rho*val_normal[2][iLane];
+      val_p_tensor[2][1][iLane]=val_velocity[1][iLane]*val_normal[1][iLane];
+      val_p_tensor[2][2][iLane]=val_velocity[1][iLane]*val_normal[2][iLane]-rho*val_normal[0][iLane];
+      val_p_tensor[2][3][iLane]=0.5*(val_velocity[1][iLane]*rhooc+rho*val_normal[1][iLane]);
+      val_p_tensor[2][4][iLane]=0.5*(val_velocity[1][iLane]*rhooc-rho*val_normal[1][iLane]);
+
+      val_p_tensor[3][0][iLane]=val_velocity[2][iLane]*val_normal[0][iLane]-rho*val_normal[1][iLane];
+      val_p_tensor[3][1][iLane]=val_velocity[2][iLane]*val_normal[1][iLane]+rho*val_normal[0][iLane];
+      val_p_tensor[3][2][iLane]=val_velocity[2][iLane]*val_normal[2][iLane];
+      val_p_tensor[3][3][iLane]=0.5*(val_velocity[2][iLane]*rhooc+rho*val_normal[2][iLane]);
+      val_p_tensor[3][4][iLane]=0.5*(val_velocity[2][iLane]*rhooc-rho*val_normal[2][iLane]);
+
+      val_p_tensor[4][0][iLane]=0.5*sqvel*val_normal[0][iLane]+rho*val_velocity[1][iLane]*val_normal[2][iLane]-rho*val_velocity[2][iLane]*val_normal[1][iLane];
+      val_p_tensor[4][1][iLane]=0.5*sqvel*val_normal[1][iLane]-rho*val_velocity[0][iLane]*val_normal[2][iLane]+rho*val_velocity[2][iLane]*val_normal[0][iLane];
+      val_p_tensor[4][2][iLane]=0.5*sqvel*val_normal[2][iLane]+rho*val_velocity[0][iLane]*val_normal[1][iLane]-rho*val_velocity[1][iLane]*val_normal[0][iLane];
+      val_p_tensor[4][3][iLane]=0.5*(0.5*sqvel*rhooc+rho*(val_velocity[0][iLane]*val_normal[0][iLane]+val_velocity[1][iLane]*val_normal[1][iLane]+val_velocity[2][iLane]*val_normal[2][iLane])+rhoxc/Gamma_Minus_One);
+      val_p_tensor[4][4][iLane]=0.5*(0.5*sqvel*rhooc-rho*(val_velocity[0][iLane]*val_normal[0][iLane]+val_velocity[1][iLane]*val_normal[1][iLane]+val_velocity[2][iLane]*val_normal[2][iLane])+rhoxc/Gamma_Minus_One);
+      
+    }
+  }
+  
+}
+
+void CNumerics::GetPMatrix_inv_Batch(su2double *val_density, su2double (*val_velocity)[SU2_FLUX_BATCH],
+                                     su2double *val_soundspeed, su2double (*val_normal)[SU2_FLUX_BATCH],
+                                     su2double (*val_invp_tensor)[5][SU2_FLUX_BATCH]) {
+  
+  unsigned short iLane;
+  su2double rho, c, rhoxc, c2, gm1, k0orho, k1orho, gm1_o_c2, gm1_o_rhoxc, sqvel;
+  
+  /*--- Same expressions as GetPMatrix_inv, evaluated for all the lanes ---*/
+  
+  gm1 = Gamma_Minus_One;
+  
+  if (nDim == 3) {
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      
+      rho = val_density[iLane]; c = val_soundspeed[iLane];
+      rhoxc = rho * c;
+      c2 = c * c;
+      
+      sqvel = val_velocity[0][iLane]*val_velocity[0][iLane]+val_velocity[1][iLane]*val_velocity[1][iLane]+val_velocity[2][iLane]*val_velocity[2][iLane];
+
+      val_invp_tensor[0][0][iLane]=val_normal[0][iLane]-val_normal[2][iLane]*val_velocity[1][iLane] / rho+val_normal[1][iLane]*val_velocity[2][iLane] / rho-val_normal[0][iLane]*0.5*gm1*sqvel/c2;
+      val_invp_tensor[0][1][iLane]=val_normal[0][iLane]*gm1*val_velocity[0][iLane]/c2;
+      val_invp_tensor[0][2][iLane]=val_normal[2][iLane] / rho+val_normal[0][iLane]*gm1*val_velocity[1][iLane]/c2;
+      val_invp_tensor[0][3][iLane]=-val_normal[1][iLane] / rho+val_normal[0][iLane]*gm1*val_velocity[2][iLane]/c2;
+      val_invp_tensor[0][4][iLane]=-val_normal[0][iLane]*gm1/c2;
+
+      val_invp_tensor[1][0][iLane]=val_normal[1][iLane]+val_normal[2][iLane]*val_velocity[0][iLane] / rho-val_normal[0][iLane]*val_velocity[2][iLane] / rho-val_normal[1][iLane]*0.5*gm1*sqvel/c2;
+      val_invp_tensor[1][1][iLane]=-val_normal[2][iLane] / rho+val_normal[1][iLane]*gm1*val_velocity[0][iLane]/c2;
+      val_invp_tensor[1][2][iLane]=val_normal[1][iLane]*gm1*val_velocity[1][iLane]/c2;
+      val_invp_tensor[1][3][iLane]=val_normal[0][iLane] / rho+val_normal[1][iLane]*gm1*val_velocity[2][iLane]/c2;
+      val_invp_tensor[1][4][iLane]=-val_normal[1][iLane]*gm1/c2;
+
+      val_invp_tensor[2][0][iLane]=val_normal[2][iLane]-val_normal[1][iLane]*val_velocity[0][iLane] / rho+val_normal[0][iLane]*val_velocity[1][iLane] / rho-val_normal[2][iLane]*0.5*gm1*sqvel/c2;
+      val_invp_tensor[2][1][iLane]=val_normal[1][iLane] / rho+val_normal[2][iLane]*gm1*val_velocity[0][iLane]/c2;
+      val_invp_tensor[2][2][iLane]=-val_normal[0][iLane] / rho+val_normal[2][iLane]*gm1*val_velocity[1][iLane]/c2;
+      val_invp_tensor[2][3][iLane]=val_normal[2][iLane]*gm1*val_velocity[2][iLane]/c2;
+      val_invp_tensor[2][4][iLane]=-val_normal[2][iLane]*gm1/c2;
+
+      val_invp_tensor[3][0][iLane]=-(val_normal[0][iLane]*val_velocity[0][iLane]+val_normal[1][iLane]*val_velocity[1][iLane]+val_normal[2][iLane]*val_velocity[2][iLane]) / rho+0.5*gm1*sqvel/rhoxc;
+      val_invp_tensor[3][1][iLane]=val_normal[0][iLane] / rho-gm1*val_velocity[0][iLane]/rhoxc;
+      val_invp_tensor[3][2][iLane]=val_normal[1][iLane] / rho-gm1*val_velocity[1][iLane]/rhoxc;
+      val_invp_tensor[3][3][iLane]=val_normal[2][iLane] / rho-gm1*val_velocity[2][iLane]/rhoxc;
+      val_invp_tensor[3][4][iLane]=Gamma_Minus_One/rhoxc;
+
+      val_invp_tensor[4][0][iLane]=(val_normal[0][iLane]*val_velocity[0][iLane]+val_normal[1][iLane]*val_velocity[1][iLane]+val_normal[2][iLane]*val_velocity[2][iLane]) / rho+0.5*gm1*sqvel/rhoxc;
+      val_invp_tensor[4][1][iLane]=-val_normal[0][iLane] / rho-gm1*val_velocity[0][iLane]/rhoxc;
+      val_invp_tensor[4][2][iLane]=-val_normal[1][iLane] / rho-gm1*val_velocity[1][iLane]/rhoxc;
+      val_invp_tensor[4][3][iLane]=-val_normal[2][iLane] / rho-gm1*val_velocity[2][iLane]/rhoxc;
+      val_invp_tensor[4][4][iLane]=Gamma_Minus_One/rhoxc;
+      
+    }
+  }
+  else {
+    for (iLane = 0; iLane < SU2_FLUX_BATCH; iLane++) {
+      
+      rho = val_density[iLane]; c = val_soundspeed[iLane];
+      rhoxc = rho * c;
+      c2 = c * c;
+      k0orho = val_normal[0][iLane] / rho;
+      k1orho = val_normal[1][iLane] / rho;
+      gm1_o_c2 = gm1/c2;
+      gm1_o_rhoxc = gm1/rhoxc;
+      
+      sqvel = val_velocity[0][iLane]*val_velocity[0][iLane]+val_velocity[1][iLane]*val_velocity[1][iLane];
+
+      val_invp_tensor[0][0][iLane] = 1.0-0.5*gm1_o_c2*sqvel;
+      val_invp_tensor[0][1][iLane]=gm1_o_c2*val_velocity[0][iLane];
+      val_invp_tensor[0][2][iLane]=gm1_o_c2*val_velocity[1][iLane];
+      val_invp_tensor[0][3][iLane]=-gm1_o_c2;
+
+      val_invp_tensor[1][0][iLane]=-k1orho*val_velocity[0][iLane]+k0orho*val_velocity[1][iLane];
+      val_invp_tensor[1][1][iLane]=k1orho;
+      val_invp_tensor[1][2][iLane]=-k0orho;
+      val_invp_tensor[1][3][iLane]=0.0;
+
+      val_invp_tensor[2][0][iLane]=-k0orho*val_velocity[0][iLane]-k1orho*val_velocity[1][iLane]+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[2][1][iLane]=k0orho-gm1_o_rhoxc*val_velocity[0][iLane];
+      val_invp_tensor[2][2][iLane]=k1orho-gm1_o_rhoxc*val_velocity[1][iLane];
+      val_invp_tensor[2][3][iLane]=gm1_o_rhoxc;
+
+      val_invp_tensor[3][0][iLane]=k0orho*val_velocity[0][iLane]+k1orho*val_velocity[1][iLane]+0.5*gm1_o_rhoxc*sqvel;
+      val_invp_tensor[3][1][iLane]=-k0orho-gm1_o_rhoxc*val_velocity[0][iLane];
+      val_invp_tensor[3][2][iLane]=-k1orho-gm1_o_rhoxc*val_velocity[1][iLane];
+      val_invp_tensor[3][3][iLane]=gm1_o_rhoxc;
+      
+    }
+  }
+  
+}
+
 void CNumerics::GetPMatrix_inv(su2double **val_invp_tensor, su2double *val_density, su2double *val_velocity,
     su2double *val_soundspeed, su2double *val_chi, su2double *val_kappa, su2double *val_normal) {
 
@@ -4281,6 +4281,16 @@ void COutput::DeallocateSolution(CConfig *config, CGeometry *geometry) {
   }
 }
 
+bool COutput::PrecLag_History(CConfig *config) {
+  
+  /*--- Only the direct flow solvers lag their preconditioner ---*/
+  
+  return ((config->GetLinear_Solver_Prec_Lag() > 1) &&
+          ((config->GetKind_Solver() == EULER) || (config->GetKind_Solver() == NAVIER_STOKES) ||
+           (config->GetKind_Solver() == RANS)));
+  
+}
+
 void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, unsigned short val_iZone) {
   char cstr[200], buffer[50], turb_resid[1000], adj_turb_resid[1000];
   unsigned short iMarker_Monitoring;
@@ -4437,6 +4447,11 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, un
   
   char end[]= ",\"Linear_Solver_Iterations\",\"CFL_Number\",\"Time(min)\"\n";
   char endfea[]= ",\"Linear_Solver_Iterations\",\"Time(min)\"\n";
+  char end_prec_lag[]= ",\"Linear_Solver_Iterations\",\"Prec_Rebuild\",\"Prec_Time(s)\",\"CFL_Number\",\"Time(min)\"\n";
+  
+  /*--- The rebuilds of a lagged preconditioner are reported by the direct flow solvers ---*/
+  
+  bool prec_lag = PrecLag_History(config);
   
   if ((config->GetOutput_FileFormat() == TECPLOT) ||
       (config->GetOutput_FileFormat() == TECPLOT_BINARY) ||
@@ -4476,7 +4491,8 @@ void COutput::SetConvHistory_Header(ofstream *ConvHist_file, CConfig *config, un
         if (thermal) ConvHist_file[0] << d_thermal_coeff;
       }
       if (output_comboObj) ConvHist_file[0] << combo_obj;
-      ConvHist_file[0] << end;
+      if (prec_lag) ConvHist_file[0] << end_prec_lag;
+      else ConvHist_file[0] << end;
       
       break;
       
@@ -4659,6 +4675,8 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
     unsigned short iVar, iMarker_Monitoring;
     
     unsigned long LinSolvIter = 0, iPointMaxResid;
+    bool PrecRebuilt = false;
+    su2double PrecBuildTime = 0.0;
     su2double timeiter = timeused/su2double(iExtIter+1);
     
     unsigned short nDim = geometry[val_iZone][FinestMesh]->GetnDim();
@@ -4683,6 +4701,8 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
     (config[val_iZone]->GetKind_Solver() == RANS) || (config[val_iZone]->GetKind_Solver() == ADJ_EULER) ||
     (config[val_iZone]->GetKind_Solver() == ADJ_NAVIER_STOKES) || (config[val_iZone]->GetKind_Solver() == ADJ_RANS);
     
+    bool prec_lag = PrecLag_History(config[val_iZone]);
+    
     bool fem = ((config[val_iZone]->GetKind_Solver() == FEM_ELASTICITY) ||          // FEM structural solver.
                 (config[val_iZone]->GetKind_Solver() == DISC_ADJ_FEM));
     bool linear_analysis = (config[val_iZone]->GetGeometricConditions() == SMALL_DEFORMATIONS);  // Linear analysis.
@@ -5017,6 +5037,8 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         /*--- Iterations of the linear solver ---*/
         
         LinSolvIter = (unsigned long) solver_container[val_iZone][FinestMesh][FLOW_SOL]->GetIterLinSolver();
+        PrecRebuilt = solver_container[val_iZone][FinestMesh][FLOW_SOL]->GetPrec_Rebuilt();
+        PrecBuildTime = solver_container[val_iZone][FinestMesh][FLOW_SOL]->GetPrec_BuildTime();
         
         /*--- Adjoint solver ---*/
         
@@ -5194,7 +5216,10 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
         SPRINTF(begin, "%12d", SU2_TYPE::Int(iExtIter+ExtIter_OffSet));
         
         /*--- Write the end of the history file ---*/
-        SPRINTF (end, ", %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
+        if (prec_lag)
+          SPRINTF (end, ", %12.10f, %d, %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), int(PrecRebuilt), PrecBuildTime, config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
+        else
+          SPRINTF (end, ", %12.10f, %12.10f, %12.10f\n", su2double(LinSolvIter), config[val_iZone]->GetCFL(MESH_0), timeused/60.0);
         
         /*--- Write the solution and residual of the history file ---*/
         switch (config[val_iZone]->GetKind_Solver()) {
@@ -8513,11 +8538,13 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
   unsigned short iZone;
   ofstream output_file;
   string str;
+  bool su2_binary = (config[ZONE_0]->GetMesh_Out_FileFormat() == SU2_BINARY);
 
-  /*--- Read the name of the output and input file ---*/
+  /*--- Read the name of the output and input file, the binary
+   file is opened zone by zone when it is written. ---*/
 
   if (rank == MASTER_NODE) {
-    if (su2_file){
+    if (su2_file && !su2_binary){
       str = config[ZONE_0]->GetMesh_Out_FileName();
       strcpy (out_file, str.c_str());
       strcpy (cstr, out_file);
@@ -8582,7 +8609,10 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
 
       if (rank == MASTER_NODE) cout <<"Writing .su2 file." << endl;
 
-      if (su2_file) SetSU2_MeshASCII(config[iZone], geometry[iZone], iZone, output_file);
+      if (su2_file) {
+        if (su2_binary) SetSU2_MeshBinary(config[iZone], geometry[iZone], iZone);
+        else SetSU2_MeshASCII(config[iZone], geometry[iZone], iZone, output_file);
+      }
       
       /*--- Write an stl surface file ---*/
 
@@ -8621,7 +8651,7 @@ void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned sho
   }
 
   if (rank == MASTER_NODE) {
-    if (su2_file){
+    if (su2_file && !su2_binary){
       output_file.close();
     }
   }
@@ -247,7 +247,180 @@ void COutput::SetSU2_MeshASCII(CConfig *config, CGeometry *geometry, unsigned sh
 
 }
 
-void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry) { }
+void COutput::SetSU2_MeshBinary(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
+  
+  unsigned long iElem, iPoint, iElem_Bound, nElem_Bound_, iNode, nElem, iRecord, Elem_Width;
+  unsigned long Header[SU2_BINARY_MESH_HEADER], Marker_Size = 0, Zone_Size;
+  unsigned short iMarker, iDim, nDim = geometry->GetnDim(), iPeriodic, nPeriodic, nMarker_ = 0;
+  unsigned short iType, nNode_Type[6] = {N_POINTS_TRIANGLE, N_POINTS_QUADRILATERAL, N_POINTS_TETRAHEDRON,
+                                          N_POINTS_HEXAHEDRON, N_POINTS_PRISM, N_POINTS_PYRAMID};
+  unsigned long VTK_Type[6] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  unsigned long nElem_Type[6] = {nGlobal_Tria, nGlobal_Quad, nGlobal_Tetr, nGlobal_Hexa, nGlobal_Pris, nGlobal_Pyra};
+  int *Conn_Type[6] = {Conn_Tria, Conn_Quad, Conn_Tetr, Conn_Hexa, Conn_Pris, Conn_Pyra};
+  long Marker_Info[3];
+  char Marker_Name[MAX_STRING_SIZE];
+  passivedouble Offsets[2], Periodic_Data[9];
+  su2double *center, *angles, *transl;
+  ifstream input_file;
+  string text_line, str;
+  string::size_type position;
+  FILE *fhw;
+  
+  /*--- The markers are read first from the boundary file, the size of the
+   zone must be known before it is written. ---*/
+  
+  vector<string> Marker_Tag;
+  vector<long> Marker_SendTo;
+  vector<unsigned long> Marker_nElem, Marker_Width, Marker_Conn;
+  
+  str = "boundary.dat";
+  str = config->GetMultizone_FileName(str, val_iZone);
+  input_file.open(str.c_str(), ios::in);
+  
+  while (getline (input_file, text_line)) {
+    position = text_line.find ("NMARK=",0);
+    if (position != string::npos) {
+      text_line.erase (0,6); nMarker_ = atoi(text_line.c_str());
+      for (iMarker = 0 ; iMarker < nMarker_; iMarker++) {
+        
+        getline (input_file, text_line);
+        text_line.erase (0,11);
+        istringstream tag_line(text_line);
+        tag_line >> str; Marker_Tag.push_back(str);
+        
+        getline (input_file, text_line);
+        text_line.erase (0,13); nElem_Bound_ = atoi(text_line.c_str());
+        getline (input_file, text_line);
+        text_line.erase (0,8); Marker_SendTo.push_back(atoi(text_line.c_str()));
+        
+        /*--- Each record holds the type and the nodes of the element (or the
+         node and the transformation of a SEND_RECEIVE vertex). ---*/
+        
+        Elem_Width = (nDim == 2)? 1+N_POINTS_LINE : 1+N_POINTS_QUADRILATERAL;
+        if (Marker_Tag.back() == "SEND_RECEIVE") Elem_Width = 3;
+        Marker_nElem.push_back(nElem_Bound_);
+        Marker_Width.push_back(Elem_Width);
+        
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound_; iElem_Bound++) {
+          getline(input_file, text_line);
+          istringstream bound_line(text_line);
+          for (iRecord = 0; iRecord < Elem_Width; iRecord++) {
+            unsigned long value = 0;
+            bound_line >> value;
+            Marker_Conn.push_back(value);
+          }
+          
+          /*--- Triangles in 3D are padded with 0, without taking the element index ---*/
+          
+          if (Marker_Conn[Marker_Conn.size()-Elem_Width] == TRIANGLE) Marker_Conn.back() = 0;
+        }
+        Marker_Size += MAX_STRING_SIZE*sizeof(char) + 3*sizeof(long) + nElem_Bound_*Elem_Width*sizeof(unsigned long);
+      }
+    }
+  }
+  
+  input_file.close();
+  str = "boundary.dat";
+  str = config->GetMultizone_FileName(str, val_iZone);
+  remove(str.c_str());
+  
+  /*--- Width of the element records, given by the largest element present ---*/
+  
+  Elem_Width = 1; nElem = 0;
+  for (iType = 0; iType < 6; iType++) {
+    if (nElem_Type[iType] > 0) Elem_Width = max(Elem_Width, (unsigned long)(nNode_Type[iType]+1));
+    nElem += nElem_Type[iType];
+  }
+  
+  nPeriodic = config->GetnPeriodicIndex();
+  
+  Zone_Size = SU2_BINARY_MESH_HEADER*sizeof(unsigned long) + 2*sizeof(passivedouble) +
+              nGlobal_Doma*nDim*sizeof(passivedouble) + nElem*Elem_Width*sizeof(unsigned long) +
+              Marker_Size + nPeriodic*9*sizeof(passivedouble);
+  
+  Header[0] = SU2_BINARY_MESH_ID;
+  Header[1] = config->GetnZone();
+  Header[2] = nDim;
+  Header[3] = nGlobal_Doma;
+  Header[4] = geometry->GetGlobal_nPointDomain();
+  Header[5] = nElem;
+  Header[6] = Elem_Width;
+  Header[7] = nMarker_;
+  Header[8] = nPeriodic;
+  Header[9] = Zone_Size;
+  
+  /*--- Open the file, the zones are appended one after the other. ---*/
+  
+  str = config->GetMesh_Out_FileName();
+  fhw = fopen(str.c_str(), (val_iZone == ZONE_0)? "wb" : "ab");
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open binary SU2 mesh file ") + str, CURRENT_FUNCTION);
+  }
+  
+  fwrite(Header, sizeof(unsigned long), SU2_BINARY_MESH_HEADER, fhw);
+  
+  /*--- Write the angle of attack and sideslip offsets. ---*/
+  
+  Offsets[0] = SU2_TYPE::GetValue(config->GetAoA_Offset());
+  Offsets[1] = SU2_TYPE::GetValue(config->GetAoS_Offset());
+  fwrite(Offsets, sizeof(passivedouble), 2, fhw);
+  
+  /*--- Write the node coordinates ---*/
+  
+  passivedouble *Coord_Buf = new passivedouble[nGlobal_Doma*nDim];
+  for (iPoint = 0; iPoint < nGlobal_Doma; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Coord_Buf[iPoint*nDim+iDim] = SU2_TYPE::GetValue(Coords[iDim][iPoint]);
+  fwrite(Coord_Buf, sizeof(passivedouble), nGlobal_Doma*nDim, fhw);
+  delete [] Coord_Buf;
+  
+  /*--- Write connectivity data, one type of element at a time. ---*/
+  
+  unsigned long *Elem_Buf = new unsigned long[Elem_Width];
+  for (iType = 0; iType < 6; iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      Elem_Buf[0] = VTK_Type[iType];
+      for (iRecord = 1; iRecord < Elem_Width; iRecord++) Elem_Buf[iRecord] = 0;
+      for (iNode = 0; iNode < nNode_Type[iType]; iNode++)
+        Elem_Buf[iNode+1] = Conn_Type[iType][iElem*nNode_Type[iType]+iNode]-1;
+      fwrite(Elem_Buf, sizeof(unsigned long), Elem_Width, fhw);
+    }
+  }
+  delete [] Elem_Buf;
+  
+  /*--- Write the boundary markers ---*/
+  
+  iRecord = 0;
+  for (iMarker = 0; iMarker < nMarker_; iMarker++) {
+    memset(Marker_Name, 0, MAX_STRING_SIZE);
+    strncpy(Marker_Name, Marker_Tag[iMarker].c_str(), MAX_STRING_SIZE-1);
+    Marker_Info[0] = Marker_nElem[iMarker];
+    Marker_Info[1] = Marker_Width[iMarker];
+    Marker_Info[2] = Marker_SendTo[iMarker];
+    fwrite(Marker_Name, sizeof(char), MAX_STRING_SIZE, fhw);
+    fwrite(Marker_Info, sizeof(long), 3, fhw);
+    if (Marker_nElem[iMarker] > 0)
+      fwrite(&Marker_Conn[iRecord], sizeof(unsigned long), Marker_nElem[iMarker]*Marker_Width[iMarker], fhw);
+    iRecord += Marker_nElem[iMarker]*Marker_Width[iMarker];
+  }
+  
+  /*--- Write the periodic transformations ---*/
+  
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    center = config->GetPeriodicCenter(iPeriodic);
+    angles = config->GetPeriodicRotation(iPeriodic);
+    transl = config->GetPeriodicTranslate(iPeriodic);
+    for (iDim = 0; iDim < 3; iDim++) {
+      Periodic_Data[iDim]   = SU2_TYPE::GetValue(center[iDim]);
+      Periodic_Data[3+iDim] = SU2_TYPE::GetValue(angles[iDim]);
+      Periodic_Data[6+iDim] = SU2_TYPE::GetValue(transl[iDim]);
+    }
+    fwrite(Periodic_Data, sizeof(passivedouble), 9, fhw);
+  }
+  
+  fclose(fhw);
+  
+}
 
 void COutput::WriteCoordinates_Binary(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
   
@@ -1140,10 +1140,7 @@ void CHeatSolverFVM::Centered_Residual(CGeometry *geometry, CSolver **solver_con
 
         /*--- Implicit part ---*/
 
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-        Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-        Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-        Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
       }
   }
 }
@@ -1232,10 +1229,7 @@ void CHeatSolverFVM::Upwind_Residual(CGeometry *geometry, CSolver **solver_conta
 
         /*--- Implicit part ---*/
 
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-        Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-        Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-        Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
         }
   }
 
@@ -1300,10 +1294,7 @@ void CHeatSolverFVM::Viscous_Residual(CGeometry *geometry, CSolver **solver_cont
     LinSysRes.SubtractBlock(iPoint, Residual);
     LinSysRes.AddBlock(jPoint, Residual);
 
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
   }
 }
 
@@ -114,6 +114,14 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
   AoA_FD_Change = false;
 
   FluidModel   = NULL;
+  FluidModel_Thread = NULL;
+  nThread      = 0;
+  
+  FluxBatch    = NULL;
+  
+  Pending_Primitive_Gradient = false;
+  Pending_Primitive_Limiter = false;
+  Pending_Primitive_Gradient_Limiter = false;
   
   SlidingState     = NULL;
   SlidingStateNodes = NULL;
@@ -296,6 +304,14 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   AoA_FD_Change = false;
 
   FluidModel = NULL;
+  FluidModel_Thread = NULL;
+  nThread = 0;
+  
+  FluxBatch = NULL;
+  
+  Pending_Primitive_Gradient = false;
+  Pending_Primitive_Limiter = false;
+  Pending_Primitive_Gradient_Limiter = false;
   
   /*--- Initialize quantities for the average process for internal flow ---*/
 
@@ -425,6 +441,12 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   Secondary_i = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_i[iVar] = 0.0;
   Secondary_j = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_j[iVar] = 0.0;
   
+  /*--- Batch of edges for the vectorized convective fluxes, the discrete
+   adjoint records the scalar path ---*/
+  
+  if (config->GetFlux_Batch_Flow() && !config->GetDiscrete_Adjoint())
+    FluxBatch = new CFluxBatch();
+  
   /*--- Define some auxiliary vectors related to the undivided lapalacian ---*/
   
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) {
@@ -783,10 +805,14 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     }
   }
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- Initialize the solution to the far-field state everywhere, the fields
+   of all the points are stored contiguously (one block per field). ---*/
 
+  node_storage = new CVariableStorage(nPoint);
+  CVariable::SetStorage(node_storage);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CEulerVariable(Density_Inf, Velocity_Inf, Energy_Inf, nDim, nVar, config);
+  CVariable::SetStorage(NULL);
 
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
@@ -867,6 +893,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
 CEulerSolver::~CEulerSolver(void) {
 
   unsigned short iVar, iMarker, iSpan;
+  int iThread;
 
   unsigned long iVertex;
 
@@ -1092,7 +1119,14 @@ CEulerSolver::~CEulerSolver(void) {
 
   if (Cauchy_Serie != NULL)  delete [] Cauchy_Serie;
   
-  if (FluidModel != NULL) delete FluidModel;
+  if (FluidModel_Thread != NULL) {
+    for (iThread = 0; iThread < nThread; iThread++)
+      delete FluidModel_Thread[iThread];
+    delete [] FluidModel_Thread;
+  }
+  else if (FluidModel != NULL) delete FluidModel;
+  
+  if (FluxBatch != NULL) delete FluxBatch;
 
   if(AverageVelocity !=NULL){
     for (iMarker = 0; iMarker < nMarker; iMarker++) {
@@ -1511,988 +1545,537 @@ void CEulerSolver::InitTurboContainers(CGeometry *geometry, CConfig *config){
 }
 
 void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  unsigned short iVar, iDim, jDim;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer, *Value, *rotMatrix;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the solution that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nVar+iVar] = node[iPoint]->GetSolution(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Do the coordinate transformation ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    Value = &Buffer[iRecv*nVar];
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Value[iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Solution[iDim+1] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        Solution[iDim+1] += rotMatrix[iDim*3+jDim]*Value[jDim+1];
     }
     
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetSolution(iVar, Solution[iVar]);
   }
   
 }
 
 void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  unsigned short iVar, iDim, jDim;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer, *Value, *rotMatrix;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the solution old that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nVar+iVar] = node[iPoint]->GetSolution_Old(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Do the coordinate transformation ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    Value = &Buffer[iRecv*nVar];
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Value[iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Solution[iDim+1] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        Solution[iDim+1] += rotMatrix[iDim*3+jDim]*Value[jDim+1];
     }
     
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetSolution_Old(iVar, Solution[iVar]);
   }
+  
 }
 
 void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Undivided_Laplacian = NULL, *Buffer_Send_Undivided_Laplacian = NULL;
+  unsigned short iVar, iDim, jDim;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer, *Value, *rotMatrix;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the undivided laplacian that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nVar+iVar] = node[iPoint]->GetUndivided_Laplacian(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Do the coordinate transformation ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    Value = &Buffer[iRecv*nVar];
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Undivided_Laplacian = new su2double [nBufferR_Vector];
-      Buffer_Send_Undivided_Laplacian = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Undivided_Laplacian[iVar*nVertexS+iVertex] = node[iPoint]->GetUndivided_Laplacian(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex] = Buffer_Send_Undivided_Laplacian[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Undivided_Laplacian;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetUndivided_Laplacian(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Undivided_Laplacian;
-      
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Value[iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Solution[iDim+1] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        Solution[iDim+1] += rotMatrix[iDim*3+jDim]*Value[jDim+1];
     }
     
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetUndivided_Laplacian(iVar, Solution[iVar]);
   }
   
 }
 
 void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR, *Buffer_Receive_Neighbor = NULL, *Buffer_Send_Neighbor = NULL;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, 2);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      Buffer_Receive_Neighbor = new unsigned short [nBufferR_Vector];
-      Buffer_Send_Neighbor = new unsigned short[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetLambda();
-        Buffer_Send_Neighbor[iVertex] = geometry->node[iPoint]->GetnPoint();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_Neighbor, nBufferS_Vector, MPI_UNSIGNED_SHORT, send_to, 1,
-                        Buffer_Receive_Neighbor, nBufferR_Vector, MPI_UNSIGNED_SHORT, receive_from, 1, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-        Buffer_Receive_Neighbor[iVertex] = Buffer_Send_Neighbor[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      delete [] Buffer_Send_Neighbor;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetLambda(Buffer_Receive_Lambda[iVertex]);
-        geometry->node[iPoint]->SetnNeighbor(Buffer_Receive_Neighbor[iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Lambda;
-      delete [] Buffer_Receive_Neighbor;
-      
-    }
-    
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the eigenvalue and the number of neighbors that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    Buffer[iSend*2]   = node[iPoint]->GetLambda();
+    Buffer[iSend*2+1] = geometry->node[iPoint]->GetnPoint();
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    node[iPoint]->SetLambda(Buffer[iRecv*2]);
+    geometry->node[iPoint]->SetnNeighbor((unsigned short)SU2_TYPE::GetValue(Buffer[iRecv*2+1]));
   }
+  
 }
 
 void CEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, 1);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetSensor();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetSensor(Buffer_Receive_Lambda[iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Lambda;
-      
-    }
-    
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the sensor that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    Buffer[iSend] = node[iPoint]->GetSensor();
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    node[iPoint]->SetSensor(Buffer[iRecv]);
   }
+  
 }
 
 void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
+  unsigned short iVar, iDim, jDim;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer, *Value, *rotMatrix, Gradient;
   
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar*nDim);
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar*nDim;        nBufferR_Vector = nVertexR*nVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
+  /*--- Copy the gradient that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Buffer[(iSend*nVar+iVar)*nDim+iDim] = node[iPoint]->GetGradient(iVar, iDim);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Need to rotate the gradients for all conserved variables. ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Value = &Buffer[(iRecv*nVar+iVar)*nDim];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Gradient = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          Gradient += rotMatrix[iDim*3+jDim]*Value[jDim];
+        node[iPoint]->SetGradient(iVar, iDim, Gradient);
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
     }
-    
   }
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
 }
 
 void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
+  unsigned short iVar, iDim, jDim;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer, *Value, *rotMatrix, *Limiter;
   
-  su2double *Limiter = new su2double [nVar];
+  Scratch->Push();
+  Limiter = Scratch->GetVector(nVar);
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the limiter that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nVar+iVar] = node[iPoint]->GetLimiter(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Do the coordinate transformation ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    Value = &Buffer[iRecv*nVar];
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-        }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Limiter[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
+    /*--- Copy conserved variables before performing transformation. ---*/
+    for (iVar = 0; iVar < nVar; iVar++)
+      Limiter[iVar] = Value[iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Limiter[iDim+1] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        Limiter[iDim+1] += rotMatrix[iDim*3+jDim]*Value[jDim+1];
     }
     
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetLimiter(iVar, Limiter[iVar]);
   }
   
-  delete [] Limiter;
+  Scratch->Pop();
   
 }
 
 void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
+  unsigned short iVar, iDim;
+  unsigned long iSend, iPoint, nSend;
+  su2double *Buffer;
   
-  su2double **Gradient = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    Gradient[iVar] = new su2double[nDim];
+  /*--- The send buffer is reused, an exchange still in flight is completed first ---*/
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  if (Pending_Primitive_Gradient) Complete_MPI_Primitive_Gradient(geometry, config);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad*nDim;        nBufferR_Vector = nVertexR*nPrimVarGrad*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient[iVar][iDim]);
-        
+  CHaloExchange *Halo = GetHalo(geometry, config, nPrimVarGrad*nDim);
+  
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the gradient that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Buffer[(iSend*nPrimVarGrad+iVar)*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once, with the
+   overlap the residual completes the exchange (see Complete_MPI_Pending) ---*/
+  
+  Halo->Start();
+  
+  if (Halo_Overlap) { Pending_Primitive_Gradient = true; return; }
+  
+  Complete_MPI_Primitive_Gradient(geometry, config);
+  
+}
+
+void CEulerSolver::Complete_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, jDim;
+  unsigned long iRecv, iPoint, nRecv;
+  su2double *Buffer, *Value, *rotMatrix, Gradient;
+  
+  CHaloExchange *Halo = GetHalo(geometry, config, nPrimVarGrad*nDim);
+  
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  Halo->Complete();
+  Pending_Primitive_Gradient = false;
+  
+  /*--- Need to rotate the gradients for all primitive variables. ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      Value = &Buffer[(iRecv*nPrimVarGrad+iVar)*nDim];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Gradient = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          Gradient += rotMatrix[iDim*3+jDim]*Value[jDim];
+        node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient);
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
     }
-    
   }
   
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
 }
 
 void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
+  unsigned short iVar;
+  unsigned long iSend, iPoint, nSend;
+  su2double *Buffer;
   
-  su2double *Limiter = new su2double [nPrimVarGrad];
+  /*--- The send buffer is reused, an exchange still in flight is completed first ---*/
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  if (Pending_Primitive_Limiter) Complete_MPI_Primitive_Limiter(geometry, config);
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  CHaloExchange *Halo = GetHalo(geometry, config, nPrimVarGrad);
+  
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the limiter that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Buffer[iSend*nPrimVarGrad+iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  
+  if (Halo_Overlap) { Pending_Primitive_Limiter = true; return; }
+  
+  Complete_MPI_Primitive_Limiter(geometry, config);
+  
+}
+
+void CEulerSolver::Complete_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, jDim;
+  unsigned long iRecv, iPoint, nRecv;
+  su2double *Buffer, *Value, *rotMatrix, *Limiter;
+  
+  Scratch->Push();
+  Limiter = Scratch->GetVector(nPrimVarGrad);
+  
+  CHaloExchange *Halo = GetHalo(geometry, config, nPrimVarGrad);
+  
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  Halo->Complete();
+  Pending_Primitive_Limiter = false;
+  
+  /*--- Do the coordinate transformation ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    Value = &Buffer[iRecv*nPrimVarGrad];
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad;        nBufferR_Vector = nVertexR*nPrimVarGrad;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter_Primitive(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-        }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          node[iPoint]->SetLimiter_Primitive(iVar, Limiter[iVar]);
-        
+    /*--- Copy the limiters before performing transformation. ---*/
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      Limiter[iVar] = Value[iVar];
+    
+    /*--- Rotate the momentum components. ---*/
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Limiter[iDim+1] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        Limiter[iDim+1] += rotMatrix[iDim*3+jDim]*Value[jDim+1];
+    }
+    
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      node[iPoint]->SetLimiter_Primitive(iVar, Limiter[iVar]);
+  }
+  
+  Scratch->Pop();
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, nCount = nPrimVarGrad*(nDim+1);
+  unsigned long iSend, iPoint, nSend;
+  su2double *Buffer;
+  
+  /*--- The send buffer is reused, an exchange still in flight is completed first ---*/
+  
+  if (Pending_Primitive_Gradient_Limiter) Complete_MPI_Primitive_Gradient_Limiter(geometry, config);
+  
+  CHaloExchange *Halo = GetHalo(geometry, config, nCount);
+  
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the gradients and limiters that should be sended, the gradients
+   of a point followed by its limiters ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        Buffer[iSend*nCount+iVar*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+      Buffer[iSend*nCount+nPrimVarGrad*nDim+iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+    }
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  
+  if (Halo_Overlap) { Pending_Primitive_Gradient_Limiter = true; return; }
+  
+  Complete_MPI_Primitive_Gradient_Limiter(geometry, config);
+  
+}
+
+void CEulerSolver::Complete_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, jDim, nCount = nPrimVarGrad*(nDim+1);
+  unsigned long iRecv, iPoint, nRecv;
+  su2double *Buffer, *Value, *rotMatrix, Gradient, Limiter;
+  
+  CHaloExchange *Halo = GetHalo(geometry, config, nCount);
+  
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  Halo->Complete();
+  Pending_Primitive_Gradient_Limiter = false;
+  
+  /*--- Rotate the gradients, and the momentum components of the limiter. ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      Value = &Buffer[iRecv*nCount+iVar*nDim];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Gradient = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          Gradient += rotMatrix[iDim*3+jDim]*Value[jDim];
+        node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient);
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
     }
     
+    Value = &Buffer[iRecv*nCount+nPrimVarGrad*nDim];
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      Limiter = Value[iVar];
+      if ((iVar >= 1) && (iVar <= nDim)) {
+        Limiter = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          Limiter += rotMatrix[(iVar-1)*3+jDim]*Value[jDim+1];
+      }
+      node[iPoint]->SetLimiter_Primitive(iVar, Limiter);
+    }
   }
   
-  delete [] Limiter;
+}
+
+void CEulerSolver::Complete_MPI_Pending(CGeometry *geometry, CConfig *config) {
+  
+  /*--- The exchanges use different engines, their order does not matter ---*/
+  
+  if (Pending_Primitive_Gradient) Complete_MPI_Primitive_Gradient(geometry, config);
+  if (Pending_Primitive_Limiter) Complete_MPI_Primitive_Limiter(geometry, config);
+  if (Pending_Primitive_Gradient_Limiter) Complete_MPI_Primitive_Gradient_Limiter(geometry, config);
   
 }
 
@@ -3496,6 +3079,7 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
   Total_UnstTimeND = 0.0, Delta_UnstTimeND = 0.0, TgammaR = 0.0;
 
   unsigned short iDim;
+  int iThread;
 
   /*--- Local variables ---*/
   
@@ -3767,36 +3351,44 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
   
   /*--- Initialize the dimensionless Fluid Model that will be used to solve the dimensionless problem ---*/
  
-  /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
+  /*--- Delete the original (dimensional) FluidModel object before replacing.
+   The model keeps the state of its last evaluation, each thread gets its own copy. ---*/
   
   delete FluidModel;
- 
-  switch (config->GetKind_FluidModel()) {
-      
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND);
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-      
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND);
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-      
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-      
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-      
+  
+  nThread = omp_get_max_threads();
+  FluidModel_Thread = new CFluidModel* [nThread];
+  
+  for (iThread = 0; iThread < nThread; iThread++) {
+    
+    switch (config->GetKind_FluidModel()) {
+        
+      case STANDARD_AIR:
+        FluidModel_Thread[iThread] = new CIdealGas(1.4, Gas_ConstantND);
+        break;
+        
+      case IDEAL_GAS:
+        FluidModel_Thread[iThread] = new CIdealGas(Gamma, Gas_ConstantND);
+        break;
+        
+      case VW_GAS:
+        FluidModel_Thread[iThread] = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                         config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        break;
+        
+      case PR_GAS:
+        FluidModel_Thread[iThread] = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                                       config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        break;
+        
+    }
+    
+    FluidModel_Thread[iThread]->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+    
   }
   
+  FluidModel = FluidModel_Thread[0];
+  
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
   
   if (viscous) {
@@ -3813,8 +3405,10 @@ void CEulerSolver::SetNondimensionalization(CGeometry *geometry, CConfig *config
     /* constant thermal conductivity model */
     config->SetKt_ConstantND(config->GetKt_Constant()/Conductivity_Ref);
     
-    FluidModel->SetLaminarViscosityModel(config);
-    FluidModel->SetThermalConductivityModel(config);
+    for (iThread = 0; iThread < nThread; iThread++) {
+      FluidModel_Thread[iThread]->SetLaminarViscosityModel(config);
+      FluidModel_Thread[iThread]->SetThermalConductivityModel(config);
+    }
     
   }
   
@@ -4278,8 +3872,21 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   bool interface        = (config->GetnMarker_InterfaceBound() != 0);
   bool fixed_cl         = config->GetFixed_CL_Mode();
   bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
+  bool fused_limiter    = ((config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) || (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN) ||
+                           (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG)) && !disc_adjoint;
   unsigned short kind_row_dissipation = config->GetKind_RoeLowDiss();
   bool roe_low_dissipation  = (kind_row_dissipation != NO_ROELOWDISS) && (config->GetKind_Upwind_Flow() == ROE);
+  bool upwind           = (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+  
+  /*--- Exchanges left in flight by a previous preprocessing whose residual was not computed ---*/
+  
+  Complete_MPI_Pending(geometry, config);
+  
+  /*--- The exchanges of the gradients and limiters may stay in flight until the
+   upwind residual has computed the interior edges, only if the integration asked
+   for it and nothing reads the received values before ---*/
+  
+  Halo_Overlap = Halo_Overlap && upwind && (iMesh == MESH_0) && !Output && !cont_adjoint && !disc_adjoint && !roe_low_dissipation;
 
   /*--- Update the angle of attack at the far-field for fixed CL calculations. ---*/
   
@@ -4314,22 +3921,33 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   
   if ((muscl && !center) && (iMesh == MESH_0) && !Output) {
     
-    /*--- Gradient computation ---*/
+    /*--- Green-Gauss gradient and limiter computed together in one sweep of the edges ---*/
     
-    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-      SetPrimitive_Gradient_GG(geometry, config);
+    if ((config->GetKind_Gradient_Method() == GREEN_GAUSS) && limiter && fused_limiter) {
+      SetPrimitive_Gradient_GG_Limiter(geometry, config);
     }
-    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-      SetPrimitive_Gradient_LS(geometry, config);
+    else {
+      
+      /*--- Gradient computation ---*/
+      
+      if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+        SetPrimitive_Gradient_GG(geometry, config);
+      }
+      if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+        SetPrimitive_Gradient_LS(geometry, config);
+      }
+      
+      /*--- Limiter computation ---*/
+      
+      if (limiter && (iMesh == MESH_0)
+          && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
+      
     }
     
-    /*--- Limiter computation ---*/
-    
-    if (limiter && (iMesh == MESH_0)
-        && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
-    
   }
   
+  Halo_Overlap = false;
+  
   /*--- Artificial dissipation ---*/
   
   if (center && !Output) {
@@ -4373,6 +3991,11 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
   unsigned long iPoint, ErrorCounter = 0;
   bool RightSol = true;
   
+  /*--- The points are independent, each thread evaluates the fluid model with its own copy ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for private(RightSol) reduction(+:ErrorCounter) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Initialize the non-physical points vector ---*/
@@ -4381,8 +4004,8 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
     
     /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
     
-    RightSol = node[iPoint]->SetPrimVar(FluidModel);
-    node[iPoint]->SetSecondaryVar(FluidModel);
+    RightSol = node[iPoint]->SetPrimVar(FluidModel_Thread[omp_get_thread_num()]);
+    node[iPoint]->SetSecondaryVar(FluidModel_Thread[omp_get_thread_num()]);
 
     if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
     
@@ -4398,8 +4021,9 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
                                 unsigned short iMesh, unsigned long Iteration) {
   
   su2double *Normal, Area, Vol, Mean_SoundSpeed = 0.0, Mean_ProjVel = 0.0, Lambda, Local_Delta_Time,
-  Global_Delta_Time = 1E6, Global_Delta_UnstTimeND, ProjVel, ProjVel_i, ProjVel_j;
-  unsigned long iEdge, iVertex, iPoint, jPoint;
+  Global_Delta_Time = 1E6, Global_Delta_UnstTimeND, ProjVel, ProjVel_i, ProjVel_j,
+  Min_Delta = 1.E6, Max_Delta = 0.0;
+  unsigned long iEdge, iEdge_Loop, iColor, iVertex, iPoint, jPoint;
   unsigned short iDim, iMarker;
   
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -4408,48 +4032,61 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
-  
   /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetMax_Lambda_Inv(0.0);
   
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Point identification, Normal vector and area ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
-    
-    /*--- Mean Values ---*/
-    
-    Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
-    Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
-    
-    /*--- Adjustment for grid movement ---*/
-    
-    if (grid_movement) {
-      su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-      su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+  /*--- Loop interior edges, by colors (the edges of a color share no point) ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Normal, Area, iDim, Mean_ProjVel, Mean_SoundSpeed, ProjVel_i, ProjVel_j, Lambda)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+      
+      /*--- Point identification, Normal vector and area ---*/
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      
+      /*--- Mean Values ---*/
+      
+      Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
+      Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
+      
+      /*--- Adjustment for grid movement ---*/
+      
+      if (grid_movement) {
+        su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
+        su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+        ProjVel_i = 0.0; ProjVel_j = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          ProjVel_i += GridVel_i[iDim]*Normal[iDim];
+          ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+        }
+        Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
       }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
+      
+      /*--- Inviscid contribution ---*/
+      
+      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
+      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
+      
     }
-    
-    /*--- Inviscid contribution ---*/
-    
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-    if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
-    if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
-    
   }
   
   /*--- Loop boundary edges ---*/
@@ -4490,6 +4127,9 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   
   /*--- Each element uses their own speed, steady state simulation ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Vol, Local_Delta_Time) reduction(min:Global_Delta_Time, Min_Delta) reduction(max:Max_Delta) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
     Vol = geometry->node[iPoint]->GetVolume();
@@ -4497,8 +4137,8 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
     if (Vol != 0.0) {
       Local_Delta_Time = config->GetCFL(iMesh)*Vol / node[iPoint]->GetMax_Lambda_Inv();
       Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
+      Min_Delta = min(Min_Delta, Local_Delta_Time);
+      Max_Delta = max(Max_Delta, Local_Delta_Time);
       if (Local_Delta_Time > config->GetMax_DeltaTime())
         Local_Delta_Time = config->GetMax_DeltaTime();
       node[iPoint]->SetDelta_Time(Local_Delta_Time);
@@ -4509,6 +4149,7 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
     
   }
   
+  Min_Delta_Time = Min_Delta; Max_Delta_Time = Max_Delta;
   
   /*--- Compute the max and the min dt (in parallel) ---*/
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
@@ -4569,69 +4210,113 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   
   /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
   
-  if (dual_time)
+  if (dual_time) {
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Local_Delta_Time) schedule(static)
+#endif
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       if (!implicit) {
         Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), node[iPoint]->GetDelta_Time());
         node[iPoint]->SetDelta_Time(Local_Delta_Time);
       }
     }
+  }
   
 }
 
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iEdge, iPoint, jPoint;
-  
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool jst_scheme = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
-    
-    /*--- Set primitive variables w/o reconstruction ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    
-    /*--- Set the largest convective eigenvalue ---*/
-    
-    numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
-    
-    /*--- Set undivided laplacian an pressure based sensor ---*/
-    
-    if (jst_scheme) {
-      numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
-      numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
-    }
-    
-    /*--- Grid movement ---*/
-    
-    if (grid_movement) {
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
-    }
-    
-    /*--- Compute residuals, and Jacobians ---*/
+  /*--- Batched fluxes, the edges are visited color by color ---*/
+  
+  bool batch = ((FluxBatch != NULL) && (geometry->GetnEdge_Color() != 0) && numerics->GetBatch_Support());
+  if (batch) FluxBatch->nEdge = 0;
+  
+  /*--- The edges of a color share no point, so the threads add their fluxes
+   without conflicts and each point receives them in the same order for any
+   number of threads. The batches are filled by a single thread. ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(batch? 1 : nThread_Edge)
+#endif
+  {
+    unsigned long iColor, iEdge, iEdge_Loop, iPoint, jPoint;
+    unsigned short iThread = omp_get_thread_num();
     
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
+    CNumerics *edge_numerics = (iThread == 0? numerics : EdgeWork[iThread]->Numerics[CONV_TERM]);
+    su2double *Res = (iThread == 0? Res_Conv : EdgeWork[iThread]->Residual);
+    su2double **Jac_i = (iThread == 0? Jacobian_i : EdgeWork[iThread]->Jacobian_i);
+    su2double **Jac_j = (iThread == 0? Jacobian_j : EdgeWork[iThread]->Jacobian_j);
     
-    /*--- Update convective and artificial dissipation residuals ---*/
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+      
+        /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+      
+        iPoint = geometry->GetEdge_Node(iEdge, 0); jPoint = geometry->GetEdge_Node(iEdge, 1);
+        edge_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+        edge_numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+      
+        /*--- Set primitive variables w/o reconstruction ---*/
+      
+        edge_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+      
+        /*--- Set the largest convective eigenvalue ---*/
+      
+        edge_numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
+      
+        /*--- Set undivided laplacian an pressure based sensor ---*/
+      
+        if (jst_scheme) {
+          edge_numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
+          edge_numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
+        }
+      
+        /*--- Grid movement ---*/
+      
+        if (grid_movement) {
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        }
+      
+        /*--- Store the edge in the batch, which is evaluated once it is
+         full or at the end of the color ---*/
+      
+        if (batch) {
+          FluxBatch->Edge[FluxBatch->nEdge] = iEdge;
+          FluxBatch->Point_i[FluxBatch->nEdge] = iPoint;
+          FluxBatch->Point_j[FluxBatch->nEdge] = jPoint;
+          numerics->SetBatch_Lane(FluxBatch, FluxBatch->nEdge);
+          FluxBatch->nEdge++;
+          if (FluxBatch->nEdge == SU2_FLUX_BATCH)
+            Convective_Residual_Batch(numerics, config);
+          continue;
+        }
+      
+        /*--- Compute residuals, and Jacobians ---*/
+      
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
+      
+        /*--- Update convective and artificial dissipation residuals ---*/
+      
+        LinSysRes.UpdateBlocks(iPoint, jPoint, Res);
+      
+        /*--- Set implicit computation ---*/
+        if (implicit) {
+          Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+        }
+      }
     
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
+      if (batch) Convective_Residual_Batch(numerics, config);
     
-    /*--- Set implicit computation ---*/
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
     }
   }
   
@@ -4640,15 +4325,7 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh) {
   
-  su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
-  *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
-  
-  su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
-  
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
-  
-  bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
+  unsigned long counter_local = 0, counter_global = 0;
   
   unsigned long ExtIter = config->GetExtIter();
   bool implicit         = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -4661,221 +4338,301 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
   bool low_mach_corr    = config->Low_Mach_Correction();
   unsigned short kind_dissipation = config->GetKind_RoeLowDiss();
+  
+  /*--- Batched fluxes, the edges are visited color by color ---*/
+  
+  bool batch = ((FluxBatch != NULL) && (geometry->GetnEdge_Color() != 0) && numerics->GetBatch_Support() &&
+                !roe_turkel && (kind_dissipation == NO_ROELOWDISS));
+  if (batch) FluxBatch->nEdge = 0;
+  
+  /*--- Loop over all the edges, by colors. The edges of a color share no point,
+   so the threads add their fluxes without conflicts and each point receives them
+   in the same order for any number of threads. The batches are filled by a single
+   thread. The edges without received points are computed first, the halo exchanges
+   left in flight by the preprocessing are completed before the other ones. ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(batch? 1 : nThread_Edge) reduction(+:counter_local)
+#endif
+  {
+    su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
+    *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
     
-  /*--- Loop over all the edges ---*/
-
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge and normal vectors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Roe Turkel preconditioning ---*/
+    su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
     
-    if (roe_turkel) {
-      sqvel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim ++)
-        sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
-      numerics->SetVelocity2_Inf(sqvel);
-    }
+    unsigned long iEdge, iEdge_Loop, iPoint, jPoint, iColor, Edge_Begin, Edge_End;
+    unsigned short iDim, iVar, iPhase;
     
-    /*--- Grid movement ---*/
+    bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
     
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    /*--- Numerics and work arrays of the thread ---*/
     
-    /*--- Get primitive variables ---*/
+    unsigned short iThread = omp_get_thread_num();
+    CEdgeWork *Work = (iThread == 0? NULL : EdgeWork[iThread]);
     
-    V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
-    S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
-
-    /*--- High order reconstruction using MUSCL strategy ---*/
+    CNumerics *edge_numerics = (Work == NULL? numerics : Work->Numerics[CONV_TERM]);
+    CFluidModel *edge_fluidmodel = (Work == NULL? FluidModel : FluidModel_Thread[iThread]);
+    su2double *Vec_i = (Work == NULL? Vector_i : Work->Vector_i), *Vec_j = (Work == NULL? Vector_j : Work->Vector_j);
+    su2double *Prim_i = (Work == NULL? Primitive_i : Work->Primitive_i), *Prim_j = (Work == NULL? Primitive_j : Work->Primitive_j);
+    su2double *Sec_i = (Work == NULL? Secondary_i : Work->Secondary_i), *Sec_j = (Work == NULL? Secondary_j : Work->Secondary_j);
+    su2double *Res = (Work == NULL? Res_Conv : Work->Residual);
+    su2double **Jac_i = (Work == NULL? Jacobian_i : Work->Jacobian_i), **Jac_j = (Work == NULL? Jacobian_j : Work->Jacobian_j);
     
-    if (muscl) {
+    for (iPhase = 0; iPhase < 2; iPhase++) {
       
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
+      /*--- The interior edges are done, the received values are needed from here on ---*/
       
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = node[jPoint]->GetLimiter_Primitive();
+      if (iPhase == 1) {
+#ifdef HAVE_OMP
+#pragma omp master
+#endif
+        Complete_MPI_Pending(geometry, config);
+#ifdef HAVE_OMP
+#pragma omp barrier
+#endif
       }
       
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
-        }
-        if (limiter) {
-          if (van_albada){
-            Limiter_i[iVar] = (V_j[iVar]-V_i[iVar])*(2.0*Project_Grad_i + V_j[iVar]-V_i[iVar])/(4*Project_Grad_i*Project_Grad_i+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
-            Limiter_j[iVar] = (V_j[iVar]-V_i[iVar])*(-2.0*Project_Grad_j + V_j[iVar]-V_i[iVar])/(4*Project_Grad_j*Project_Grad_j+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+      for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+        
+        Edge_Begin = (iPhase == 0? geometry->GetEdge_Color_Begin(iColor) : geometry->GetEdge_Color_Split(iColor));
+        Edge_End   = (iPhase == 0? geometry->GetEdge_Color_Split(iColor) : geometry->GetEdge_Color_Begin(iColor+1));
+        
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+        for (iEdge_Loop = Edge_Begin; iEdge_Loop < Edge_End; iEdge_Loop++) {
+          
+          iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+          
+          /*--- Points in edge and normal vectors ---*/
+          
+          iPoint = geometry->GetEdge_Node(iEdge, 0); jPoint = geometry->GetEdge_Node(iEdge, 1);
+          edge_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+          
+          /*--- Roe Turkel preconditioning ---*/
+          
+          if (roe_turkel) {
+            sqvel = 0.0;
+            for (iDim = 0; iDim < nDim; iDim ++)
+              sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
+            edge_numerics->SetVelocity2_Inf(sqvel);
+          }
+          
+          /*--- Grid movement ---*/
+          
+          if (grid_movement)
+            edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+          
+          /*--- Get primitive variables ---*/
+          
+          V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
+          S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
+          
+          /*--- High order reconstruction using MUSCL strategy ---*/
+          
+          if (muscl) {
+            
+            Coord_i = geometry->GetPoint_Coord(iPoint);
+            Coord_j = geometry->GetPoint_Coord(jPoint);
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Vec_i[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+              Vec_j[iDim] = 0.5*(Coord_i[iDim] - Coord_j[iDim]);
+            }
+            
+            Gradient_i = node[iPoint]->GetGradient_Primitive();
+            Gradient_j = node[jPoint]->GetGradient_Primitive();
+            if (limiter) {
+              Limiter_i = node[iPoint]->GetLimiter_Primitive();
+              Limiter_j = node[jPoint]->GetLimiter_Primitive();
+            }
+            
+            for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+              Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+              Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
+              for (iDim = 0; iDim < nDim; iDim++) {
+                Project_Grad_i += Vec_i[iDim]*Gradient_i[iVar][iDim]*Non_Physical;
+                Project_Grad_j += Vec_j[iDim]*Gradient_j[iVar][iDim]*Non_Physical;
+              }
+              if (limiter) {
+                if (van_albada){
+                  Limiter_i[iVar] = (V_j[iVar]-V_i[iVar])*(2.0*Project_Grad_i + V_j[iVar]-V_i[iVar])/(4*Project_Grad_i*Project_Grad_i+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+                  Limiter_j[iVar] = (V_j[iVar]-V_i[iVar])*(-2.0*Project_Grad_j + V_j[iVar]-V_i[iVar])/(4*Project_Grad_j*Project_Grad_j+(V_j[iVar]-V_i[iVar])*(V_j[iVar]-V_i[iVar])+EPS);
+                }
+                Prim_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+                Prim_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+              }
+              else {
+                Prim_i[iVar] = V_i[iVar] + Project_Grad_i;
+                Prim_j[iVar] = V_j[iVar] + Project_Grad_j;
+              }
+            }
+            
+            /*--- Recompute the extrapolated quantities in a
+             thermodynamic consistent way  ---*/
+            
+            if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config, edge_fluidmodel, Prim_i, Prim_j, Sec_i, Sec_j); }
+            
+            /*--- Low-Mach number correction ---*/
+            
+            if (low_mach_corr) {
+              
+              velocity2_i = 0.0;
+              velocity2_j = 0.0;
+              
+              for (iDim = 0; iDim < nDim; iDim++) {
+                velocity2_i += Prim_i[iDim+1]*Prim_i[iDim+1];
+                velocity2_j += Prim_j[iDim+1]*Prim_j[iDim+1];
+              }
+              mach_i = sqrt(velocity2_i)/Prim_i[nDim+4];
+              mach_j = sqrt(velocity2_j)/Prim_j[nDim+4];
+              
+              z = min(max(mach_i,mach_j),1.0);
+              velocity2_i = 0.0;
+              velocity2_j = 0.0;
+              for (iDim = 0; iDim < nDim; iDim++) {
+                vel_i_corr[iDim] = ( Prim_i[iDim+1] + Prim_j[iDim+1] )/2.0 \
+                        + z * ( Prim_i[iDim+1] - Prim_j[iDim+1] )/2.0;
+                vel_j_corr[iDim] = ( Prim_i[iDim+1] + Prim_j[iDim+1] )/2.0 \
+                        + z * ( Prim_j[iDim+1] - Prim_i[iDim+1] )/2.0;
+                
+                velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
+                velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
+                
+                Prim_i[iDim+1] = vel_i_corr[iDim];
+                Prim_j[iDim+1] = vel_j_corr[iDim];
+              }
+              
+              edge_fluidmodel->SetEnergy_Prho(Prim_i[nDim+1],Prim_i[nDim+2]);
+              Prim_i[nDim+3]= edge_fluidmodel->GetStaticEnergy() + Prim_i[nDim+1]/Prim_i[nDim+2] + 0.5*velocity2_i;
+              
+              edge_fluidmodel->SetEnergy_Prho(Prim_j[nDim+1],Prim_j[nDim+2]);
+              Prim_j[nDim+3]= edge_fluidmodel->GetStaticEnergy() + Prim_j[nDim+1]/Prim_j[nDim+2] + 0.5*velocity2_j;
+              
+            }
+            
+            /*--- Check for non-physical solutions after reconstruction. If found,
+             use the cell-average value of the solution. This results in a locally
+             first-order approximation, but this is typically only active
+             during the start-up of a calculation. If non-physical, use the 
+             cell-averaged state. ---*/
+            
+            neg_pressure_i = (Prim_i[nDim+1] < 0.0); neg_pressure_j = (Prim_j[nDim+1] < 0.0);
+            neg_density_i  = (Prim_i[nDim+2] < 0.0); neg_density_j  = (Prim_j[nDim+2] < 0.0);
+            
+            R = sqrt(fabs(Prim_j[nDim+2]/Prim_i[nDim+2]));
+            sq_vel = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              RoeVelocity[iDim] = (R*Prim_j[iDim+1]+Prim_i[iDim+1])/(R+1);
+              sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
+            }
+            RoeEnthalpy = (R*Prim_j[nDim+3]+Prim_i[nDim+3])/(R+1);
+            neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
+            
+            if (neg_sound_speed) {
+              for (iVar = 0; iVar < nPrimVar; iVar++) {
+                Prim_i[iVar] = V_i[iVar];
+                Prim_j[iVar] = V_j[iVar]; }
+              Sec_i[0] = S_i[0]; Sec_i[1] = S_i[1];
+              Sec_j[0] = S_i[0]; Sec_j[1] = S_i[1];
+              counter_local++;
+            }
+            
+            if (neg_density_i || neg_pressure_i) {
+              for (iVar = 0; iVar < nPrimVar; iVar++) Prim_i[iVar] = V_i[iVar];
+              Sec_i[0] = S_i[0]; Sec_i[1] = S_i[1];
+              counter_local++;
+            }
+            
+            if (neg_density_j || neg_pressure_j) {
+              for (iVar = 0; iVar < nPrimVar; iVar++) Prim_j[iVar] = V_j[iVar];
+              Sec_j[0] = S_j[0]; Sec_j[1] = S_j[1];
+              counter_local++;
+            }
+            
+            edge_numerics->SetPrimitive(Prim_i, Prim_j);
+            edge_numerics->SetSecondary(Sec_i, Sec_j);
+            
+          }
+          else {
+            
+            /*--- Set conservative variables without reconstruction ---*/
+            
+            edge_numerics->SetPrimitive(V_i, V_j);
+            edge_numerics->SetSecondary(S_i, S_j);
+            
+          }
+          
+          /*--- Roe Low Dissipation Scheme ---*/
+          
+          if (kind_dissipation != NO_ROELOWDISS){
+            
+            Dissipation_i = node[iPoint]->GetRoe_Dissipation();
+            Dissipation_j = node[jPoint]->GetRoe_Dissipation();
+            edge_numerics->SetDissipation(Dissipation_i, Dissipation_j);
+            
+            if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
+              Sensor_i = node[iPoint]->GetSensor();
+              Sensor_j = node[jPoint]->GetSensor();
+              edge_numerics->SetSensor(Sensor_i, Sensor_j);
+            }
+            if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
+              Coord_i = geometry->GetPoint_Coord(iPoint);
+              Coord_j = geometry->GetPoint_Coord(jPoint);
+              edge_numerics->SetCoord(Coord_i, Coord_j);
+            }
           }
-          Primitive_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Primitive_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
-      }
-
-      /*--- Recompute the extrapolated quantities in a
-       thermodynamic consistent way  ---*/
-
-      if (!ideal_gas || low_mach_corr) { ComputeConsExtrapolation(config); }
-
-      /*--- Low-Mach number correction ---*/
-
-      if (low_mach_corr) {
-
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
-          velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
-        }
-        mach_i = sqrt(velocity2_i)/Primitive_i[nDim+4];
-        mach_j = sqrt(velocity2_j)/Primitive_j[nDim+4];
-
-        z = min(max(mach_i,mach_j),1.0);
-        velocity2_i = 0.0;
-        velocity2_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          vel_i_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                  + z * ( Primitive_i[iDim+1] - Primitive_j[iDim+1] )/2.0;
-          vel_j_corr[iDim] = ( Primitive_i[iDim+1] + Primitive_j[iDim+1] )/2.0 \
-                  + z * ( Primitive_j[iDim+1] - Primitive_i[iDim+1] )/2.0;
-
-          velocity2_j += vel_j_corr[iDim]*vel_j_corr[iDim];
-          velocity2_i += vel_i_corr[iDim]*vel_i_corr[iDim];
-
-          Primitive_i[iDim+1] = vel_i_corr[iDim];
-          Primitive_j[iDim+1] = vel_j_corr[iDim];
+          
+          /*--- Store the edge in the batch, which is evaluated once it is
+           full or at the end of the color ---*/
+          
+          if (batch) {
+            FluxBatch->Edge[FluxBatch->nEdge] = iEdge;
+            FluxBatch->Point_i[FluxBatch->nEdge] = iPoint;
+            FluxBatch->Point_j[FluxBatch->nEdge] = jPoint;
+            numerics->SetBatch_Lane(FluxBatch, FluxBatch->nEdge);
+            FluxBatch->nEdge++;
+            if (FluxBatch->nEdge == SU2_FLUX_BATCH)
+              Convective_Residual_Batch(numerics, config);
+            continue;
+          }
+          
+          /*--- Compute the residual ---*/
+          
+          edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
+          
+          /*--- Update residual value ---*/
+          
+          LinSysRes.UpdateBlocks(iPoint, jPoint, Res);
+          
+          /*--- Set implicit Jacobians ---*/
+          
+          if (implicit) {
+            Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+          }
+          
+          /*--- Roe Turkel preconditioning, set the value of beta ---*/
+          
+          if (roe_turkel) {
+            node[iPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+            node[jPoint]->SetPreconditioner_Beta(edge_numerics->GetPrecond_Beta());
+          }
+          
+          /*--- Set the final value of the Roe dissipation coefficient ---*/
+          
+          if (kind_dissipation != NO_ROELOWDISS){
+            node[iPoint]->SetRoe_Dissipation(edge_numerics->GetDissipation());
+            node[jPoint]->SetRoe_Dissipation(edge_numerics->GetDissipation());
+          }
+          
         }
-
-        FluidModel->SetEnergy_Prho(Primitive_i[nDim+1],Primitive_i[nDim+2]);
-        Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
         
-        FluidModel->SetEnergy_Prho(Primitive_j[nDim+1],Primitive_j[nDim+2]);
-        Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
+        if (batch) Convective_Residual_Batch(numerics, config);
         
       }
       
-      /*--- Check for non-physical solutions after reconstruction. If found,
-       use the cell-average value of the solution. This results in a locally
-       first-order approximation, but this is typically only active
-       during the start-up of a calculation. If non-physical, use the 
-       cell-averaged state. ---*/
-      
-      neg_pressure_i = (Primitive_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_j[nDim+1] < 0.0);
-      neg_density_i  = (Primitive_i[nDim+2] < 0.0); neg_density_j  = (Primitive_j[nDim+2] < 0.0);
-
-      R = sqrt(fabs(Primitive_j[nDim+2]/Primitive_i[nDim+2]));
-      sq_vel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        RoeVelocity[iDim] = (R*Primitive_j[iDim+1]+Primitive_i[iDim+1])/(R+1);
-        sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
-      }
-      RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
-      neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
-      
-      if (neg_sound_speed) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) {
-          Primitive_i[iVar] = V_i[iVar];
-          Primitive_j[iVar] = V_j[iVar]; }
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        Secondary_j[0] = S_i[0]; Secondary_j[1] = S_i[1];
-        counter_local++;
-      }
-      
-      if (neg_density_i || neg_pressure_i) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_i[iVar] = V_i[iVar];
-        Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        counter_local++;
-      }
-      
-      if (neg_density_j || neg_pressure_j) {
-        for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_j[iVar] = V_j[iVar];
-        Secondary_j[0] = S_j[0]; Secondary_j[1] = S_j[1];
-        counter_local++;
-      }
-
-      numerics->SetPrimitive(Primitive_i, Primitive_j);
-      numerics->SetSecondary(Secondary_i, Secondary_j);
-      
-    }
-    else {
-      
-      /*--- Set conservative variables without reconstruction ---*/
-      
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetSecondary(S_i, S_j);
-      
-    }
-    
-    /*--- Roe Low Dissipation Scheme ---*/
-    
-    if (kind_dissipation != NO_ROELOWDISS){
-      
-      Dissipation_i = node[iPoint]->GetRoe_Dissipation();
-      Dissipation_j = node[jPoint]->GetRoe_Dissipation();
-      numerics->SetDissipation(Dissipation_i, Dissipation_j);
-            
-      if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
-        Sensor_i = node[iPoint]->GetSensor();
-        Sensor_j = node[jPoint]->GetSensor();
-        numerics->SetSensor(Sensor_i, Sensor_j);
-      }
-      if (kind_dissipation == NTS || kind_dissipation == NTS_DUCROS){
-        Coord_i = geometry->node[iPoint]->GetCoord();
-        Coord_j = geometry->node[jPoint]->GetCoord();
-        numerics->SetCoord(Coord_i, Coord_j);
-      }
-    }
-      
-    /*--- Compute the residual ---*/
-    
-    numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
-
-    /*--- Update residual value ---*/
-    
-    LinSysRes.AddBlock(iPoint, Res_Conv);
-    LinSysRes.SubtractBlock(jPoint, Res_Conv);
-    
-    /*--- Set implicit Jacobians ---*/
-    
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    }
-    
-    /*--- Roe Turkel preconditioning, set the value of beta ---*/
-    
-    if (roe_turkel) {
-      node[iPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-      node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-    }
-    
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
-    
-    if (kind_dissipation != NO_ROELOWDISS){
-      node[iPoint]->SetRoe_Dissipation(numerics->GetDissipation());
-      node[jPoint]->SetRoe_Dissipation(numerics->GetDissipation());      
     }
-    
   }
-
+  
   /*--- Warning message about non-physical reconstructions ---*/
   
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
@@ -4888,40 +4645,75 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   }
 }
 
-void CEulerSolver::ComputeConsExtrapolation(CConfig *config) {
+void CEulerSolver::Convective_Residual_Batch(CNumerics *numerics, CConfig *config) {
+  
+  unsigned short iLane, iVar, jVar;
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  
+  if (FluxBatch->nEdge == 0) return;
+  
+  FluxBatch->SetPadding();
+  numerics->ComputeResidual_Batch(FluxBatch, config);
+  
+  /*--- Scatter the lanes in use, no two of them share a point ---*/
+  
+  for (iLane = 0; iLane < FluxBatch->nEdge; iLane++) {
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      Res_Conv[iVar] = FluxBatch->Residual[iVar][iLane];
+    
+    LinSysRes.AddBlock(FluxBatch->Point_i[iLane], Res_Conv);
+    LinSysRes.SubtractBlock(FluxBatch->Point_j[iLane], Res_Conv);
+    
+    if (implicit) {
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++) {
+          Jacobian_i[iVar][jVar] = FluxBatch->Jacobian_i[iVar][jVar][iLane];
+          Jacobian_j[iVar][jVar] = FluxBatch->Jacobian_j[iVar][jVar][iLane];
+        }
+      Jacobian.UpdateBlocks(FluxBatch->Edge[iLane], FluxBatch->Point_i[iLane], FluxBatch->Point_j[iLane], Jacobian_i, Jacobian_j);
+    }
+  }
+  
+  FluxBatch->nEdge = 0;
+  
+}
+
+void CEulerSolver::ComputeConsExtrapolation(CConfig *config, CFluidModel *val_fluidmodel,
+                                            su2double *Prim_i, su2double *Prim_j, su2double *Sec_i, su2double *Sec_j) {
   
   unsigned short iDim;
   
-  su2double density_i = Primitive_i[nDim+2];
-  su2double pressure_i = Primitive_i[nDim+1];
+  su2double density_i = Prim_i[nDim+2];
+  su2double pressure_i = Prim_i[nDim+1];
   su2double velocity2_i = 0.0;
   for (iDim = 0; iDim < nDim; iDim++) {
-    velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
+    velocity2_i += Prim_i[iDim+1]*Prim_i[iDim+1];
   }
   
-  FluidModel->SetTDState_Prho(pressure_i, density_i);
+  val_fluidmodel->SetTDState_Prho(pressure_i, density_i);
   
-  Primitive_i[0]= FluidModel->GetTemperature();
-  Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
-  Primitive_i[nDim+4]= FluidModel->GetSoundSpeed();
-  Secondary_i[0]=FluidModel->GetdPdrho_e();
-  Secondary_i[1]=FluidModel->GetdPde_rho();
+  Prim_i[0]= val_fluidmodel->GetTemperature();
+  Prim_i[nDim+3]= val_fluidmodel->GetStaticEnergy() + Prim_i[nDim+1]/Prim_i[nDim+2] + 0.5*velocity2_i;
+  Prim_i[nDim+4]= val_fluidmodel->GetSoundSpeed();
+  Sec_i[0]=val_fluidmodel->GetdPdrho_e();
+  Sec_i[1]=val_fluidmodel->GetdPde_rho();
   
   
-  su2double density_j = Primitive_j[nDim+2];
-  su2double pressure_j = Primitive_j[nDim+1];
+  su2double density_j = Prim_j[nDim+2];
+  su2double pressure_j = Prim_j[nDim+1];
   su2double velocity2_j = 0.0;
   for (iDim = 0; iDim < nDim; iDim++) {
-    velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
+    velocity2_j += Prim_j[iDim+1]*Prim_j[iDim+1];
   }
   
-  FluidModel->SetTDState_Prho(pressure_j, density_j);
+  val_fluidmodel->SetTDState_Prho(pressure_j, density_j);
   
-  Primitive_j[0]= FluidModel->GetTemperature();
-  Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
-  Primitive_j[nDim+4]=FluidModel->GetSoundSpeed();
-  Secondary_j[0]=FluidModel->GetdPdrho_e();
-  Secondary_j[1]=FluidModel->GetdPde_rho();
+  Prim_j[0]= val_fluidmodel->GetTemperature();
+  Prim_j[nDim+3]= val_fluidmodel->GetStaticEnergy() + Prim_j[nDim+1]/Prim_j[nDim+2] + 0.5*velocity2_j;
+  Prim_j[nDim+4]=val_fluidmodel->GetSoundSpeed();
+  Sec_j[0]=val_fluidmodel->GetdPdrho_e();
+  Sec_j[1]=val_fluidmodel->GetdPde_rho();
   
 }
 
@@ -5112,53 +4904,67 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
   
   su2double *Normal, Area, Mean_SoundSpeed = 0.0, Mean_ProjVel = 0.0, Lambda,
   ProjVel, ProjVel_i, ProjVel_j, *GridVel, *GridVel_i, *GridVel_j;
-  unsigned long iEdge, iVertex, iPoint, jPoint;
+  unsigned long iEdge, iEdge_Loop, iColor, iVertex, iPoint, jPoint;
   unsigned short iDim, iMarker;
   
   bool grid_movement = config->GetGrid_Movement();
   
   /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     node[iPoint]->SetLambda(0.0);
   }
   
-  /*--- Loop interior edges ---*/
+  /*--- Loop interior edges, by colors (the edges of a color share no point) ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Point identification, Normal vector and area ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
-    
-    /*--- Mean Values ---*/
-    
-    Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
-    Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Normal, Area, iDim, Mean_ProjVel, Mean_SoundSpeed, GridVel_i, GridVel_j, ProjVel_i, ProjVel_j, Lambda)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
 
-    /*--- Adjustment for grid movement ---*/
-    
-    if (grid_movement) {
-      GridVel_i = geometry->node[iPoint]->GetGridVel();
-      GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j =0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+      
+      /*--- Point identification, Normal vector and area ---*/
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      
+      /*--- Mean Values ---*/
+      
+      Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
+      Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
+
+      /*--- Adjustment for grid movement ---*/
+      
+      if (grid_movement) {
+        GridVel_i = geometry->node[iPoint]->GetGridVel();
+        GridVel_j = geometry->node[jPoint]->GetGridVel();
+        ProjVel_i = 0.0; ProjVel_j =0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          ProjVel_i += GridVel_i[iDim]*Normal[iDim];
+          ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+        }
+        Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
       }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
+      
+      /*--- Inviscid contribution ---*/
+      
+      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddLambda(Lambda);
+      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddLambda(Lambda);
+      
     }
-    
-    /*--- Inviscid contribution ---*/
-    
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-    if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddLambda(Lambda);
-    if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddLambda(Lambda);
-    
   }
   
   /*--- Loop boundary edges ---*/
@@ -5206,109 +5012,148 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, jPoint, iEdge;
-  su2double Pressure_i = 0, Pressure_j = 0, *Diff;
-  unsigned short iVar;
-  bool boundary_i, boundary_j;
-    
-  Diff = new su2double[nVar];
+  unsigned long iPoint;
+  su2double *Diff_Thread;
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetUnd_LaplZero();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    /*--- Solution differences ---*/
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      Diff[iVar] = node[iPoint]->GetSolution(iVar) - node[jPoint]->GetSolution(iVar);
-    
-    /*--- Correction for compressible flows which use the enthalpy ---*/
-    
-    Pressure_i = node[iPoint]->GetPressure();
-    Pressure_j = node[jPoint]->GetPressure();
-    Diff[nVar-1] = (node[iPoint]->GetSolution(nVar-1) + Pressure_i) - (node[jPoint]->GetSolution(nVar-1) + Pressure_j);
-    
-    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
-    
-    /*--- Both points inside the domain, or both in the boundary ---*/
-    
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
-      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
-      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
+  /*--- Loop the edges by colors (the edges of a color share no point),
+   each thread with its own difference vector ---*/
+  
+  Scratch->Push();
+  Diff_Thread = Scratch->GetVector(omp_get_max_threads()*nVar);
+  
+#ifdef HAVE_OMP
+#pragma omp parallel
+#endif
+  {
+    unsigned long iPoint, jPoint, iEdge, iEdge_Loop, iColor;
+    su2double Pressure_i = 0, Pressure_j = 0, *Diff = &Diff_Thread[omp_get_thread_num()*nVar];
+    unsigned short iVar;
+    bool boundary_i, boundary_j;
+    
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
+        
+        /*--- Solution differences ---*/
+        
+        for (iVar = 0; iVar < nVar; iVar++)
+          Diff[iVar] = node[iPoint]->GetSolution(iVar) - node[jPoint]->GetSolution(iVar);
+        
+        /*--- Correction for compressible flows which use the enthalpy ---*/
+        
+        Pressure_i = node[iPoint]->GetPressure();
+        Pressure_j = node[jPoint]->GetPressure();
+        Diff[nVar-1] = (node[iPoint]->GetSolution(nVar-1) + Pressure_i) - (node[jPoint]->GetSolution(nVar-1) + Pressure_j);
+        
+        boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
+        boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+        
+        /*--- Both points inside the domain, or both in the boundary ---*/
+        
+        if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
+          if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
+          if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
+        }
+        
+        /*--- iPoint inside the domain, jPoint on the boundary ---*/
+        
+        if (!boundary_i && boundary_j)
+          if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
+        
+        /*--- jPoint inside the domain, iPoint on the boundary ---*/
+        
+        if (boundary_i && !boundary_j)
+          if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
+        
+      }
     }
-    
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-    
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->SubtractUnd_Lapl(Diff);
-    
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
-    
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddUnd_Lapl(Diff);
-    
   }
   
+  Scratch->Pop();
+  
   /*--- MPI parallelization ---*/
   
   Set_MPI_Undivided_Laplacian(geometry, config);
   
-  delete [] Diff;
-  
 }
 
 void CEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iEdge, iPoint, jPoint;
+  unsigned long iEdge, iEdge_Loop, iColor, iPoint, jPoint;
   su2double Pressure_i = 0.0, Pressure_j = 0.0;
   bool boundary_i, boundary_j;
   
   /*--- Reset variables to store the undivided pressure ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     iPoint_UndLapl[iPoint] = 0.0;
     jPoint_UndLapl[iPoint] = 0.0;
   }
   
-  /*--- Evaluate the pressure sensor ---*/
+  /*--- Evaluate the pressure sensor, by colors of the edges ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Pressure_i = node[iPoint]->GetPressure();
-    Pressure_j = node[jPoint]->GetPressure();
-    
-    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
-    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
-    
-    /*--- Both points inside the domain, or both on the boundary ---*/
-    
-    if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
-      if (geometry->node[iPoint]->GetDomain()) { iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i); jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j); }
-      if (geometry->node[jPoint]->GetDomain()) { iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j); jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j); }
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Pressure_i, Pressure_j, boundary_i, boundary_j)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Pressure_i = node[iPoint]->GetPressure();
+      Pressure_j = node[jPoint]->GetPressure();
+      
+      boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
+      boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+      
+      /*--- Both points inside the domain, or both on the boundary ---*/
+      
+      if ((!boundary_i && !boundary_j) || (boundary_i && boundary_j)) {
+        if (geometry->node[iPoint]->GetDomain()) { iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i); jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j); }
+        if (geometry->node[jPoint]->GetDomain()) { iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j); jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j); }
+      }
+      
+      /*--- iPoint inside the domain, jPoint on the boundary ---*/
+      
+      if (!boundary_i && boundary_j)
+        if (geometry->node[iPoint]->GetDomain()) { iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i); jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j); }
+      
+      /*--- jPoint inside the domain, iPoint on the boundary ---*/
+      
+      if (boundary_i && !boundary_j)
+        if (geometry->node[jPoint]->GetDomain()) { iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j); jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j); }
+      
     }
-    
-    /*--- iPoint inside the domain, jPoint on the boundary ---*/
-    
-    if (!boundary_i && boundary_j)
-      if (geometry->node[iPoint]->GetDomain()) { iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i); jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j); }
-    
-    /*--- jPoint inside the domain, iPoint on the boundary ---*/
-    
-    if (boundary_i && !boundary_j)
-      if (geometry->node[jPoint]->GetDomain()) { iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j); jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j); }
-    
   }
   
   /*--- Set pressure switch for each point ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetSensor(fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
   
@@ -5696,16 +5541,17 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   
   /*--- Add the forces on the surfaces using all the nodes ---*/
   
-  MySurface_CL_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Inv = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Inv       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Inv        = new su2double[config->GetnMarker_Monitoring()];
+  Scratch->Push();
+  MySurface_CL_Inv      = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CD_Inv      = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CSF_Inv = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CEff_Inv       = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFx_Inv        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFy_Inv        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFz_Inv        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMx_Inv        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMy_Inv        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMz_Inv        = Scratch->GetVector(config->GetnMarker_Monitoring());
 
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
     MySurface_CL_Inv[iMarker_Monitoring]      = Surface_CL_Inv[iMarker_Monitoring];
@@ -5743,10 +5589,7 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   SU2_MPI::Allreduce(MySurface_CMy_Inv, Surface_CMy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(MySurface_CMz_Inv, Surface_CMz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
-  delete [] MySurface_CL_Inv; delete [] MySurface_CD_Inv; delete [] MySurface_CSF_Inv;
-  delete [] MySurface_CEff_Inv;  delete [] MySurface_CFx_Inv;   delete [] MySurface_CFy_Inv;
-  delete [] MySurface_CFz_Inv;   delete [] MySurface_CMx_Inv;   delete [] MySurface_CMy_Inv;
-  delete [] MySurface_CMz_Inv;
+  Scratch->Pop();
   
 #endif
   
@@ -6069,16 +5912,17 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   
   /*--- Add the forces on the surfaces using all the nodes ---*/
   
-  MySurface_CL_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Mnt = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Mnt       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
+  Scratch->Push();
+  MySurface_CL_Mnt      = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CD_Mnt      = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CSF_Mnt = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CEff_Mnt       = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFx_Mnt        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFy_Mnt        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFz_Mnt        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMx_Mnt        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMy_Mnt        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMz_Mnt        = Scratch->GetVector(config->GetnMarker_Monitoring());
   
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
     MySurface_CL_Mnt[iMarker_Monitoring]      = Surface_CL_Mnt[iMarker_Monitoring];
@@ -6116,10 +5960,7 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   SU2_MPI::Allreduce(MySurface_CMy_Mnt, Surface_CMy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(MySurface_CMz_Mnt, Surface_CMz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
-  delete [] MySurface_CL_Mnt; delete [] MySurface_CD_Mnt; delete [] MySurface_CSF_Mnt;
-  delete [] MySurface_CEff_Mnt;  delete [] MySurface_CFx_Mnt;   delete [] MySurface_CFy_Mnt;
-  delete [] MySurface_CFz_Mnt;
-  delete [] MySurface_CMx_Mnt;   delete [] MySurface_CMy_Mnt;  delete [] MySurface_CMz_Mnt;
+  Scratch->Pop();
   
 #endif
   
@@ -6175,6 +6016,9 @@ void CEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_co
   
   /*--- Update the solution ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Vol, Delta, Res_TruncError, Residual, iVar, Res) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     Vol = geometry->node[iPoint]->GetVolume();
     Delta = node[iPoint]->GetDelta_Time() / Vol;
@@ -6186,11 +6030,21 @@ void CEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_co
       for (iVar = 0; iVar < nVar; iVar++) {
         Res = Residual[iVar] + Res_TruncError[iVar];
         node[iPoint]->AddSolution(iVar, -Res*Delta*RK_AlphaCoeff);
+      }
+    }
+    
+  }
+  
+  /*--- Residual norms, in a serial loop so that they do not depend on the number of threads ---*/
+  
+  if (!adjoint) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Res = LinSysRes.GetBlock(iPoint)[iVar] + node[iPoint]->GetResTruncError()[iVar];
         AddRes_RMS(iVar, Res*Res);
         AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
       }
     }
-    
   }
   
   /*--- MPI solution ---*/
@@ -6223,6 +6077,9 @@ void CEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_
 
   /*--- Update the solution ---*/
 
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Vol, Delta, Res_TruncError, Residual, tmp_time, tmp_func, iVar, Res) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     Vol = geometry->node[iPoint]->GetVolume();
@@ -6246,12 +6103,21 @@ void CEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_
         } else {
           node[iPoint]->SetSolution(iVar, node[iPoint]->GetSolution_New(iVar) + tmp_func*Res);
         }
+      }
+    }
+
+  }
+
+  /*--- Residual norms, in a serial loop so that they do not depend on the number of threads ---*/
 
+  if (!adjoint) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Res = LinSysRes.GetBlock(iPoint)[iVar] + node[iPoint]->GetResTruncError()[iVar];
         AddRes_RMS(iVar, Res*Res);
         AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
       }
     }
-
   }
 
   /*--- MPI solution ---*/
@@ -6278,6 +6144,9 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   
   /*--- Update the solution ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Vol, Delta, local_Res_TruncError, local_Residual, iVar, Res) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     Vol = geometry->node[iPoint]->GetVolume();
     Delta = node[iPoint]->GetDelta_Time() / Vol;
@@ -6289,11 +6158,21 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
       for (iVar = 0; iVar < nVar; iVar++) {
         Res = local_Residual[iVar] + local_Res_TruncError[iVar];
         node[iPoint]->AddSolution(iVar, -Res*Delta);
+      }
+    }
+    
+  }
+  
+  /*--- Residual norms, in a serial loop so that they do not depend on the number of threads ---*/
+  
+  if (!adjoint) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Res = LinSysRes.GetBlock(iPoint)[iVar] + node[iPoint]->GetResTruncError()[iVar];
         AddRes_RMS(iVar, Res*Res);
         AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
       }
     }
-    
   }
   
   /*--- MPI solution ---*/
@@ -6323,8 +6202,12 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     SetRes_Max(iVar, 0.0, 0);
   }
   
-  /*--- Build implicit system ---*/
+  /*--- Build implicit system, the low Mach preconditioner uses a scratch matrix
+   of the solver and is kept serial ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(local_Res_TruncError, Vol, Delta, iVar, jVar, total_index) if(!(roe_turkel || low_mach_prec)) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
     /*--- Read the residual ---*/
@@ -6366,6 +6249,14 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
       total_index = iPoint*nVar + iVar;
       LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
       LinSysSol[total_index] = 0.0;
+    }
+  }
+  
+  /*--- Residual norms, in a serial loop so that they do not depend on the number of threads ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
       AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
       AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
     }
@@ -6373,6 +6264,9 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   
   /*--- Initialize residual and solution at the ghost points ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, total_index) schedule(static)
+#endif
   for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
     for (iVar = 0; iVar < nVar; iVar++) {
       total_index = iPoint*nVar + iVar;
@@ -6383,8 +6277,8 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   
   /*--- Solve or smooth the linear system ---*/
   
-  CSysSolve system;
-  IterLinSol = system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  System.SetMatrixFreeProduct(MatrixFree_Product);
+  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
   
   /*--- The the number of iterations of the linear solver ---*/
   
@@ -6393,6 +6287,9 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   /*--- Update solution (system written in terms of increments) ---*/
   
   if (!adjoint) {
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar) schedule(static)
+#endif
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       for (iVar = 0; iVar < nVar; iVar++) {
         node[iPoint]->AddSolution(iVar, config->GetRelaxation_Factor_Flow()*LinSysSol[iPoint*nVar+iVar]);
@@ -6411,42 +6308,50 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 }
 
 void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long iPoint, jPoint, iEdge, iVertex;
+  unsigned long iPoint, jPoint, iEdge, iEdge_Loop, iColor, iVertex;
   unsigned short iDim, iVar, iMarker;
-  su2double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
+  su2double *PrimVar_Vertex, PrimVar_Average,
   Partial_Gradient, Partial_Res, *Normal;
   
   /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho) ---*/
 
-  PrimVar_Vertex = new su2double [nPrimVarGrad];
-  PrimVar_i = new su2double [nPrimVarGrad];
-  PrimVar_j = new su2double [nPrimVarGrad];
+  Scratch->Push();
+  PrimVar_Vertex = Scratch->GetVector(nPrimVarGrad);
   
   /*--- Set Gradient_Primitive to zero ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
 
-  /*--- Loop interior edges ---*/
+  /*--- Loop interior edges, by colors (the edges of a color share no point) ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_i[iVar] = node[iPoint]->GetPrimitive(iVar);
-      PrimVar_j[iVar] = node[jPoint]->GetPrimitive(iVar);
-    }
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_Average =  0.5 * ( PrimVar_i[iVar] + PrimVar_j[iVar] );
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = PrimVar_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Normal, iVar, iDim, PrimVar_Average, Partial_Res)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        PrimVar_Average =  0.5 * ( node[iPoint]->GetPrimitive(iVar) + node[jPoint]->GetPrimitive(iVar) );
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Partial_Res = PrimVar_Average*Normal[iDim];
+          if (geometry->node[iPoint]->GetDomain())
+            node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
+          if (geometry->node[jPoint]->GetDomain())
+            node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+        }
       }
     }
   }
@@ -6475,6 +6380,9 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
 
   /*--- Update gradient value ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, iDim, Partial_Gradient) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
       for (iDim = 0; iDim < nDim; iDim++) {
@@ -6484,9 +6392,7 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
     }
   }
 
-  delete [] PrimVar_Vertex;
-  delete [] PrimVar_i;
-  delete [] PrimVar_j;
+  Scratch->Pop();
 
   Set_MPI_Primitive_Gradient(geometry, config);
 
@@ -6497,9 +6403,43 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
   unsigned short iVar, iDim, jDim, iNeigh;
   unsigned long iPoint, jPoint;
   su2double *PrimVar_i, *PrimVar_j, *Coord_i, *Coord_j, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2;
+  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2, **Gradient, *Weight, Delta;
   bool singular;
   
+  /*--- The weights of the neighbors only depend on the grid and are stored in the
+   geometry, the gradient is then a single sweep over the neighbors of each point.
+   The discrete adjoint builds the matrices below to record the coordinates. ---*/
+  
+  if (!config->GetDiscrete_Adjoint()) {
+    
+    if (!geometry->GetLSGradient_Weights_Valid()) geometry->SetLSGradient_Weights();
+    
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, iDim, iNeigh, jPoint, PrimVar_i, PrimVar_j, Gradient, Weight, Delta) schedule(static)
+#endif
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      PrimVar_i = node[iPoint]->GetPrimitive();
+      Gradient = node[iPoint]->GetGradient_Primitive();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Gradient[iVar][iDim] = 0.0;
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        PrimVar_j = node[jPoint]->GetPrimitive();
+        Weight = geometry->GetLSGradient_Weight(iPoint, iNeigh);
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          Delta = PrimVar_j[iVar]-PrimVar_i[iVar];
+          for (iDim = 0; iDim < nDim; iDim++)
+            Gradient[iVar][iDim] += Weight[iDim]*Delta;
+        }
+      }
+    }
+    
+    Set_MPI_Primitive_Gradient(geometry, config);
+    return;
+    
+  }
+  
   /*--- Loop over points of the grid ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -6638,7 +6578,7 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
 
 void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iEdge, iPoint, jPoint;
+  unsigned long iEdge, iEdge_Loop, iColor, iPoint, jPoint;
   unsigned short iVar, iDim;
   su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
   *Primitive, *Primitive_i, *Primitive_j, *LocalMinPrimitive, *LocalMaxPrimitive,
@@ -6650,6 +6590,9 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
 
   if (config->GetKind_SlopeLimit_Flow() == NO_LIMITER) {
     
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar) schedule(static)
+#endif
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         node[iPoint]->SetLimiter_Primitive(iVar, 1.0);
@@ -6662,6 +6605,9 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     
     /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
     
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar) schedule(static)
+#endif
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         node[iPoint]->SetSolution_Max(iVar, -EPS);
@@ -6670,30 +6616,42 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
       }
     }
     
-    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
+    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables,
+     by colors of the edges --*/
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      /*--- Point identification, Normal vector and area ---*/
-      
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
-      
-      /*--- Get the primitive variables ---*/
-      
-      Primitive_i = node[iPoint]->GetPrimitive();
-      Primitive_j = node[jPoint]->GetPrimitive();
-      
-      /*--- Compute the maximum, and minimum values for nodes i & j ---*/
-      
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        du = (Primitive_j[iVar] - Primitive_i[iVar]);
-        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
-        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
-        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
-        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Primitive_i, Primitive_j, iVar, du)
+#endif
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+        
+        /*--- Point identification, Normal vector and area ---*/
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
+        
+        /*--- Get the primitive variables ---*/
+        
+        Primitive_i = node[iPoint]->GetPrimitive();
+        Primitive_j = node[jPoint]->GetPrimitive();
+        
+        /*--- Compute the maximum, and minimum values for nodes i & j ---*/
+        
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          du = (Primitive_j[iVar] - Primitive_i[iVar]);
+          node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+          node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+          node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+          node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+        }
+        
       }
-      
     }
     
   }
@@ -6702,69 +6660,83 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
   if (config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) {
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
-      
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Gradient_i, Gradient_j, Coord_i, Coord_j, iVar, iDim, dm, dp, limiter)
+#endif
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
         
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
 
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-          else dp = node[iPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
-        
-        if (limiter < node[iPoint]->GetLimiter_Primitive(iVar)) {
-          node[iPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter_Primitive()[iVar]);
-        }
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
         
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-          else dp = node[jPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
+        iPoint     = geometry->edge[iEdge]->GetNode(0);
+        jPoint     = geometry->edge[iEdge]->GetNode(1);
+        Gradient_i = node[iPoint]->GetGradient_Primitive();
+        Gradient_j = node[jPoint]->GetGradient_Primitive();
+        Coord_i    = geometry->node[iPoint]->GetCoord();
+        Coord_j    = geometry->node[jPoint]->GetCoord();
         
-        if (limiter < node[jPoint]->GetLimiter_Primitive(iVar)) {
-          node[jPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter_Primitive()[iVar]);
+        AD::StartPreacc();
+        AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
+        AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
+        AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+
+          /*--- Calculate the interface left gradient, delta- (dm) ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+          
+          if (dm == 0.0) { limiter = 2.0; }
+          else {
+            if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+            else dp = node[iPoint]->GetSolution_Min(iVar);
+            limiter = dp/dm;
+          }
+          
+          if (limiter < node[iPoint]->GetLimiter_Primitive(iVar)) {
+            node[iPoint]->SetLimiter_Primitive(iVar, limiter);
+            AD::SetPreaccOut(node[iPoint]->GetLimiter_Primitive()[iVar]);
+          }
+          
+          /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+          
+          if (dm == 0.0) { limiter = 2.0; }
+          else {
+            if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
+            else dp = node[jPoint]->GetSolution_Min(iVar);
+            limiter = dp/dm;
+          }
+          
+          if (limiter < node[jPoint]->GetLimiter_Primitive(iVar)) {
+            node[jPoint]->SetLimiter_Primitive(iVar, limiter);
+            AD::SetPreaccOut(node[jPoint]->GetLimiter_Primitive()[iVar]);
+          }
+          
         }
         
-      }
-      
-      AD::EndPreacc();
+        AD::EndPreacc();
 
+      }
     }
     
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, y, limiter) schedule(static)
+#endif
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         y =  node[iPoint]->GetLimiter_Primitive(iVar);
@@ -6782,8 +6754,9 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     
     /*--- Allocate memory for the max and min primitive value --*/
     
-    LocalMinPrimitive = new su2double [nPrimVarGrad]; GlobalMinPrimitive = new su2double [nPrimVarGrad];
-    LocalMaxPrimitive = new su2double [nPrimVarGrad]; GlobalMaxPrimitive = new su2double [nPrimVarGrad];
+    Scratch->Push();
+    LocalMinPrimitive = Scratch->GetVector(nPrimVarGrad); GlobalMinPrimitive = Scratch->GetVector(nPrimVarGrad);
+    LocalMaxPrimitive = Scratch->GetVector(nPrimVarGrad); GlobalMaxPrimitive = Scratch->GetVector(nPrimVarGrad);
     
     /*--- Compute the max value and min value of the solution ---*/
     
@@ -6803,99 +6776,310 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
         LocalMinPrimitive[iVar] = min (LocalMinPrimitive[iVar], Primitive[iVar]);
         LocalMaxPrimitive[iVar] = max (LocalMaxPrimitive[iVar], Primitive[iVar]);
       }
-      
-    }
-    
-#ifdef HAVE_MPI
-    SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-#else
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      GlobalMinPrimitive[iVar] = LocalMinPrimitive[iVar];
-      GlobalMaxPrimitive[iVar] = LocalMaxPrimitive[iVar];
+      
+    }
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      GlobalMinPrimitive[iVar] = LocalMinPrimitive[iVar];
+      GlobalMaxPrimitive[iVar] = LocalMaxPrimitive[iVar];
+    }
+#endif
+    
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Gradient_i, Gradient_j, Coord_i, Coord_j, iVar, iDim, eps1, eps2, dm, dp, limiter)
+#endif
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+        
+        iPoint     = geometry->edge[iEdge]->GetNode(0);
+        jPoint     = geometry->edge[iEdge]->GetNode(1);
+        Gradient_i = node[iPoint]->GetGradient_Primitive();
+        Gradient_j = node[jPoint]->GetGradient_Primitive();
+        Coord_i    = geometry->node[iPoint]->GetCoord();
+        Coord_j    = geometry->node[jPoint]->GetCoord();
+        
+        AD::StartPreacc();
+        AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
+        AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
+        AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+        AD::SetPreaccIn(eps2);
+
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          
+          if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+            eps1 = LimK * (GlobalMaxPrimitive[iVar] - GlobalMinPrimitive[iVar]);
+            eps2 = eps1*eps1;
+          }
+          else {
+            eps1 = LimK*dave;
+            eps2 = eps1*eps1*eps1;
+          }
+
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+
+          /*--- Calculate the interface left gradient, delta- (dm) ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+          
+          /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+          
+          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+          else dp = node[iPoint]->GetSolution_Min(iVar);
+          
+          limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+          
+          if (limiter < node[iPoint]->GetLimiter_Primitive(iVar)) {
+            node[iPoint]->SetLimiter_Primitive(iVar, limiter);
+            AD::SetPreaccOut(node[iPoint]->GetLimiter_Primitive()[iVar]);
+          }
+          
+          /*-- Repeat for point j on the edge ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+          
+          if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
+          else dp = node[jPoint]->GetSolution_Min(iVar);
+          
+          limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+          
+          if (limiter < node[jPoint]->GetLimiter_Primitive(iVar)) {
+            node[jPoint]->SetLimiter_Primitive(iVar, limiter);
+            AD::SetPreaccOut(node[jPoint]->GetLimiter_Primitive()[iVar]);
+          }
+          
+        }
+
+        AD::EndPreacc();
+        
+      }
+    }
+    
+    Scratch->Pop();
+    
+  }
+
+  /*--- Limiter MPI ---*/
+  
+  Set_MPI_Primitive_Limiter(geometry, config);
+
+}
+
+void CEulerSolver::SetPrimitive_Gradient_GG_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint, jPoint, iEdge, iEdge_Loop, iColor, iVertex;
+  unsigned short iDim, iVar, iMarker, iNeigh;
+  unsigned short Kind_Limiter = config->GetKind_SlopeLimit_Flow();
+  su2double *Primitive, *Primitive_i, *Primitive_j, PrimVar_Average, Partial_Res, *Normal,
+  **Gradient_i, *Coord_i, *Coord_j, Volume, *LocalMinPrimitive = NULL, *LocalMaxPrimitive = NULL,
+  *GlobalMinPrimitive = NULL, *GlobalMaxPrimitive = NULL, dave, LimK, eps1, eps2, dm, dp, du, y, limiter;
+  
+  dave = config->GetRefElemLength();
+  LimK = config->GetVenkat_LimiterCoeff();
+  
+  /*--- Set Gradient_Primitive to zero, and initialize the neighbor bounds
+   and the limiter in the entire domain ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar) schedule(static)
+#endif
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (iPoint < nPointDomain) node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      node[iPoint]->SetSolution_Max(iVar, -EPS);
+      node[iPoint]->SetSolution_Min(iVar, EPS);
+      node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
+    }
+  }
+  
+  /*--- The Wang variant of the Venkatakrishnan limiter is scaled by the global range of the primitives ---*/
+  
+  if (Kind_Limiter == VENKATAKRISHNAN_WANG) {
+    
+    Scratch->Push();
+    LocalMinPrimitive = Scratch->GetVector(nPrimVarGrad); GlobalMinPrimitive = Scratch->GetVector(nPrimVarGrad);
+    LocalMaxPrimitive = Scratch->GetVector(nPrimVarGrad); GlobalMaxPrimitive = Scratch->GetVector(nPrimVarGrad);
+    
+    Primitive = node[0]->GetPrimitive();
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      LocalMinPrimitive[iVar] = Primitive[iVar];
+      LocalMaxPrimitive[iVar] = Primitive[iVar];
+    }
+    
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Primitive = node[iPoint]->GetPrimitive();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        LocalMinPrimitive[iVar] = min (LocalMinPrimitive[iVar], Primitive[iVar]);
+        LocalMaxPrimitive[iVar] = max (LocalMaxPrimitive[iVar], Primitive[iVar]);
+      }
+    }
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      GlobalMinPrimitive[iVar] = LocalMinPrimitive[iVar];
+      GlobalMaxPrimitive[iVar] = LocalMaxPrimitive[iVar];
+    }
+#endif
+    
+  }
+  
+  /*--- Single sweep of the interior edges, by colors, that accumulates the Green-Gauss
+   fluxes and the max & min values of the neighbor variables (Spekreijse bounds) ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Primitive_i, Primitive_j, Normal, iVar, iDim, PrimVar_Average, Partial_Res, du)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Primitive_i = node[iPoint]->GetPrimitive();
+      Primitive_j = node[jPoint]->GetPrimitive();
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        
+        PrimVar_Average =  0.5 * ( Primitive_i[iVar] + Primitive_j[iVar] );
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Partial_Res = PrimVar_Average*Normal[iDim];
+          if (geometry->node[iPoint]->GetDomain())
+            node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
+          if (geometry->node[jPoint]->GetDomain())
+            node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+        }
+        
+        du = (Primitive_j[iVar] - Primitive_i[iVar]);
+        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+        
+      }
+    }
+  }
+  
+  /*--- Loop boundary edges ---*/
+  
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY &&
+        config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)
+    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      if (geometry->node[iPoint]->GetDomain()) {
+        Primitive = node[iPoint]->GetPrimitive();
+        Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Partial_Res = Primitive[iVar]*Normal[iDim];
+            node[iPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+          }
+      }
     }
+  }
+  
+  /*--- Single sweep of the owned points that scales the gradient by the volume and
+   limits it against the neighbor bounds, the halo values come with the exchange below ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iNeigh, jPoint, Gradient_i, Coord_i, Coord_j, Volume, iVar, iDim, eps1, eps2, dm, dp, y, limiter) schedule(static)
 #endif
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    Gradient_i = node[iPoint]->GetGradient_Primitive();
+    Coord_i    = geometry->node[iPoint]->GetCoord();
+    Volume     = geometry->node[iPoint]->GetVolume();
+    
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Gradient_i[iVar][iDim] = Gradient_i[iVar][iDim] / Volume;
+    
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+      if (Kind_Limiter == VENKATAKRISHNAN_WANG) {
+        eps1 = LimK * (GlobalMaxPrimitive[iVar] - GlobalMinPrimitive[iVar]);
+        eps2 = eps1*eps1;
+      }
+      else {
+        eps1 = LimK*dave;
+        eps2 = eps1*eps1*eps1;
+      }
       
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-      AD::SetPreaccIn(eps2);
-
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        
+        jPoint  = geometry->node[iPoint]->GetPoint(iNeigh);
+        Coord_j = geometry->node[jPoint]->GetCoord();
         
-        if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
-          eps1 = LimK * (GlobalMaxPrimitive[iVar] - GlobalMinPrimitive[iVar]);
-          eps2 = eps1*eps1;
-        }
-        else {
-          eps1 = LimK*dave;
-          eps2 = eps1*eps1*eps1;
-        }
-
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
-
         /*--- Calculate the interface left gradient, delta- (dm) ---*/
         
         dm = 0.0;
         for (iDim = 0; iDim < nDim; iDim++)
           dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
         
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-        else dp = node[iPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[iPoint]->GetLimiter_Primitive(iVar)) {
-          node[iPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter_Primitive()[iVar]);
+        if (Kind_Limiter == BARTH_JESPERSEN) {
+          if (dm == 0.0) { limiter = 2.0; }
+          else {
+            if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+            else dp = node[iPoint]->GetSolution_Min(iVar);
+            limiter = dp/dm;
+          }
         }
-        
-        /*-- Repeat for point j on the edge ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-        else dp = node[jPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[jPoint]->GetLimiter_Primitive(iVar)) {
-          node[jPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter_Primitive()[iVar]);
+        else {
+          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+          else dp = node[iPoint]->GetSolution_Min(iVar);
+          limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
         }
         
+        if (limiter < node[iPoint]->GetLimiter_Primitive(iVar))
+          node[iPoint]->SetLimiter_Primitive(iVar, limiter);
+        
+      }
+      
+      /*--- Venkatakrishnan modification of the Barth-Jespersen limiter ---*/
+      
+      if (Kind_Limiter == BARTH_JESPERSEN) {
+        y = node[iPoint]->GetLimiter_Primitive(iVar);
+        limiter = (y*y + 2.0*y) / (y*y + y + 2.0);
+        node[iPoint]->SetLimiter_Primitive(iVar, limiter);
       }
-
-      AD::EndPreacc();
       
     }
     
-    delete [] LocalMinPrimitive; delete [] GlobalMinPrimitive;
-    delete [] LocalMaxPrimitive; delete [] GlobalMaxPrimitive;
-    
   }
-
-  /*--- Limiter MPI ---*/
   
-  Set_MPI_Primitive_Limiter(geometry, config);
-
+  if (Kind_Limiter == VENKATAKRISHNAN_WANG) {
+    Scratch->Pop();
+  }
+  
+  /*--- Gradient and limiter MPI, in one exchange ---*/
+  
+  Set_MPI_Primitive_Gradient_Limiter(geometry, config);
+  
 }
 
 void CEulerSolver::SetPreconditioner(CConfig *config, unsigned long iPoint) {
@@ -8932,16 +9116,13 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
   
-  Normal = new su2double[nDim];
-  NormalArea = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
-  Velocity_i = new su2double[nDim];
-  Jacobian_b = new su2double*[nVar];
-  DubDu = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Jacobian_b[iVar] = new su2double[nVar];
-    DubDu[iVar] = new su2double[nVar];
-  }
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
+  NormalArea = Scratch->GetVector(nDim);
+  Velocity_b = Scratch->GetVector(nDim);
+  Velocity_i = Scratch->GetVector(nDim);
+  Jacobian_b = Scratch->GetMatrix(nVar, nVar);
+  DubDu = Scratch->GetMatrix(nVar, nVar);
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   
@@ -9082,16 +9263,7 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
     }
   }
   
-  delete [] Normal;
-  delete [] NormalArea;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  for (iVar = 0; iVar < nVar; iVar++) {
-    delete [] Jacobian_b[iVar];
-    delete [] DubDu[iVar];
-  }
-  delete [] Jacobian_b;
-  delete [] DubDu;
+  Scratch->Pop();
   
 }
 
@@ -9121,7 +9293,8 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
                      (config->GetKind_Solver() == DISC_ADJ_RANS))
                     && (config->GetKind_Turb_Model() == SST));
     
-  su2double *Normal = new su2double[nDim];
+  Scratch->Push();
+  su2double *Normal = Scratch->GetVector(nDim);
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   
@@ -9354,7 +9527,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   }
   
   /*--- Free locally allocated memory ---*/
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -9379,28 +9552,23 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
   
-  su2double *Normal, *FlowDirMix, TangVelocity, NormalVelocity;
-  Normal = new su2double[nDim];
+  su2double *Normal, TangVelocity, NormalVelocity;
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
 
-  Velocity_i = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
-  Velocity_e = new su2double[nDim];
-  FlowDirMix = new su2double[nDim];
-  Lambda_i = new su2double[nVar];
-  u_i = new su2double[nVar];
-  u_e = new su2double[nVar];
-  u_b = new su2double[nVar];
-  dw = new su2double[nVar];
+  Velocity_i = Scratch->GetVector(nDim);
+  Velocity_b = Scratch->GetVector(nDim);
+  Velocity_e = Scratch->GetVector(nDim);
+  Lambda_i = Scratch->GetVector(nVar);
+  u_i = Scratch->GetVector(nVar);
+  u_e = Scratch->GetVector(nVar);
+  u_b = Scratch->GetVector(nVar);
+  dw = Scratch->GetVector(nVar);
   
-  S_boundary = new su2double[8];
+  S_boundary = Scratch->GetVector(8);
   
-  P_Tensor = new su2double*[nVar];
-  invP_Tensor = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    P_Tensor[iVar] = new su2double[nVar];
-    invP_Tensor[iVar] = new su2double[nVar];
-  }
+  P_Tensor = Scratch->GetMatrix(nVar, nVar);
+  invP_Tensor = Scratch->GetMatrix(nVar, nVar);
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
@@ -9683,13 +9851,9 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
       
       if (implicit) {
         
-        Jacobian_b = new su2double*[nVar];
-        DubDu = new su2double*[nVar];
-        for (iVar = 0; iVar < nVar; iVar++)
-        {
-          Jacobian_b[iVar] = new su2double[nVar];
-          DubDu[iVar] = new su2double[nVar];
-        }
+        Scratch->Push();
+        Jacobian_b = Scratch->GetMatrix(nVar, nVar);
+        DubDu = Scratch->GetMatrix(nVar, nVar);
         
         /*--- Initialize DubDu to unit matrix---*/
         
@@ -9745,12 +9909,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
           }
         }
         
-        for (iVar = 0; iVar < nVar; iVar++) {
-          delete [] Jacobian_b[iVar];
-          delete [] DubDu[iVar];
-        }
-        delete [] Jacobian_b;
-        delete [] DubDu;
+        Scratch->Pop();
       }
       
       /*--- Update residual value ---*/
@@ -9828,28 +9987,8 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   }
   
   /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-  delete [] Velocity_e;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  delete [] FlowDirMix;
-  
-  delete [] S_boundary;
-  delete [] Lambda_i;
-  delete [] u_i;
-  delete [] u_e;
-  delete [] u_b;
-  delete [] dw;
-  
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    delete [] P_Tensor[iVar];
-    delete [] invP_Tensor[iVar];
-  }
-  delete [] P_Tensor;
-  delete [] invP_Tensor;
-  
+  Scratch->Pop();
+
 }
 
 
@@ -9878,30 +10017,26 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
       (config->GetKind_Turb_Model() == SST));
 
   su2double *Normal, *turboNormal, *UnitNormal, *FlowDirMix, FlowDirMixMag, *turboVelocity;
-  Normal = new su2double[nDim];
-  turboNormal 	= new su2double[nDim];
-  UnitNormal 	= new su2double[nDim];
-
-  Velocity_i = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
-  Velocity_e = new su2double[nDim];
-  turboVelocity = new su2double[nDim];
-  FlowDirMix = new su2double[nDim];
-  Lambda_i = new su2double[nVar];
-  u_i = new su2double[nVar];
-  u_e = new su2double[nVar];
-  u_b = new su2double[nVar];
-  dw = new su2double[nVar];
-
-  S_boundary = new su2double[8];
-
-  P_Tensor = new su2double*[nVar];
-  invP_Tensor = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    P_Tensor[iVar] = new su2double[nVar];
-    invP_Tensor[iVar] = new su2double[nVar];
-  }
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
+  turboNormal 	= Scratch->GetVector(nDim);
+  UnitNormal 	= Scratch->GetVector(nDim);
+
+  Velocity_i = Scratch->GetVector(nDim);
+  Velocity_b = Scratch->GetVector(nDim);
+  Velocity_e = Scratch->GetVector(nDim);
+  turboVelocity = Scratch->GetVector(nDim);
+  FlowDirMix = Scratch->GetVector(nDim);
+  Lambda_i = Scratch->GetVector(nVar);
+  u_i = Scratch->GetVector(nVar);
+  u_e = Scratch->GetVector(nVar);
+  u_b = Scratch->GetVector(nVar);
+  dw = Scratch->GetVector(nVar);
+
+  S_boundary = Scratch->GetVector(8);
+
+  P_Tensor = Scratch->GetMatrix(nVar, nVar);
+  invP_Tensor = Scratch->GetMatrix(nVar, nVar);
 
   /*--- Loop over all the vertices on this boundary marker ---*/
   for (iSpan= 0; iSpan < nSpanWiseSections; iSpan++){
@@ -10178,13 +10313,9 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
 
         if (implicit) {
 
-          Jacobian_b = new su2double*[nVar];
-          DubDu = new su2double*[nVar];
-          for (iVar = 0; iVar < nVar; iVar++)
-          {
-            Jacobian_b[iVar] = new su2double[nVar];
-            DubDu[iVar] = new su2double[nVar];
-          }
+          Scratch->Push();
+          Jacobian_b = Scratch->GetMatrix(nVar, nVar);
+          DubDu = Scratch->GetMatrix(nVar, nVar);
 
           /*--- Initialize DubDu to unit matrix---*/
 
@@ -10240,12 +10371,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
             }
           }
 
-          for (iVar = 0; iVar < nVar; iVar++) {
-            delete [] Jacobian_b[iVar];
-            delete [] DubDu[iVar];
-          }
-          delete [] Jacobian_b;
-          delete [] DubDu;
+          Scratch->Pop();
         }
 
         /*--- Update residual value ---*/
@@ -10323,30 +10449,7 @@ void CEulerSolver::BC_TurboRiemann(CGeometry *geometry, CSolver **solver_contain
 }
 
   /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-  delete [] UnitNormal;
-  delete [] turboNormal;
-  delete [] turboVelocity;
-  delete [] Velocity_e;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  delete [] FlowDirMix;
-
-  delete [] S_boundary;
-  delete [] Lambda_i;
-  delete [] u_i;
-  delete [] u_e;
-  delete [] u_b;
-  delete [] dw;
-
-
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    delete [] P_Tensor[iVar];
-    delete [] invP_Tensor[iVar];
-  }
-  delete [] P_Tensor;
-  delete [] invP_Tensor;
+  Scratch->Pop();
 
 }
 
@@ -10359,11 +10462,12 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
   long iVertex, freq;
   unsigned short  iZone     = config->GetiZone();
   unsigned short nSpanWiseSections = geometry->GetnSpanWiseSections(marker_flag);
-  turboNormal 	= new su2double[nDim];
-  turboVelocity = new su2double[nDim];
-  Velocity_i 		= new su2double[nDim];
-  deltaprim     = new su2double[nVar];
-  cj				    = new su2double[nVar];
+  Scratch->Push();
+  turboNormal 	= Scratch->GetVector(nDim);
+  turboVelocity = Scratch->GetVector(nDim);
+  Velocity_i 		= Scratch->GetVector(nDim);
+  deltaprim     = Scratch->GetVector(nVar);
+  cj				    = Scratch->GetVector(nVar);
   complex<su2double> I, cktemp_inf,cktemp_out1, cktemp_out2, expArg;
   I = complex<su2double>(0.0,1.0);
 
@@ -10497,11 +10601,7 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
     }
   }
 
-  delete [] turboVelocity;
-  delete [] turboNormal;
-  delete [] Velocity_i;
-  delete [] deltaprim;
-  delete [] cj;
+  Scratch->Pop();
 
 }
 
@@ -10530,44 +10630,39 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container,
   su2double spanPercent, extrarelfacAvg = 0.0, deltaSpan = 0.0, relfacAvg, relfacFou, coeffrelfacAvg = 0.0;
   unsigned short Turbo_Flag;
 
-  Normal                = new su2double[nDim];
-  turboNormal 	        = new su2double[nDim];
-  UnitNormal            = new su2double[nDim];
-  turboVelocity         = new su2double[nDim];
-  Velocity_i            = new su2double[nDim];
-  Velocity_b            = new su2double[nDim];
+  Scratch->Push();
+  Normal                = Scratch->GetVector(nDim);
+  turboNormal 	        = Scratch->GetVector(nDim);
+  UnitNormal            = Scratch->GetVector(nDim);
+  turboVelocity         = Scratch->GetVector(nDim);
+  Velocity_i            = Scratch->GetVector(nDim);
+  Velocity_b            = Scratch->GetVector(nDim);
 
 
   su2double AverageSoundSpeed, *AverageTurboMach, AverageEntropy, AverageEnthalpy;
-  AverageTurboMach = new su2double[nDim];
-  S_boundary       = new su2double[8];
+  AverageTurboMach = Scratch->GetVector(nDim);
+  S_boundary       = Scratch->GetVector(8);
 
   su2double  AvgMach , *cj, GilesBeta, *delta_c, **R_Matrix, *deltaprim, **R_c_inv,**R_c, alphaIn_BC, gammaIn_BC = 0,
       P_Total, T_Total, *FlowDir, Enthalpy_BC, Entropy_BC, *R, *c_avg,*dcjs, Beta_inf2, c2js_Re, c3js_Re, cOutjs_Re, avgVel2 =0.0;
 
   long freq;
 
-  delta_c       = new su2double[nVar];
-  deltaprim     = new su2double[nVar];
-  cj            = new su2double[nVar];
-  R_Matrix      = new su2double*[nVar];
-  R_c           = new su2double*[nVar-1];
-  R_c_inv       = new su2double*[nVar-1];
-  R             = new su2double[nVar-1];
-  c_avg         = new su2double[nVar];
-  dcjs          = new su2double[nVar];
+  delta_c       = Scratch->GetVector(nVar);
+  deltaprim     = Scratch->GetVector(nVar);
+  cj            = Scratch->GetVector(nVar);
+  R_Matrix      = Scratch->GetMatrix(nVar, nVar);
+  R_c           = Scratch->GetMatrix(nVar-1, nVar-1);
+  R_c_inv       = Scratch->GetMatrix(nVar-1, nVar-1);
+  R             = Scratch->GetVector(nVar-1);
+  c_avg         = Scratch->GetVector(nVar);
+  dcjs          = Scratch->GetVector(nVar);
 
   for (iVar = 0; iVar < nVar; iVar++)
   {
-    R_Matrix[iVar] = new su2double[nVar];
     c_avg[iVar]    =  0.0;
     dcjs[iVar]     =  0.0;
   }
-  for (iVar = 0; iVar < nVar-1; iVar++)
-  {
-    R_c[iVar] = new su2double[nVar-1];
-    R_c_inv[iVar] = new su2double[nVar-1];
-  }
 
 
   complex<su2double> I, c2ks, c2js, c3ks, c3js, c4ks, c4js, cOutks, cOutjs, Beta_inf;
@@ -11207,35 +11302,8 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container,
   }
   
   /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-  
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  
-  delete [] S_boundary;
-  delete []	delta_c;
-  delete []	deltaprim;
-  delete []	cj;
-  for (iVar = 0; iVar < nVar; iVar++)
-  {
-    delete [] R_Matrix[iVar];
-  }
-  for (iVar = 0; iVar < nVar-1; iVar++)
-  {
-    delete [] R_c_inv[iVar];
-    delete [] R_c[iVar];
-  }
-  delete [] R_Matrix;
-  delete [] R_c;
-  delete [] R_c_inv;
-  delete [] R;
-  delete [] c_avg;
-  delete [] dcjs;
+  Scratch->Pop();
 
-  delete [] AverageTurboMach;
-  delete [] UnitNormal;
-  delete [] turboNormal;
-  delete [] turboVelocity;
 }
 
 void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
@@ -11255,7 +11323,8 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
-  su2double *Normal = new su2double[nDim];
+  Scratch->Push();
+  su2double *Normal = Scratch->GetVector(nDim);
     
   /*--- Loop over all the vertices on this boundary marker ---*/
   
@@ -11532,7 +11601,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   
   /*--- Free locally allocated memory ---*/
   
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -11552,7 +11621,8 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   bool gravity = (config->GetGravityForce());
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
-  su2double *Normal = new su2double[nDim];
+  Scratch->Push();
+  su2double *Normal = Scratch->GetVector(nDim);
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
@@ -11701,7 +11771,7 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   }
   
   /*--- Free locally allocated memory ---*/
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -11719,8 +11789,9 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
-  su2double *Normal = new su2double[nDim];
-  su2double *Velocity = new su2double[nDim];
+  Scratch->Push();
+  su2double *Normal = Scratch->GetVector(nDim);
+  su2double *Velocity = Scratch->GetVector(nDim);
   
   /*--- Supersonic inlet flow: there are no outgoing characteristics,
    so all flow variables can be imposed at the inlet.
@@ -11840,7 +11911,7 @@ void CEulerSolver::BC_Supersonic_Inlet(CGeometry *geometry, CSolver **solver_con
   
   /*--- Free locally allocated memory ---*/
   
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -11854,7 +11925,8 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   bool grid_movement  = config->GetGrid_Movement();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   
-  su2double *Normal = new su2double[nDim];
+  Scratch->Push();
+  su2double *Normal = Scratch->GetVector(nDim);
   
   /*--- Supersonic outlet flow: there are no ingoing characteristics,
    so all flow variables can should be interpolated from the domain. ---*/
@@ -11954,7 +12026,7 @@ void CEulerSolver::BC_Supersonic_Outlet(CGeometry *geometry, CSolver **solver_co
   
   /*--- Free locally allocated memory ---*/
   
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -15379,6 +15451,12 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   Secondary   = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary[iVar]   = 0.0;
   Secondary_i = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_i[iVar] = 0.0;
   Secondary_j = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_j[iVar] = 0.0;
+  
+  /*--- Batch of edges for the vectorized convective fluxes, the discrete
+   adjoint records the scalar path ---*/
+  
+  if (config->GetFlux_Batch_Flow() && !config->GetDiscrete_Adjoint())
+    FluxBatch = new CFluxBatch();
 
   /*--- Define some auxiliar vector related with the undivided lapalacian computation ---*/
   
@@ -15836,10 +15914,14 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     }
   }
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- Initialize the solution to the far-field state everywhere, the fields
+   of all the points are stored contiguously (one block per field). ---*/
 
+  node_storage = new CVariableStorage(nPoint);
+  CVariable::SetStorage(node_storage);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CNSVariable(Density_Inf, Velocity_Inf, Energy_Inf, nDim, nVar, config);
+  CVariable::SetStorage(NULL);
 
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
@@ -15999,8 +16081,21 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   bool nearfield            = (config->GetnMarker_NearFieldBound() != 0);
   bool interface            = (config->GetnMarker_InterfaceBound() != 0);
   bool van_albada           = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
+  bool fused_limiter        = ((config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) || (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN) ||
+                               (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG)) && !disc_adjoint;
   unsigned short kind_row_dissipation = config->GetKind_RoeLowDiss();
   bool roe_low_dissipation  = (kind_row_dissipation != NO_ROELOWDISS) && (config->GetKind_Upwind_Flow() == ROE);
+  bool upwind               = (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND);
+  
+  /*--- Exchanges left in flight by a previous preprocessing whose residual was not computed ---*/
+  
+  Complete_MPI_Pending(geometry, config);
+  
+  /*--- The exchanges of the gradients and limiters may stay in flight until the
+   upwind residual has computed the interior edges (the vorticity of the received
+   points is computed then, see Complete_MPI_Pending) ---*/
+  
+  Halo_Overlap = Halo_Overlap && upwind && (iMesh == MESH_0) && !Output && !cont_adjoint && !disc_adjoint && !roe_low_dissipation;
 
   /*--- Update the angle of attack at the far-field for fixed CL calculations. ---*/
   
@@ -16048,22 +16143,37 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     }
   }
   
-  /*--- Compute gradient of the primitive variables ---*/
+  /*--- Green-Gauss gradient and limiter computed together in one sweep of the edges
+   on the fine grid, the coarse grids only need the gradient ---*/
   
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+  if ((config->GetKind_Gradient_Method() == GREEN_GAUSS) && (iMesh == MESH_0) && !Output && fused_limiter &&
+      (limiter_flow || limiter_turb || limiter_adjflow)) {
+    SetPrimitive_Gradient_GG_Limiter(geometry, config);
   }
-  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+  else {
+    
+    /*--- Compute gradient of the primitive variables ---*/
+    
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
+    
+    /*--- Compute the limiter in case we need it in the turbulence model
+     or to limit the viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
+    
+    if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow)
+        && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
+    
   }
-
-  /*--- Compute the limiter in case we need it in the turbulence model
-   or to limit the viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
-
-  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow)
-      && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
   
-  /*--- Evaluate the vorticity and strain rate magnitude ---*/
+  Halo_Overlap = false;
+  
+  /*--- Evaluate the vorticity and strain rate magnitude, the maximum is taken over
+   the domain points (the received ones are copies of points of other ranks and
+   may still be waiting for their gradients) ---*/
   
   StrainMag_Max = 0.0; Omega_Max = 0.0;
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
@@ -16071,6 +16181,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     solver_container[FLOW_SOL]->node[iPoint]->SetVorticity();
     solver_container[FLOW_SOL]->node[iPoint]->SetStrainMag();
     
+    if (!geometry->node[iPoint]->GetDomain()) continue;
+    
     StrainMag = solver_container[FLOW_SOL]->node[iPoint]->GetStrainMag();
     Vorticity = solver_container[FLOW_SOL]->node[iPoint]->GetVorticity();
     Omega = sqrt(Vorticity[0]*Vorticity[0]+ Vorticity[1]*Vorticity[1]+ Vorticity[2]*Vorticity[2]);
@@ -16108,6 +16220,27 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   
 }
 
+void CNSSolver::Complete_MPI_Pending(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iRecv, iPoint, nRecv;
+  bool pending = (Pending_Primitive_Gradient || Pending_Primitive_Gradient_Limiter);
+  
+  CEulerSolver::Complete_MPI_Pending(geometry, config);
+  
+  /*--- The preprocessing computed the vorticity of the received points with
+   their old gradients ---*/
+  
+  if (pending) {
+    nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+    for (iRecv = 0; iRecv < nRecv; iRecv++) {
+      iPoint = geometry->GetHalo_Recv_Point(iRecv);
+      node[iPoint]->SetVorticity();
+      node[iPoint]->SetStrainMag();
+    }
+  }
+  
+}
+
 unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
   
   unsigned long iPoint, ErrorCounter = 0;
@@ -16117,6 +16250,11 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
   
   bool tkeNeeded            = (turb_model == SST);
 
+  /*--- The points are independent, each thread evaluates the fluid model with its own copy ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel for firstprivate(eddy_visc, turb_ke, DES_LengthScale) private(RightSol) reduction(+:ErrorCounter) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Retrieve the value of the kinetic energy (if need it) ---*/
@@ -16136,8 +16274,8 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
     
     /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
     
-    RightSol = node[iPoint]->SetPrimVar(eddy_visc, turb_ke, FluidModel);
-    node[iPoint]->SetSecondaryVar(FluidModel);
+    RightSol = node[iPoint]->SetPrimVar(eddy_visc, turb_ke, FluidModel_Thread[omp_get_thread_num()]);
+    node[iPoint]->SetSecondaryVar(FluidModel_Thread[omp_get_thread_num()]);
 
     if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
         
@@ -16157,8 +16295,9 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CCon
 void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned long Iteration) {
   
   su2double *Normal, Area, Vol, Mean_SoundSpeed = 0.0, Mean_ProjVel = 0.0, Lambda, Local_Delta_Time, Local_Delta_Time_Visc,
-  Global_Delta_Time = 1E6, Mean_LaminarVisc = 0.0, Mean_EddyVisc = 0.0, Mean_Density = 0.0, Lambda_1, Lambda_2, K_v = 0.25, Global_Delta_UnstTimeND;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
+  Global_Delta_Time = 1E6, Mean_LaminarVisc = 0.0, Mean_EddyVisc = 0.0, Mean_Density = 0.0, Lambda_1, Lambda_2, K_v = 0.25, Global_Delta_UnstTimeND,
+  Min_Delta = 1.E6, Max_Delta = 0.0;
+  unsigned long iEdge, iEdge_Loop, iColor, iVertex, iPoint = 0, jPoint = 0;
   unsigned short iDim, iMarker;
   su2double ProjVel, ProjVel_i, ProjVel_j;
   
@@ -16167,65 +16306,77 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
-  
   /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed and viscosity ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     node[iPoint]->SetMax_Lambda_Inv(0.0);
     node[iPoint]->SetMax_Lambda_Visc(0.0);
   }
   
-  /*--- Loop interior edges ---*/
+  /*--- Loop interior edges, by colors (the edges of a color share no point) ---*/
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Point identification, Normal vector and area ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
-    
-    /*--- Mean Values ---*/
-    
-    Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
-    Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
-    
-    /*--- Adjustment for grid movement ---*/
-    
-    if (grid_movement) {
-      su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-      su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j =0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Normal, Area, iDim, Mean_ProjVel, Mean_SoundSpeed, ProjVel_i, ProjVel_j, Lambda, Mean_LaminarVisc, Mean_EddyVisc, Mean_Density, Lambda_1, Lambda_2)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+      
+      /*--- Point identification, Normal vector and area ---*/
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      Area = 0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      
+      /*--- Mean Values ---*/
+      
+      Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
+      Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
+      
+      /*--- Adjustment for grid movement ---*/
+      
+      if (grid_movement) {
+        su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
+        su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+        ProjVel_i = 0.0; ProjVel_j =0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          ProjVel_i += GridVel_i[iDim]*Normal[iDim];
+          ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+        }
+        Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j) ;
       }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j) ;
+      
+      /*--- Inviscid contribution ---*/
+      
+      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed ;
+      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
+      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
+      
+      /*--- Viscous contribution ---*/
+      
+      Mean_LaminarVisc = 0.5*(node[iPoint]->GetLaminarViscosity() + node[jPoint]->GetLaminarViscosity());
+      Mean_EddyVisc    = 0.5*(node[iPoint]->GetEddyViscosity() + node[jPoint]->GetEddyViscosity());
+      Mean_Density     = 0.5*(node[iPoint]->GetSolution(0) + node[jPoint]->GetSolution(0));
+      
+      Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
+      //TODO (REAL_GAS) removing Gamma it cannot work with FLUIDPROP
+      Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
+      Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
+      
+      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Visc(Lambda);
+      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Visc(Lambda);
+      
     }
-    
-    /*--- Inviscid contribution ---*/
-    
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed ;
-    if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
-    if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
-    
-    /*--- Viscous contribution ---*/
-    
-    Mean_LaminarVisc = 0.5*(node[iPoint]->GetLaminarViscosity() + node[jPoint]->GetLaminarViscosity());
-    Mean_EddyVisc    = 0.5*(node[iPoint]->GetEddyViscosity() + node[jPoint]->GetEddyViscosity());
-    Mean_Density     = 0.5*(node[iPoint]->GetSolution(0) + node[jPoint]->GetSolution(0));
-    
-    Lambda_1 = (4.0/3.0)*(Mean_LaminarVisc + Mean_EddyVisc);
-    //TODO (REAL_GAS) removing Gamma it cannot work with FLUIDPROP
-    Lambda_2 = (1.0 + (Prandtl_Lam/Prandtl_Turb)*(Mean_EddyVisc/Mean_LaminarVisc))*(Gamma*Mean_LaminarVisc/Prandtl_Lam);
-    Lambda = (Lambda_1 + Lambda_2)*Area*Area/Mean_Density;
-    
-    if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Visc(Lambda);
-    if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Visc(Lambda);
-    
   }
   
   /*--- Loop boundary edges ---*/
@@ -16279,7 +16430,9 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
   
   /*--- Each element uses their own speed, steady state simulation ---*/
   
-  
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Vol, Local_Delta_Time, Local_Delta_Time_Visc) reduction(min:Global_Delta_Time, Min_Delta) reduction(max:Max_Delta) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
     Vol = geometry->node[iPoint]->GetVolume();
@@ -16289,8 +16442,8 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
       Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ node[iPoint]->GetMax_Lambda_Visc();
       Local_Delta_Time = min(Local_Delta_Time, Local_Delta_Time_Visc);
       Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
+      Min_Delta = min(Min_Delta, Local_Delta_Time);
+      Max_Delta = max(Max_Delta, Local_Delta_Time);
       if (Local_Delta_Time > config->GetMax_DeltaTime())
         Local_Delta_Time = config->GetMax_DeltaTime();
       node[iPoint]->SetDelta_Time(Local_Delta_Time);
@@ -16301,6 +16454,7 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
     
   }
   
+  Min_Delta_Time = Min_Delta; Max_Delta_Time = Max_Delta;
   
   /*--- Compute the max and the min dt (in parallel) ---*/
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
@@ -16347,63 +16501,83 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
   }
   
   /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
-  if (dual_time)
+  if (dual_time) {
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Local_Delta_Time) schedule(static)
+#endif
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
       if (!implicit) {
         Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), node[iPoint]->GetDelta_Time());
         node[iPoint]->SetDelta_Time(Local_Delta_Time);
       }
     }
+  }
   
 }
 
 void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iPoint, jPoint, iEdge;
-  
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points, coordinates and normal vector in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive and secondary variables ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
-    
-    /*--- Gradient and limiters ---*/
-    
-    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
-    
-    /*--- Turbulent kinetic energy ---*/
-    
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
-                                     solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
-    
-    /*--- Compute and update residual ---*/
-    
-    numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
-    
-    LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    LinSysRes.AddBlock(jPoint, Res_Visc);
+  /*--- Loop over the edges by colors, the threads add their fluxes without conflicts ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(nThread_Edge)
+#endif
+  {
+    unsigned long iColor, iEdge, iEdge_Loop, iPoint, jPoint;
+    unsigned short iThread = omp_get_thread_num();
     
-    /*--- Implicit part ---*/
+    CNumerics *edge_numerics = (iThread == 0? numerics : EdgeWork[iThread]->Numerics[VISC_TERM]);
+    su2double *Res = (iThread == 0? Res_Visc : EdgeWork[iThread]->Residual);
+    su2double **Jac_i = (iThread == 0? Jacobian_i : EdgeWork[iThread]->Jacobian_i);
+    su2double **Jac_j = (iThread == 0? Jacobian_j : EdgeWork[iThread]->Jacobian_j);
     
-    if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+        
+        /*--- Points, coordinates and normal vector in edge ---*/
+        
+        iPoint = geometry->GetEdge_Node(iEdge, 0);
+        jPoint = geometry->GetEdge_Node(iEdge, 1);
+        edge_numerics->SetCoord(geometry->GetPoint_Coord(iPoint), geometry->GetPoint_Coord(jPoint));
+        edge_numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+        
+        /*--- Primitive and secondary variables ---*/
+        
+        edge_numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+        edge_numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
+        
+        /*--- Gradient and limiters ---*/
+        
+        edge_numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
+        
+        /*--- Turbulent kinetic energy ---*/
+        
+        if (config->GetKind_Turb_Model() == SST)
+          edge_numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                              solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+        
+        /*--- Compute and update residual ---*/
+        
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
+        
+        LinSysRes.UpdateBlocksSub(iPoint, jPoint, Res);
+        
+        /*--- Implicit part ---*/
+        
+        if (implicit) {
+          Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+        }
+        
+      }
     }
-    
   }
   
 }
@@ -16791,18 +16965,19 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   
   /*--- Add the forces on the surfaces using all the nodes ---*/
   
-  MySurface_CL_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Visc       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_HF_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_MaxHF_Visc      = new su2double[config->GetnMarker_Monitoring()];
+  Scratch->Push();
+  MySurface_CL_Visc         = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CD_Visc         = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CSF_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CEff_Visc       = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFx_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFy_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CFz_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMx_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMy_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_CMz_Visc        = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_HF_Visc         = Scratch->GetVector(config->GetnMarker_Monitoring());
+  MySurface_MaxHF_Visc      = Scratch->GetVector(config->GetnMarker_Monitoring());
   
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
     
@@ -16847,10 +17022,7 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   SU2_MPI::Allreduce(MySurface_HF_Visc, Surface_HF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   SU2_MPI::Allreduce(MySurface_MaxHF_Visc, Surface_MaxHF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
-  delete [] MySurface_CL_Visc; delete [] MySurface_CD_Visc; delete [] MySurface_CSF_Visc;
-  delete [] MySurface_CEff_Visc;  delete [] MySurface_CFx_Visc;   delete [] MySurface_CFy_Visc;
-  delete [] MySurface_CFz_Visc;   delete [] MySurface_CMx_Visc;   delete [] MySurface_CMy_Visc;
-  delete [] MySurface_CMz_Visc;   delete [] MySurface_HF_Visc; delete [] MySurface_MaxHF_Visc;
+  Scratch->Pop();
   
 #endif
   
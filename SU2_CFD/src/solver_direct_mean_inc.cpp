@@ -2681,10 +2681,7 @@ void CIncEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_co
     /*--- Store implicit contributions from the residual calculation. ---*/
     
     if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     }
   }
   
@@ -2791,10 +2788,7 @@ void CIncEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_cont
     /*--- Set implicit Jacobians ---*/
     
     if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+      Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     }
   }
   
@@ -4184,8 +4178,7 @@ void CIncEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
   
   /*--- Solve or smooth the linear system ---*/
   
-  CSysSolve system;
-  IterLinSol = system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
   
   /*--- The the number of iterations of the linear solver ---*/
   
@@ -4294,9 +4287,43 @@ void CIncEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *con
   unsigned short iVar, iDim, jDim, iNeigh;
   unsigned long iPoint, jPoint;
   su2double *PrimVar_i, *PrimVar_j, *Coord_i, *Coord_j, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2;
+  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2, **Gradient, *Weight, Delta;
   bool singular;
   
+  /*--- The weights of the neighbors only depend on the grid and are stored in the
+   geometry, the gradient is then a single sweep over the neighbors of each point.
+   The discrete adjoint builds the matrices below to record the coordinates. ---*/
+  
+  if (!config->GetDiscrete_Adjoint()) {
+    
+    if (!geometry->GetLSGradient_Weights_Valid()) geometry->SetLSGradient_Weights();
+    
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, iDim, iNeigh, jPoint, PrimVar_i, PrimVar_j, Gradient, Weight, Delta) schedule(static)
+#endif
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      PrimVar_i = node[iPoint]->GetPrimitive();
+      Gradient = node[iPoint]->GetGradient_Primitive();
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Gradient[iVar][iDim] = 0.0;
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        PrimVar_j = node[jPoint]->GetPrimitive();
+        Weight = geometry->GetLSGradient_Weight(iPoint, iNeigh);
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          Delta = PrimVar_j[iVar]-PrimVar_i[iVar];
+          for (iDim = 0; iDim < nDim; iDim++)
+            Gradient[iVar][iDim] += Weight[iDim]*Delta;
+        }
+      }
+    }
+    
+    Set_MPI_Primitive_Gradient(geometry, config);
+    return;
+    
+  }
+  
   /*--- Incompressible flow, primitive variables nDim+4, (P, vx, vy, vz, T, rho, beta) ---*/
   
   /*--- Loop over points of the grid ---*/
@@ -7698,10 +7725,7 @@ void CIncNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
     /*--- Implicit part ---*/
     
     if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     }
     
   }
@@ -91,529 +91,353 @@ CTurbSolver::~CTurbSolver(void) {
 }
 
 void CTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, nBufferS_Scalar, nBufferR_Scalar;
-  su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL, *Buffer_Receive_muT = NULL, *Buffer_Send_muT = NULL;
+  unsigned short iVar, nCount = nVar+1;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, nCount);
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
   
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      nBufferS_Scalar = nVertexS;             nBufferR_Scalar = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      Buffer_Receive_muT = new su2double [nBufferR_Scalar];
-      Buffer_Send_muT = new su2double[nBufferS_Scalar];
-      
-      /*--- Copy the solution that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_muT[iVertex] = node[iPoint]->GetmuT();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_muT, nBufferS_Scalar, MPI_DOUBLE, send_to, 1,
-                   Buffer_Receive_muT, nBufferR_Scalar, MPI_DOUBLE, receive_from, 1, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        Buffer_Receive_muT[iVertex] = node[iPoint]->GetmuT();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      delete [] Buffer_Send_muT;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy conservative variables. ---*/
-        node[iPoint]->SetmuT(Buffer_Receive_muT[iVertex]);
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Buffer_Receive_U[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_muT;
-      delete [] Buffer_Receive_U;
-      
-    }
-    
+  /*--- Copy the solution and the eddy viscosity that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nCount+iVar] = node[iPoint]->GetSolution(iVar);
+    Buffer[iSend*nCount+nVar] = node[iPoint]->GetmuT();
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Copy conservative variables. ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetSolution(iVar, Buffer[iRecv*nCount+iVar]);
+    node[iPoint]->SetmuT(Buffer[iRecv*nCount+nVar]);
   }
   
 }
 
 void CTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  unsigned short iVar;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar);
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Buffer_Receive_U[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the solution old that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nVar+iVar] = node[iPoint]->GetSolution_Old(iVar);
   }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetSolution_Old(iVar, Buffer[iRecv*nVar+iVar]);
+  }
+  
 }
 
 void CTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  unsigned short iVar, iDim, jDim;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer, *Value, *rotMatrix, Gradient;
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
- 
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar*nDim;        nBufferR_Vector = nVertexR*nVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar*nDim);
+  
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
+  
+  /*--- Copy the gradient that should be sended ---*/
+  
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Buffer[(iSend*nVar+iVar)*nDim+iDim] = node[iPoint]->GetGradient(iVar, iDim);
+  }
+  
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  /*--- Need to rotate the gradients for all conserved variables. ---*/
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    rotMatrix = geometry->GetHalo_Rotation(iRecv);
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Value = &Buffer[(iRecv*nVar+iVar)*nDim];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Gradient = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          Gradient += rotMatrix[iDim*3+jDim]*Value[jDim];
+        node[iPoint]->SetGradient(iVar, iDim, Gradient);
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
     }
-    
   }
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
 }
 
 void CTurbSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
+  unsigned short iVar;
+  unsigned long iSend, iRecv, iPoint, nSend, nRecv;
+  su2double *Buffer;
   
-  su2double *Limiter = new su2double [nVar];
+  CHaloExchange *Halo = GetHalo(geometry, config, nVar);
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  nSend = geometry->GetHalo_Send_Begin(geometry->GetnHalo_Neighbor());
+  nRecv = geometry->GetHalo_Recv_Begin(geometry->GetnHalo_Neighbor());
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
+  /*--- Copy the limiter that should be sended ---*/
   
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Buffer_Receive_Limit[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
+  Buffer = Halo->GetBuffer_Send();
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetHalo_Send_Point(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer[iSend*nVar+iVar] = node[iPoint]->GetLimiter(iVar);
   }
   
-  delete [] Limiter;
+  /*--- Send/Receive information with all the neighbors at once ---*/
+  
+  Halo->Start();
+  Halo->Complete();
+  
+  Buffer = Halo->GetBuffer_Recv();
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iPoint = geometry->GetHalo_Recv_Point(iRecv);
+    for (iVar = 0; iVar < nVar; iVar++)
+      node[iPoint]->SetLimiter(iVar, Buffer[iRecv*nVar+iVar]);
+  }
   
 }
 
 
 void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
   
-  su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iDim, iVar;
-  
   bool muscl         = config->GetMUSCL_Turb();
   bool limiter       = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
   bool grid_movement = config->GetGrid_Movement();
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge and normal vectors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive variables w/o reconstruction ---*/
-    
-    V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
-    V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
-    numerics->SetPrimitive(V_i, V_j);
-    
-    /*--- Turbulent variables w/o reconstruction ---*/
+  /*--- Loop over the edges by colors, the threads add their fluxes without conflicts ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(nThread_Edge)
+#endif
+  {
+    su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
+    unsigned long iColor, iEdge, iEdge_Loop, iPoint, jPoint;
+    unsigned short iDim, iVar;
     
-    Turb_i = node[iPoint]->GetSolution();
-    Turb_j = node[jPoint]->GetSolution();
-    numerics->SetTurbVar(Turb_i, Turb_j);
+    /*--- Numerics and work arrays of the thread ---*/
     
-    /*--- Grid Movement ---*/
+    unsigned short iThread = omp_get_thread_num();
+    CEdgeWork *Work = (iThread == 0? NULL : EdgeWork[iThread]);
     
-    if (grid_movement)
-      numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    CNumerics *edge_numerics = (Work == NULL? numerics : Work->Numerics[CONV_TERM]);
+    su2double *Vec_i = (Work == NULL? Vector_i : Work->Vector_i), *Vec_j = (Work == NULL? Vector_j : Work->Vector_j);
+    su2double *Prim_i = (Work == NULL? FlowPrimVar_i : Work->Primitive_i), *Prim_j = (Work == NULL? FlowPrimVar_j : Work->Primitive_j);
+    su2double *Sol_i = (Work == NULL? Solution_i : Work->Solution_i), *Sol_j = (Work == NULL? Solution_j : Work->Solution_j);
+    su2double *Res = (Work == NULL? Residual : Work->Residual);
+    su2double **Jac_i = (Work == NULL? Jacobian_i : Work->Jacobian_i), **Jac_j = (Work == NULL? Jacobian_j : Work->Jacobian_j);
     
-    if (muscl) {
-
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
-        Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
-      }
-      
-      /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
-      
-      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
-      if (limiter) {
-        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
-      }
-      
-      for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
-        if (limiter) {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          FlowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
-          FlowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
-      }
-      
-      numerics->SetPrimitive(FlowPrimVar_i, FlowPrimVar_j);
-      
-      /*--- Turbulent variables using gradient reconstruction and limiters ---*/
-      
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter();
-        Limiter_j = node[jPoint]->GetLimiter();
-      }
-      
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-        }
-        if (limiter) {
-          Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
-        }
-        else {
-          Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
-          Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+        
+        /*--- Points in edge and normal vectors ---*/
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
+        edge_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+        
+        /*--- Primitive variables w/o reconstruction ---*/
+        
+        V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
+        V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
+        edge_numerics->SetPrimitive(V_i, V_j);
+        
+        /*--- Turbulent variables w/o reconstruction ---*/
+        
+        Turb_i = node[iPoint]->GetSolution();
+        Turb_j = node[jPoint]->GetSolution();
+        edge_numerics->SetTurbVar(Turb_i, Turb_j);
+        
+        /*--- Grid Movement ---*/
+        
+        if (grid_movement)
+          edge_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+        
+        if (muscl) {
+          
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Vec_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
+            Vec_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
+          }
+          
+          /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
+          
+          Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+          Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
+          if (limiter) {
+            Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
+            Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
+          }
+          
+          for (iVar = 0; iVar < solver_container[FLOW_SOL]->GetnPrimVarGrad(); iVar++) {
+            Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Project_Grad_i += Vec_i[iDim]*Gradient_i[iVar][iDim];
+              Project_Grad_j += Vec_j[iDim]*Gradient_j[iVar][iDim];
+            }
+            if (limiter) {
+              Prim_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+              Prim_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+            }
+            else {
+              Prim_i[iVar] = V_i[iVar] + Project_Grad_i;
+              Prim_j[iVar] = V_j[iVar] + Project_Grad_j;
+            }
+          }
+          
+          edge_numerics->SetPrimitive(Prim_i, Prim_j);
+          
+          /*--- Turbulent variables using gradient reconstruction and limiters ---*/
+          
+          Gradient_i = node[iPoint]->GetGradient();
+          Gradient_j = node[jPoint]->GetGradient();
+          if (limiter) {
+            Limiter_i = node[iPoint]->GetLimiter();
+            Limiter_j = node[jPoint]->GetLimiter();
+          }
+          
+          for (iVar = 0; iVar < nVar; iVar++) {
+            Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Project_Grad_i += Vec_i[iDim]*Gradient_i[iVar][iDim];
+              Project_Grad_j += Vec_j[iDim]*Gradient_j[iVar][iDim];
+            }
+            if (limiter) {
+              Sol_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+              Sol_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+            }
+            else {
+              Sol_i[iVar] = Turb_i[iVar] + Project_Grad_i;
+              Sol_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+            }
+          }
+          
+          edge_numerics->SetTurbVar(Sol_i, Sol_j);
+          
         }
+        
+        /*--- Add and subtract residual ---*/
+        
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
+        
+        LinSysRes.UpdateBlocks(iPoint, jPoint, Res);
+        
+        /*--- Implicit part ---*/
+        
+        Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+        
       }
-      
-      numerics->SetTurbVar(Solution_i, Solution_j);
-      
     }
-    
-    /*--- Add and subtract residual ---*/
-    
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    
-    LinSysRes.AddBlock(iPoint, Residual);
-    LinSysRes.SubtractBlock(jPoint, Residual);
-    
-    /*--- Implicit part ---*/
-    
-    Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    
   }
   
 }
 
 void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    /*--- Points coordinates, and normal vector ---*/
-    
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
-                       geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Conservative variables w/o reconstruction ---*/
-    
-    numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(),
-                           solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive());
-    
-    /*--- Turbulent variables w/o reconstruction, and its gradients ---*/
-    
-    numerics->SetTurbVar(node[iPoint]->GetSolution(), node[jPoint]->GetSolution());
-    numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
-    
-    /*--- Menter's first blending function (only SST)---*/
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
-    
-    /*--- Compute residual, and Jacobians ---*/
-    
-    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-    
-    /*--- Add and subtract residual, and update Jacobians ---*/
-    
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
+  /*--- Loop over the edges by colors, the threads add their fluxes without conflicts ---*/
+  
+#ifdef HAVE_OMP
+#pragma omp parallel num_threads(nThread_Edge)
+#endif
+  {
+    unsigned long iColor, iEdge, iEdge_Loop, iPoint, jPoint;
+    unsigned short iThread = omp_get_thread_num();
     
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    CNumerics *edge_numerics = (iThread == 0? numerics : EdgeWork[iThread]->Numerics[VISC_TERM]);
+    su2double *Res = (iThread == 0? Residual : EdgeWork[iThread]->Residual);
+    su2double **Jac_i = (iThread == 0? Jacobian_i : EdgeWork[iThread]->Jacobian_i);
+    su2double **Jac_j = (iThread == 0? Jacobian_j : EdgeWork[iThread]->Jacobian_j);
     
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+        
+        /*--- Points in edge ---*/
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
+        
+        /*--- Points coordinates, and normal vector ---*/
+        
+        edge_numerics->SetCoord(geometry->node[iPoint]->GetCoord(),
+                                geometry->node[jPoint]->GetCoord());
+        edge_numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+        
+        /*--- Conservative variables w/o reconstruction ---*/
+        
+        edge_numerics->SetPrimitive(solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive(),
+                                    solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive());
+        
+        /*--- Turbulent variables w/o reconstruction, and its gradients ---*/
+        
+        edge_numerics->SetTurbVar(node[iPoint]->GetSolution(), node[jPoint]->GetSolution());
+        edge_numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
+        
+        /*--- Menter's first blending function (only SST)---*/
+        if (config->GetKind_Turb_Model() == SST)
+          edge_numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
+        
+        /*--- Compute residual, and Jacobians ---*/
+        
+        edge_numerics->ComputeResidual(Res, Jac_i, Jac_j, config);
+        
+        /*--- Add and subtract residual, and update Jacobians ---*/
+        
+        LinSysRes.UpdateBlocksSub(iPoint, jPoint, Res);
+        
+        Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jac_i, Jac_j);
+        
+      }
+    }
   }
   
 }
@@ -705,6 +529,9 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
   
   /*--- Build implicit system ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(Vol, Delta, iVar, total_index) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     
     /*--- Read the volume ---*/
@@ -722,6 +549,14 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
       total_index = iPoint*nVar+iVar;
       LinSysRes[total_index] = - LinSysRes[total_index];
       LinSysSol[total_index] = 0.0;
+    }
+  }
+  
+  /*--- Residual norms, in a serial loop so that they do not depend on the number of threads ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar+iVar;
       AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
       AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
     }
@@ -729,6 +564,9 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
   
   /*--- Initialize residual and solution at the ghost points ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, total_index) schedule(static)
+#endif
   for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
     for (iVar = 0; iVar < nVar; iVar++) {
       total_index = iPoint*nVar + iVar;
@@ -739,8 +577,7 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
   
   /*--- Solve or smooth the linear system ---*/
   
-  CSysSolve system;
-  system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
   
   /*--- Update solution (system written in terms of increments) ---*/
   
@@ -752,6 +589,9 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
         
       case SA: case SA_E: case SA_COMP: case SA_E_COMP: 
         
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
         for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
           node[iPoint]->AddClippedSolution(0, config->GetRelaxation_Factor_Turb()*LinSysSol[iPoint], lowerlimit[0], upperlimit[0]);
         }
@@ -760,6 +600,9 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
         
       case SA_NEG:
         
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
         for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
           node[iPoint]->AddSolution(0, config->GetRelaxation_Factor_Turb()*LinSysSol[iPoint]);
         }
@@ -768,6 +611,9 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
       case SST:
         
+#ifdef HAVE_OMP
+#pragma omp parallel for firstprivate(density_old, density) private(iVar) schedule(static)
+#endif
         for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
           
           if (compressible) {
@@ -1342,10 +1188,14 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   fv1 = Ji_3/(Ji_3+cv1_3);
   muT_Inf = Density_Inf*fv1*nu_tilde_Inf;
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- Initialize the solution to the far-field state everywhere, the fields
+   of all the points are stored contiguously (one block per field). ---*/
 
+  node_storage = new CVariableStorage(nPoint);
+  CVariable::SetStorage(node_storage);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CTurbSAVariable(nu_tilde_Inf, muT_Inf, nDim, nVar, config);
+  CVariable::SetStorage(NULL);
 
   /*--- MPI solution ---*/
 
@@ -1437,6 +1287,9 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
   su2double* Vorticity = NULL;
   su2double Laminar_Viscosity = 0;
   
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Initialize the residual vector ---*/
@@ -1463,6 +1316,9 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
     /*--- Set the vortex tilting coefficient at every node if required ---*/
     
     if (kind_hybridRANSLES == SA_EDDES){
+#ifdef HAVE_OMP
+#pragma omp parallel for private(PrimGrad_Flow, Vorticity, Laminar_Viscosity) schedule(static)
+#endif
       for (iPoint = 0; iPoint < nPoint; iPoint++){
         PrimGrad_Flow      = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
         Vorticity          = solver_container[FLOW_SOL]->node[iPoint]->GetVorticity();
@@ -1488,6 +1344,9 @@ void CTurbSASolver::Postprocessing(CGeometry *geometry, CSolver **solver_contain
   
   /*--- Compute eddy viscosity ---*/
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(rho, mu, nu, nu_hat, muT, Ji, Ji_3, fv1) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     rho = solver_container[FLOW_SOL]->node[iPoint]->GetDensity();
@@ -1679,7 +1538,8 @@ void CTurbSASolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container
   
   bool grid_movement  = config->GetGrid_Movement();
   
-  Normal = new su2double[nDim];
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
   
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     
@@ -1730,7 +1590,7 @@ void CTurbSASolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container
     }
   }
   
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -1740,7 +1600,8 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
   unsigned long iVertex, iPoint;
   su2double *V_inlet, *V_domain, *Normal;
   
-  Normal = new su2double[nDim];
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
   
   bool grid_movement  = config->GetGrid_Movement();
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
@@ -1826,7 +1687,7 @@ void CTurbSASolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, CN
   }
   
   /*--- Free locally allocated memory ---*/
-  delete[] Normal;
+  Scratch->Pop();
   
 }
 
@@ -1838,7 +1699,8 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
   
   bool grid_movement  = config->GetGrid_Movement();
   
-  Normal = new su2double[nDim];
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   
@@ -1921,7 +1783,7 @@ void CTurbSASolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container, C
   
   /*--- Free locally allocated memory ---*/
   
-  delete[] Normal;
+  Scratch->Pop();
   
 }
 
@@ -3394,10 +3256,14 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   /*--- Eddy viscosity, initialized without stress limiter at the infinity ---*/
   muT_Inf = rhoInf*kine_Inf/omega_Inf;
 
-  /*--- Initialize the solution to the far-field state everywhere. ---*/
+  /*--- Initialize the solution to the far-field state everywhere, the fields
+   of all the points are stored contiguously (one block per field). ---*/
 
+  node_storage = new CVariableStorage(nPoint);
+  CVariable::SetStorage(node_storage);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     node[iPoint] = new CTurbSSTVariable(kine_Inf, omega_Inf, muT_Inf, nDim, nVar, constants, config);
+  CVariable::SetStorage(NULL);
 
   /*--- MPI solution ---*/
 
@@ -3489,6 +3355,9 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
   bool limiter_flow     = ((config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (ExtIter <= config->GetLimiterIter()) && !(disc_adjoint && config->GetFrozen_Limiter_Disc()));
   bool limiter_turb     = ((config->GetKind_SlopeLimit_Turb() != NO_LIMITER) && (ExtIter <= config->GetLimiterIter()) && !(disc_adjoint && config->GetFrozen_Limiter_Disc()));
 
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Initialize the residual vector ---*/
@@ -3526,6 +3395,9 @@ void CTurbSSTSolver::Postprocessing(CGeometry *geometry, CSolver **solver_contai
     SetSolution_Gradient_LS(geometry, config);
   }
   
+#ifdef HAVE_OMP
+#pragma omp parallel for private(rho, mu, dist, omega, kine, strMag, F2, muT, zeta) schedule(static)
+#endif
   for (iPoint = 0; iPoint < nPoint; iPoint ++) {
     
     /*--- Compute blending functions and cross diffusion ---*/
@@ -3719,7 +3591,8 @@ void CTurbSSTSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
   
   bool grid_movement = config->GetGrid_Movement();
   
-  Normal = new su2double[nDim];
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
   
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     
@@ -3773,7 +3646,7 @@ void CTurbSSTSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_containe
     }
   }
   
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -3784,7 +3657,8 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
   unsigned long iVertex, iPoint;
   su2double *V_inlet, *V_domain, *Normal;
 
-  Normal = new su2double[nDim];
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
 
   bool grid_movement  = config->GetGrid_Movement();
 
@@ -3880,7 +3754,7 @@ void CTurbSSTSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container, C
   
   /*--- Free locally allocated memory ---*/
   
-  delete [] Normal;
+  Scratch->Pop();
   
 }
 
@@ -3892,7 +3766,8 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   
   bool grid_movement  = config->GetGrid_Movement();
   
-  Normal = new su2double[nDim];
+  Scratch->Push();
+  Normal = Scratch->GetVector(nDim);
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   
@@ -3978,7 +3853,7 @@ void CTurbSSTSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   }
   
   /*--- Free locally allocated memory ---*/
-  delete[] Normal;
+  Scratch->Pop();
   
 }
 
@@ -37,6 +37,156 @@
 
 #include "../include/solver_structure.hpp"
 
+CEdgeWork::CEdgeWork(CNumerics **val_numerics, unsigned short val_nDim, unsigned short val_nVar,
+                     unsigned short val_nPrimVar, unsigned short val_nSecondaryVar) {
+  
+  unsigned short iVar;
+  
+  Numerics = val_numerics;
+  nVar = val_nVar;
+  
+  Vector_i = new su2double [val_nDim]; Vector_j = new su2double [val_nDim];
+  Primitive_i = new su2double [val_nPrimVar]; Primitive_j = new su2double [val_nPrimVar];
+  Secondary_i = new su2double [val_nSecondaryVar]; Secondary_j = new su2double [val_nSecondaryVar];
+  Solution_i = new su2double [nVar]; Solution_j = new su2double [nVar];
+  Residual = new su2double [nVar];
+  
+  Jacobian_i = new su2double* [nVar];
+  Jacobian_j = new su2double* [nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Jacobian_i[iVar] = new su2double [nVar];
+    Jacobian_j[iVar] = new su2double [nVar];
+  }
+  
+}
+
+CEdgeWork::~CEdgeWork(void) {
+  
+  unsigned short iVar;
+  
+  delete [] Vector_i; delete [] Vector_j;
+  delete [] Primitive_i; delete [] Primitive_j;
+  delete [] Secondary_i; delete [] Secondary_j;
+  delete [] Solution_i; delete [] Solution_j;
+  delete [] Residual;
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    delete [] Jacobian_i[iVar];
+    delete [] Jacobian_j[iVar];
+  }
+  delete [] Jacobian_i;
+  delete [] Jacobian_j;
+  
+}
+
+CScratchPool::CScratchPool(void) {
+  
+  iBlock = 0; Top = 0;
+  iRow_Block = 0; Row_Top = 0;
+  nAllocation = 0;
+  Locked = false;
+  
+  /*--- Deep enough for the nesting of the routines, growing it counts as an allocation ---*/
+  
+  Mark.reserve(4*16);
+  
+}
+
+CScratchPool::~CScratchPool(void) {
+  
+  unsigned long jBlock;
+  
+  for (jBlock = 0; jBlock < Block.size(); jBlock++) delete [] Block[jBlock];
+  for (jBlock = 0; jBlock < Row_Block.size(); jBlock++) delete [] Row_Block[jBlock];
+  
+}
+
+void CScratchPool::NewAllocation(void) {
+  
+  nAllocation++;
+  
+  if (Locked)
+    SU2_MPI::Error("Heap allocation of the scratch memory after the first iteration.", CURRENT_FUNCTION);
+  
+}
+
+void CScratchPool::Push(void) {
+  
+  if (Mark.size() == Mark.capacity()) NewAllocation();
+  
+  Mark.push_back(iBlock); Mark.push_back(Top);
+  Mark.push_back(iRow_Block); Mark.push_back(Row_Top);
+  
+}
+
+void CScratchPool::Pop(void) {
+  
+  Row_Top = Mark.back(); Mark.pop_back();
+  iRow_Block = Mark.back(); Mark.pop_back();
+  Top = Mark.back(); Mark.pop_back();
+  iBlock = Mark.back(); Mark.pop_back();
+  
+}
+
+su2double *CScratchPool::GetVector(unsigned long val_size) {
+  
+  su2double *Vector;
+  
+  /*--- Move to the next block that has room for the vector, a new block is only
+   created when the routines need more memory than they ever did before. ---*/
+  
+  while ((iBlock < Block.size()) && (Top+val_size > Block_Size[iBlock])) {
+    iBlock++; Top = 0;
+  }
+  
+  if (iBlock == Block.size()) {
+    
+    /*--- The block, and the lists of blocks when they grow, are heap allocations ---*/
+    
+    if (Block.size() == Block.capacity()) NewAllocation();
+    if (Block_Size.size() == Block_Size.capacity()) NewAllocation();
+    NewAllocation();
+    Block_Size.push_back(max(val_size, (unsigned long)4096));
+    Block.push_back(new su2double [Block_Size.back()]);
+    Top = 0;
+  }
+  
+  Vector = &Block[iBlock][Top];
+  Top += val_size;
+  
+  return Vector;
+  
+}
+
+su2double **CScratchPool::GetMatrix(unsigned long val_nRow, unsigned long val_nCol) {
+  
+  unsigned long iRow;
+  su2double **Matrix, *Values;
+  
+  while ((iRow_Block < Row_Block.size()) && (Row_Top+val_nRow > Row_Block_Size[iRow_Block])) {
+    iRow_Block++; Row_Top = 0;
+  }
+  
+  if (iRow_Block == Row_Block.size()) {
+    if (Row_Block.size() == Row_Block.capacity()) NewAllocation();
+    if (Row_Block_Size.size() == Row_Block_Size.capacity()) NewAllocation();
+    NewAllocation();
+    Row_Block_Size.push_back(max(val_nRow, (unsigned long)256));
+    Row_Block.push_back(new su2double* [Row_Block_Size.back()]);
+    Row_Top = 0;
+  }
+  
+  Matrix = &Row_Block[iRow_Block][Row_Top];
+  Row_Top += val_nRow;
+  
+  Values = GetVector(val_nRow*val_nCol);
+  for (iRow = 0; iRow < val_nRow; iRow++)
+    Matrix[iRow] = &Values[iRow*val_nCol];
+  
+  return Matrix;
+  
+}
+
 CSolver::CSolver(void) {
 
   rank = SU2_MPI::GetRank();
@@ -45,6 +195,8 @@ CSolver::CSolver(void) {
   /*--- Array initialization ---*/
   
   OutputHeadingNames = NULL;
+  MatrixFree_Product = NULL;
+  node_storage       = NULL;
   Residual_RMS       = NULL;
   Residual_Max       = NULL;
   Residual_BGS       = NULL;
@@ -81,6 +233,12 @@ CSolver::CSolver(void) {
   Restart_Data       = NULL;
   node               = NULL;
   nOutputVariables   = 0;
+  nPrimVar           = 0;
+  nSecondaryVar      = 0;
+  nThread_Edge       = 1;
+  EdgeWork           = NULL;
+  Scratch            = new CScratchPool();
+  Halo_Overlap       = false;
 
   /*--- Inlet profile data structures. ---*/
 
@@ -108,6 +266,8 @@ CSolver::~CSolver(void) {
     }
     delete [] node;
   }
+  
+  if (node_storage != NULL) delete node_storage;
 
   /*--- Private ---*/
 
@@ -206,6 +366,57 @@ CSolver::~CSolver(void) {
   if (nCol_InletFile    != NULL) delete [] nCol_InletFile;    nCol_InletFile    = NULL;
   if (Inlet_Data        != NULL) delete [] Inlet_Data;        Inlet_Data        = NULL;
 
+  if (Scratch != NULL) delete Scratch;
+  
+  for (map<unsigned short, CHaloExchange*>::iterator it = Halo.begin(); it != Halo.end(); ++it)
+    delete it->second;
+
+  if (EdgeWork != NULL) {
+    for (unsigned short iThread = 1; iThread < nThread_Edge; iThread++)
+      delete EdgeWork[iThread];
+    delete [] EdgeWork;
+  }
+
+}
+
+CHaloExchange *CSolver::GetHalo(CGeometry *geometry, CConfig *config, unsigned short val_nCount) {
+  
+  map<unsigned short, CHaloExchange*>::iterator it = Halo.find(val_nCount);
+  
+  if (it != Halo.end()) return it->second;
+  
+  /*--- The driver builds the pattern during the preprocessing, the other
+   executables get it the first time a solver exchanges its halo. ---*/
+  
+  if (!geometry->GetHalo_Pattern_Valid()) geometry->SetHalo_Pattern(config);
+  
+  CHaloExchange *NewHalo = new CHaloExchange(geometry, val_nCount);
+  Halo[val_nCount] = NewHalo;
+  
+  return NewHalo;
+  
+}
+
+void CSolver::SetEdgeWork(unsigned short val_nThread, CNumerics ***val_numerics) {
+  
+  unsigned short iThread;
+  
+  if (EdgeWork != NULL) {
+    for (iThread = 1; iThread < nThread_Edge; iThread++)
+      delete EdgeWork[iThread];
+    delete [] EdgeWork;
+  }
+  
+  /*--- The primitive arrays have room for the flow primitives, which the
+   turbulence solvers reconstruct as well ---*/
+  
+  nThread_Edge = val_nThread;
+  EdgeWork = new CEdgeWork* [nThread_Edge];
+  EdgeWork[0] = NULL;
+  for (iThread = 1; iThread < nThread_Edge; iThread++)
+    EdgeWork[iThread] = new CEdgeWork(val_numerics[iThread], nDim, nVar, max(nPrimVar, (unsigned short)(nDim+9)),
+                                      nSecondaryVar);
+  
 }
 
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
@@ -652,7 +863,8 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
   r23_b, r33, z11, z12, z13, z22, z23, z33, detR2, product;
   bool singular = false;
   
-  su2double *Cvector = new su2double [nDim];
+  Scratch->Push();
+  su2double *Cvector = Scratch->GetVector(nDim);
   
   /*--- Loop over points of the grid ---*/
   
@@ -760,7 +972,7 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
     }
   }
   
-  delete [] Cvector;
+  Scratch->Pop();
   
   /*--- Gradient MPI ---*/
   
@@ -769,31 +981,45 @@ void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
 }
 
 void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
+  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iEdge_Loop, iColor, iVertex;
   unsigned short iVar, iDim, iMarker;
   su2double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
   Partial_Res, Grad_Val, *Normal;
   
   /*--- Set Gradient to Zero ---*/
+#ifdef HAVE_OMP
+#pragma omp parallel for schedule(static)
+#endif
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
     node[iPoint]->SetGradientZero();
   
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Solution_i = node[iPoint]->GetSolution();
-    Solution_j = node[jPoint]->GetSolution();
-    Normal = geometry->edge[iEdge]->GetNormal();
-    for (iVar = 0; iVar< nVar; iVar++) {
-      Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = Solution_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient(iVar, iDim, Partial_Res);
+  /*--- Loop interior edges, by colors (the edges of a color share no point) ---*/
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Solution_i, Solution_j, Normal, iVar, iDim, Solution_Average, Partial_Res)
+#endif
+  for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+    for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+      
+      iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Solution_i = node[iPoint]->GetSolution();
+      Solution_j = node[jPoint]->GetSolution();
+      Normal = geometry->edge[iEdge]->GetNormal();
+      for (iVar = 0; iVar< nVar; iVar++) {
+        Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Partial_Res = Solution_Average*Normal[iDim];
+          if (geometry->node[iPoint]->GetDomain())
+            node[iPoint]->AddGradient(iVar, iDim, Partial_Res);
+          if (geometry->node[jPoint]->GetDomain())
+            node[jPoint]->SubtractGradient(iVar, iDim, Partial_Res);
+        }
       }
     }
   }
@@ -816,6 +1042,9 @@ void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
   }
   
   /*--- Compute gradient ---*/
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, iDim, Gradient, DualArea, Grad_Val) schedule(static)
+#endif
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
     for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++) {
@@ -836,12 +1065,45 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   unsigned long iPoint, jPoint;
   su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
   r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
-  z22, z23, z33, product;
+  z22, z23, z33, product, **Gradient, *Weight, Delta;
   bool singular = false;
   
-  su2double **Cvector = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Cvector[iVar] = new su2double [nDim];
+  /*--- The weights of the neighbors only depend on the grid and are stored in the
+   geometry, the gradient is then a single sweep over the neighbors of each point.
+   The discrete adjoint builds the matrices below to record the coordinates. ---*/
+  
+  if (!config->GetDiscrete_Adjoint()) {
+    
+    if (!geometry->GetLSGradient_Weights_Valid()) geometry->SetLSGradient_Weights();
+    
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, iDim, iNeigh, jPoint, Solution_i, Solution_j, Gradient, Weight, Delta) schedule(static)
+#endif
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      Solution_i = node[iPoint]->GetSolution();
+      Gradient = node[iPoint]->GetGradient();
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Gradient[iVar][iDim] = 0.0;
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        Solution_j = node[jPoint]->GetSolution();
+        Weight = geometry->GetLSGradient_Weight(iPoint, iNeigh);
+        for (iVar = 0; iVar < nVar; iVar++) {
+          Delta = Solution_j[iVar]-Solution_i[iVar];
+          for (iDim = 0; iDim < nDim; iDim++)
+            Gradient[iVar][iDim] += Weight[iDim]*Delta;
+        }
+      }
+    }
+    
+    Set_MPI_Solution_Gradient(geometry, config);
+    return;
+    
+  }
+  
+  Scratch->Push();
+  su2double **Cvector = Scratch->GetMatrix(nVar, nDim);
   
   /*--- Loop over points of the grid ---*/
   
@@ -972,11 +1234,9 @@ void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
     AD::EndPreacc();
   }
   
-  /*--- Deallocate memory ---*/
+  /*--- Give back the scratch memory ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Cvector[iVar];
-  delete [] Cvector;
+  Scratch->Pop();
   
   /*--- Gradient MPI ---*/
   
@@ -993,9 +1253,8 @@ void CSolver::SetGridVel_Gradient(CGeometry *geometry, CConfig *config) {
   su2double **Cvector;
   
   /*--- Note that all nVar entries in this routine have been changed to nDim ---*/
-  Cvector = new su2double* [nDim];
-  for (iVar = 0; iVar < nDim; iVar++)
-    Cvector[iVar] = new su2double [nDim];
+  Scratch->Push();
+  Cvector = Scratch->GetMatrix(nDim, nDim);
   
   /*--- Loop over points of the grid ---*/
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
@@ -1081,10 +1340,8 @@ void CSolver::SetGridVel_Gradient(CGeometry *geometry, CConfig *config) {
     }
   }
   
-  /*--- Deallocate memory ---*/
-  for (iVar = 0; iVar < nDim; iVar++)
-    delete [] Cvector[iVar];
-  delete [] Cvector;
+  /*--- Give back the scratch memory ---*/
+  Scratch->Pop();
   
   /*--- Gradient MPI ---*/
   // TO DO!!!
@@ -1100,10 +1357,9 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
   su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j;
   su2double **Smatrix, *Cvector;
   
-  Smatrix = new su2double* [nDim];
-  Cvector = new su2double [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    Smatrix[iDim] = new su2double [nDim];
+  Scratch->Push();
+  Smatrix = Scratch->GetMatrix(nDim, nDim);
+  Cvector = Scratch->GetVector(nDim);
   
   
   /*--- Loop over boundary markers to select those for Euler or NS walls ---*/
@@ -1203,16 +1459,13 @@ void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
     }
   }
   
-  /*--- Memory deallocation ---*/
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Smatrix[iDim];
-  delete [] Cvector;
-  delete [] Smatrix;
+  /*--- Give back the scratch memory ---*/
+  Scratch->Pop();
 }
 
 void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iEdge, iPoint, jPoint;
+  unsigned long iEdge, iEdge_Loop, iColor, iPoint, jPoint;
   unsigned short iVar, iDim;
   su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
   *Solution, *Solution_i, *Solution_j, *LocalMinSolution, *LocalMaxSolution,
@@ -1224,6 +1477,9 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
   
   if (config->GetKind_SlopeLimit() == NO_LIMITER) {
     
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar) schedule(static)
+#endif
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nVar; iVar++) {
         node[iPoint]->SetLimiter(iVar, 1.0);
@@ -1236,6 +1492,9 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     
     /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
     
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar) schedule(static)
+#endif
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nVar; iVar++) {
         node[iPoint]->SetSolution_Max(iVar, -EPS);
@@ -1244,30 +1503,42 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
       }
     }
     
-    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
+    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables,
+     by colors of the edges --*/
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      /*--- Point identification, Normal vector and area ---*/
-      
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
-      
-      /*--- Get the conserved variables ---*/
-      
-      Solution_i = node[iPoint]->GetSolution();
-      Solution_j = node[jPoint]->GetSolution();
-      
-      /*--- Compute the maximum, and minimum values for nodes i & j ---*/
-      
-      for (iVar = 0; iVar < nVar; iVar++) {
-        du = (Solution_j[iVar] - Solution_i[iVar]);
-        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
-        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
-        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
-        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Solution_i, Solution_j, iVar, du)
+#endif
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
+        
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
+
+        
+        /*--- Point identification, Normal vector and area ---*/
+        
+        iPoint = geometry->edge[iEdge]->GetNode(0);
+        jPoint = geometry->edge[iEdge]->GetNode(1);
+        
+        /*--- Get the conserved variables ---*/
+        
+        Solution_i = node[iPoint]->GetSolution();
+        Solution_j = node[jPoint]->GetSolution();
+        
+        /*--- Compute the maximum, and minimum values for nodes i & j ---*/
+        
+        for (iVar = 0; iVar < nVar; iVar++) {
+          du = (Solution_j[iVar] - Solution_i[iVar]);
+          node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+          node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+          node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+          node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+        }
+        
       }
-      
     }
     
   }
@@ -1276,70 +1547,84 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
   
   if (config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) {
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
-      
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nVar, nDim);
-      AD::SetPreaccIn(Gradient_j, nVar, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-
-      for (iVar = 0; iVar < nVar; iVar++) {
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Gradient_i, Gradient_j, Coord_i, Coord_j, iVar, iDim, dm, dp, limiter)
+#endif
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
         
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
 
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
         
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-          else dp = node[iPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
+        iPoint     = geometry->edge[iEdge]->GetNode(0);
+        jPoint     = geometry->edge[iEdge]->GetNode(1);
+        Gradient_i = node[iPoint]->GetGradient();
+        Gradient_j = node[jPoint]->GetGradient();
+        Coord_i    = geometry->node[iPoint]->GetCoord();
+        Coord_j    = geometry->node[jPoint]->GetCoord();
         
-        if (limiter < node[iPoint]->GetLimiter(iVar)) {
-          node[iPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter()[iVar]);
+        AD::StartPreacc();
+        AD::SetPreaccIn(Gradient_i, nVar, nDim);
+        AD::SetPreaccIn(Gradient_j, nVar, nDim);
+        AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+
+        for (iVar = 0; iVar < nVar; iVar++) {
+          
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+
+          /*--- Calculate the interface left gradient, delta- (dm) ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+          
+          if (dm == 0.0) { limiter = 2.0; }
+          else {
+            if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+            else dp = node[iPoint]->GetSolution_Min(iVar);
+            limiter = dp/dm;
+          }
+          
+          if (limiter < node[iPoint]->GetLimiter(iVar)) {
+            node[iPoint]->SetLimiter(iVar, limiter);
+            AD::SetPreaccOut(node[iPoint]->GetLimiter()[iVar]);
+          }
+          
+          /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+          
+          if (dm == 0.0) { limiter = 2.0; }
+          else {
+            if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
+            else dp = node[jPoint]->GetSolution_Min(iVar);
+            limiter = dp/dm;
+          }
+          
+          if (limiter < node[jPoint]->GetLimiter(iVar)) {
+            node[jPoint]->SetLimiter(iVar, limiter);
+            AD::SetPreaccOut(node[jPoint]->GetLimiter()[iVar]);
+          }
+
         }
         
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+        AD::EndPreacc();
         
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-          else dp = node[jPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
-        
-        if (limiter < node[jPoint]->GetLimiter(iVar)) {
-          node[jPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter()[iVar]);
-        }
-
       }
-      
-      AD::EndPreacc();
-      
     }
 
 
+#ifdef HAVE_OMP
+#pragma omp parallel for private(iVar, y, limiter) schedule(static)
+#endif
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
       for (iVar = 0; iVar < nVar; iVar++) {
         y =  node[iPoint]->GetLimiter(iVar);
@@ -1361,7 +1646,7 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     
     /*--- Compute the max value and min value of the solution ---*/
     
-    Solution = node[iPoint]->GetSolution();
+    Solution = node[0]->GetSolution();
     for (iVar = 0; iVar < nVar; iVar++) {
       LocalMinSolution[iVar] = Solution[iVar];
       LocalMaxSolution[iVar] = Solution[iVar];
@@ -1390,73 +1675,84 @@ void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
     }
 #endif
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
-      
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nVar, nDim);
-      AD::SetPreaccIn(Gradient_j, nVar, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-
-      for (iVar = 0; iVar < nVar; iVar++) {
-        
-        if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
-          eps1 = LimK * (GlobalMaxSolution[iVar] - GlobalMinSolution[iVar]);
-          eps2 = eps1*eps1;
-        }
-        else {
-          eps1 = LimK*dave;
-          eps2 = eps1*eps1*eps1;
-        }
+#ifdef HAVE_OMP
+#pragma omp parallel private(iColor, iEdge, iPoint, jPoint, Gradient_i, Gradient_j, Coord_i, Coord_j, iVar, iDim, eps1, eps2, dm, dp, limiter)
+#endif
+    for (iColor = 0; iColor < geometry->GetnEdge_Color(); iColor++) {
+#ifdef HAVE_OMP
+#pragma omp for schedule(static)
+#endif
+      for (iEdge_Loop = geometry->GetEdge_Color_Begin(iColor); iEdge_Loop < geometry->GetEdge_Color_Begin(iColor+1); iEdge_Loop++) {
         
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+        iEdge = geometry->GetEdge_Color_Edge(iEdge_Loop);
 
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
         
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+        iPoint     = geometry->edge[iEdge]->GetNode(0);
+        jPoint     = geometry->edge[iEdge]->GetNode(1);
+        Gradient_i = node[iPoint]->GetGradient();
+        Gradient_j = node[jPoint]->GetGradient();
+        Coord_i    = geometry->node[iPoint]->GetCoord();
+        Coord_j    = geometry->node[jPoint]->GetCoord();
         
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-        else dp = node[iPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[iPoint]->GetLimiter(iVar)) {
-          node[iPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter()[iVar]);
+        AD::StartPreacc();
+        AD::SetPreaccIn(Gradient_i, nVar, nDim);
+        AD::SetPreaccIn(Gradient_j, nVar, nDim);
+        AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+
+        for (iVar = 0; iVar < nVar; iVar++) {
+          
+          if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+            eps1 = LimK * (GlobalMaxSolution[iVar] - GlobalMinSolution[iVar]);
+            eps2 = eps1*eps1;
+          }
+          else {
+            eps1 = LimK*dave;
+            eps2 = eps1*eps1*eps1;
+          }
+          
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
+          AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+
+          /*--- Calculate the interface left gradient, delta- (dm) ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+          
+          /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+          
+          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+          else dp = node[iPoint]->GetSolution_Min(iVar);
+          
+          limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+          
+          if (limiter < node[iPoint]->GetLimiter(iVar)) {
+            node[iPoint]->SetLimiter(iVar, limiter);
+            AD::SetPreaccOut(node[iPoint]->GetLimiter()[iVar]);
+          }
+          
+          /*-- Repeat for point j on the edge ---*/
+          
+          dm = 0.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+          
+          if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
+          else dp = node[jPoint]->GetSolution_Min(iVar);
+          
+          limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+          
+          if (limiter < node[jPoint]->GetLimiter(iVar)) {
+            node[jPoint]->SetLimiter(iVar, limiter);
+            AD::SetPreaccOut(node[jPoint]->GetLimiter()[iVar]);
+          }
         }
         
-        /*-- Repeat for point j on the edge ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-        else dp = node[jPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[jPoint]->GetLimiter(iVar)) {
-          node[jPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter()[iVar]);
-        }
-      }
-      
-      AD::EndPreacc();
+        AD::EndPreacc();
 
+      }
     }
     
     delete [] LocalMinSolution; delete [] GlobalMinSolution;
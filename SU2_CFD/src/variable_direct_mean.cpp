@@ -111,7 +111,7 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
 
   /*--- Allocate residual structures ---*/
   
-  Res_TruncError = new su2double [nVar];
+  Res_TruncError = NewVector(nVar);
   
   for (iVar = 0; iVar < nVar; iVar++) {
     Res_TruncError[iVar] = 0.0;
@@ -123,33 +123,33 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
     nMGSmooth += config->GetMG_CorrecSmooth(iMesh);
   
   if (nMGSmooth > 0) {
-    Residual_Sum = new su2double [nVar];
-    Residual_Old = new su2double [nVar];
+    Residual_Sum = NewVector(nVar);
+    Residual_Old = NewVector(nVar);
   }
   
   /*--- Allocate undivided laplacian (centered) and limiter (upwind)---*/
   
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) {
-    Undivided_Laplacian = new su2double [nVar];
+    Undivided_Laplacian = NewVector(nVar);
   }
   
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
   
-  Limiter_Primitive = new su2double [nPrimVarGrad];
+  Limiter_Primitive = NewVector(nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Limiter_Primitive[iVar] = 0.0;
   
-  Limiter_Secondary = new su2double [nSecondaryVarGrad];
+  Limiter_Secondary = NewVector(nSecondaryVarGrad);
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
     Limiter_Secondary[iVar] = 0.0;
 
-  Limiter = new su2double [nVar];
+  Limiter = NewVector(nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
-  Solution_Max = new su2double [nPrimVarGrad];
-  Solution_Min = new su2double [nPrimVarGrad];
+  Solution_Max = NewVector(nPrimVarGrad);
+  Solution_Min = NewVector(nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
     Solution_Max[iVar] = 0.0;
     Solution_Min[iVar] = 0.0;
@@ -207,25 +207,23 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   
   /*--- Incompressible flow, primitive variables nDim+3, (P, vx, vy, vz, rho, beta) ---*/
   
-  Primitive = new su2double [nPrimVar];
+  Primitive = NewVector(nPrimVar);
   for (iVar = 0; iVar < nPrimVar; iVar++) Primitive[iVar] = 0.0;
   
-  Secondary = new su2double [nSecondaryVar];
+  Secondary = NewVector(nSecondaryVar);
   for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary[iVar] = 0.0;
 
   /*--- Compressible flow, gradients primitive variables nDim+4, (T, vx, vy, vz, P, rho, h)
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
+  Gradient_Primitive = NewMatrix(nPrimVarGrad, nDim);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Primitive[iVar][iDim] = 0.0;
   }
 
-  Gradient_Secondary = new su2double* [nSecondaryVarGrad];
+  Gradient_Secondary = NewMatrix(nSecondaryVarGrad, nDim);
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++) {
-    Gradient_Secondary[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Secondary[iVar][iDim] = 0.0;
   }
@@ -286,7 +284,7 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   
   /*--- Allocate residual structures ---*/
   
-  Res_TruncError = new su2double [nVar];
+  Res_TruncError = NewVector(nVar);
   
   for (iVar = 0; iVar < nVar; iVar++) {
     Res_TruncError[iVar] = 0.0;
@@ -298,32 +296,32 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
     nMGSmooth += config->GetMG_CorrecSmooth(iMesh);
   
   if (nMGSmooth > 0) {
-    Residual_Sum = new su2double [nVar];
-    Residual_Old = new su2double [nVar];
+    Residual_Sum = NewVector(nVar);
+    Residual_Old = NewVector(nVar);
   }
   
   /*--- Allocate undivided laplacian (centered) and limiter (upwind)---*/
   
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED)
-    Undivided_Laplacian = new su2double [nVar];
+    Undivided_Laplacian = NewVector(nVar);
   
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
 
-  Limiter_Primitive = new su2double [nPrimVarGrad];
+  Limiter_Primitive = NewVector(nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++)
     Limiter_Primitive[iVar] = 0.0;
 
-  Limiter_Secondary = new su2double [nSecondaryVarGrad];
+  Limiter_Secondary = NewVector(nSecondaryVarGrad);
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
     Limiter_Secondary[iVar] = 0.0;
 
-  Limiter = new su2double [nVar];
+  Limiter = NewVector(nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
-  Solution_Max = new su2double [nPrimVarGrad];
-  Solution_Min = new su2double [nPrimVarGrad];
+  Solution_Max = NewVector(nPrimVarGrad);
+  Solution_Min = NewVector(nPrimVarGrad);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
     Solution_Max[iVar] = 0.0;
     Solution_Min[iVar] = 0.0;
@@ -345,12 +343,9 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
     }
   }
 
-  /*--- Allocate and initializate solution for dual time strategy ---*/
+  /*--- Initializate solution for dual time strategy (allocated by CVariable) ---*/
   
   if (dual_time) {
-    Solution_time_n = new su2double [nVar];
-    Solution_time_n1 = new su2double [nVar];
-    
     for (iVar = 0; iVar < nVar; iVar++) {
       Solution_time_n[iVar] = val_solution[iVar];
       Solution_time_n1[iVar] = val_solution[iVar];
@@ -373,26 +368,24 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   
   /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c) ---*/
   
-  Primitive = new su2double [nPrimVar];
+  Primitive = NewVector(nPrimVar);
   for (iVar = 0; iVar < nPrimVar; iVar++) Primitive[iVar] = 0.0;
   
-  Secondary = new su2double [nSecondaryVar];
+  Secondary = NewVector(nSecondaryVar);
   for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary[iVar] = 0.0;
 
 
   /*--- Compressible flow, gradients primitive variables nDim+4, (T, vx, vy, vz, P, rho, h)
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
+  Gradient_Primitive = NewMatrix(nPrimVarGrad, nDim);
   for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Primitive[iVar][iDim] = 0.0;
   }
 
-  Gradient_Secondary = new su2double* [nSecondaryVarGrad];
+  Gradient_Secondary = NewMatrix(nSecondaryVarGrad, nDim);
   for (iVar = 0; iVar < nSecondaryVarGrad; iVar++) {
-    Gradient_Secondary[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim++)
       Gradient_Secondary[iVar][iDim] = 0.0;
   }
@@ -408,28 +401,19 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
 }
 
 CEulerVariable::~CEulerVariable(void) {
-    unsigned short iVar;
 
   if (HB_Source         != NULL) delete [] HB_Source;
-  if (Primitive         != NULL) delete [] Primitive;
-  if (Secondary         != NULL) delete [] Secondary;
-  if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
-  if (Limiter_Secondary != NULL) delete [] Limiter_Secondary;
+  if (Primitive         != NULL) DeleteVector(Primitive);
+  if (Secondary         != NULL) DeleteVector(Secondary);
+  if (Limiter_Primitive != NULL) DeleteVector(Limiter_Primitive);
+  if (Limiter_Secondary != NULL) DeleteVector(Limiter_Secondary);
   if (WindGust          != NULL) delete [] WindGust;
   if (WindGustDer       != NULL) delete [] WindGustDer;
 
-  if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
-    delete [] Gradient_Primitive;
-  }
-  if (Gradient_Secondary != NULL) {
-    for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
-      if (Gradient_Secondary[iVar] != NULL) delete [] Gradient_Secondary[iVar];
-    delete [] Gradient_Secondary;
-  }
+  if (Gradient_Primitive != NULL) DeleteMatrix(Gradient_Primitive, nPrimVarGrad);
+  if (Gradient_Secondary != NULL) DeleteMatrix(Gradient_Secondary, nSecondaryVarGrad);
 
-  if (Undivided_Laplacian != NULL) delete [] Undivided_Laplacian;
+  if (Undivided_Laplacian != NULL) DeleteVector(Undivided_Laplacian);
 
   if (Solution_New != NULL) delete [] Solution_New;
   
@@ -64,12 +64,12 @@ CTurbVariable::CTurbVariable(unsigned short val_nDim, unsigned short val_nvar, C
   /*--- Always allocate the slope limiter,
    and the auxiliar variables (check the logic - JST with 2nd order Turb model - ) ---*/
 
-  Limiter = new su2double [nVar];
+  Limiter = NewVector(nVar);
   for (iVar = 0; iVar < nVar; iVar++)
     Limiter[iVar] = 0.0;
   
-  Solution_Max = new su2double [nVar];
-  Solution_Min = new su2double [nVar];
+  Solution_Max = NewVector(nVar);
+  Solution_Min = NewVector(nVar);
   for (iVar = 0; iVar < nVar; iVar++) {
     Solution_Max[iVar] = 0.0;
     Solution_Min[iVar] = 0.0;
@@ -38,6 +38,78 @@
 #include "../include/variable_structure.hpp"
 
 unsigned short CVariable::nDim = 0;
+CVariableStorage *CVariable::Storage = NULL;
+
+CVariableStorage::CVariableStorage(unsigned long val_nPoint) {
+  
+  nPoint = val_nPoint;
+  nPoint_Started = 0;
+  iField = 0;
+  
+}
+
+CVariableStorage::~CVariableStorage(void) {
+  
+  for (unsigned short iVar = 0; iVar < Data.size(); iVar++) {
+    delete [] Data[iVar];
+    if (Rows[iVar] != NULL) delete [] Rows[iVar];
+  }
+  
+}
+
+void CVariableStorage::NewPoint(void) {
+  
+  if (nPoint_Started == nPoint)
+    SU2_MPI::Error("More variables than points were constructed in the contiguous storage.", CURRENT_FUNCTION);
+  
+  nPoint_Started++;
+  iField = 0;
+  
+}
+
+unsigned short CVariableStorage::NextField(unsigned short val_nRow, unsigned short val_nCol) {
+  
+  unsigned long iPoint, iRow, nRow_Block = max(val_nRow, (unsigned short)1);
+  
+  /*--- The first point allocates the block, all the values are zeroed ---*/
+  
+  if (iField == Data.size()) {
+    nRow.push_back(val_nRow);
+    nCol.push_back(val_nCol);
+    Data.push_back(new su2double [nPoint*nRow_Block*val_nCol]);
+    for (iPoint = 0; iPoint < nPoint*nRow_Block*val_nCol; iPoint++)
+      Data[iField][iPoint] = 0.0;
+    Rows.push_back(NULL);
+    if (val_nRow > 0) {
+      Rows[iField] = new su2double* [nPoint*val_nRow];
+      for (iRow = 0; iRow < nPoint*val_nRow; iRow++)
+        Rows[iField][iRow] = &Data[iField][iRow*val_nCol];
+    }
+  }
+  
+  /*--- The following points must request the same fields in the same order ---*/
+  
+  else if ((nRow[iField] != val_nRow) || (nCol[iField] != val_nCol)) {
+    SU2_MPI::Error("The points request different fields from the contiguous storage.", CURRENT_FUNCTION);
+  }
+  
+  return iField++;
+  
+}
+
+su2double *CVariableStorage::GetVector(unsigned short val_size) {
+  
+  unsigned short iVar = NextField(0, val_size);
+  return &Data[iVar][(nPoint_Started-1)*val_size];
+  
+}
+
+su2double **CVariableStorage::GetMatrix(unsigned short val_nRow, unsigned short val_nCol) {
+  
+  unsigned short iVar = NextField(val_nRow, val_nCol);
+  return &Rows[iVar][(nPoint_Started-1)*val_nRow];
+  
+}
 
 CVariable::CVariable(void) {
 
@@ -56,6 +128,7 @@ CVariable::CVariable(void) {
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Contiguous = false;
   
 }
 
@@ -76,6 +149,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
   Residual_Old = NULL;
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
+  Contiguous = false;
 
   /*--- Initialize the number of solution variables. This version
    of the constructor will be used primarily for converting the
@@ -111,6 +185,11 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
   Residual_Sum = NULL;
   Solution_Adj_Old = NULL;
   
+  /*--- The fields go to the contiguous storage of the solver, if it set one ---*/
+  
+  Contiguous = (Storage != NULL);
+  if (Contiguous) Storage->NewPoint();
+  
   /*--- Initializate the number of dimension and number of variables ---*/
   nDim = val_nDim;
   nVar = val_nvar;
@@ -119,23 +198,22 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
    which is common for all the problems, here it is also possible 
    to allocate some extra flow variables that do not participate 
    in the simulation ---*/
-  Solution = new su2double [nVar];
+  Solution = NewVector(nVar);
   
   for (iVar = 0; iVar < nVar; iVar++)
     Solution[iVar] = 0.0;
 
-  Solution_Old = new su2double [nVar];
+  Solution_Old = NewVector(nVar);
   
-  Gradient = new su2double* [nVar];
+  Gradient = NewMatrix(nVar, nDim);
   for (iVar = 0; iVar < nVar; iVar++) {
-    Gradient[iVar] = new su2double [nDim];
     for (iDim = 0; iDim < nDim; iDim ++)
       Gradient[iVar][iDim] = 0.0;
   }
   
   if (config->GetUnsteady_Simulation() != NO) {
-    Solution_time_n = new su2double [nVar];
-    Solution_time_n1 = new su2double [nVar];
+    Solution_time_n = NewVector(nVar);
+    Solution_time_n1 = NewVector(nVar);
   }
   
 	if (config->GetFSI_Simulation() && config->GetDiscrete_Adjoint()){
@@ -145,27 +223,22 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 }
 
 CVariable::~CVariable(void) {
-  unsigned short iVar;
-
-  if (Solution            != NULL) delete [] Solution;
-  if (Solution_Old        != NULL) delete [] Solution_Old;
-  if (Solution_time_n     != NULL) delete [] Solution_time_n;
-  if (Solution_time_n1    != NULL) delete [] Solution_time_n1;
-  if (Limiter             != NULL) delete [] Limiter;
-  if (Solution_Max        != NULL) delete [] Solution_Max;
-  if (Solution_Min        != NULL) delete [] Solution_Min;
+
+  if (Solution            != NULL) DeleteVector(Solution);
+  if (Solution_Old        != NULL) DeleteVector(Solution_Old);
+  if (Solution_time_n     != NULL) DeleteVector(Solution_time_n);
+  if (Solution_time_n1    != NULL) DeleteVector(Solution_time_n1);
+  if (Limiter             != NULL) DeleteVector(Limiter);
+  if (Solution_Max        != NULL) DeleteVector(Solution_Max);
+  if (Solution_Min        != NULL) DeleteVector(Solution_Min);
   if (Grad_AuxVar         != NULL) delete [] Grad_AuxVar;
   //if (Undivided_Laplacian != NULL) delete [] Undivided_Laplacian; // Need to break pointer dependence btwn CNumerics and CVariable
-  if (Res_TruncError      != NULL) delete [] Res_TruncError;
-  if (Residual_Old        != NULL) delete [] Residual_Old;
-  if (Residual_Sum        != NULL) delete [] Residual_Sum;
+  if (Res_TruncError      != NULL) DeleteVector(Res_TruncError);
+  if (Residual_Old        != NULL) DeleteVector(Residual_Old);
+  if (Residual_Sum        != NULL) DeleteVector(Residual_Sum);
   if (Solution_Adj_Old    != NULL) delete [] Solution_Adj_Old;
   
-  if (Gradient != NULL) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      delete [] Gradient[iVar];
-    delete [] Gradient;
-  }
+  if (Gradient != NULL) DeleteMatrix(Gradient, nVar);
 
 }
 